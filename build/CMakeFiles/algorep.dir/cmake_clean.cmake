@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/algorep.dir/src/main.cc.o"
+  "CMakeFiles/algorep.dir/src/main.cc.o.d"
+  "algorep"
+  "algorep.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
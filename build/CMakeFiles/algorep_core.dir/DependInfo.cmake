@@ -0,0 +1,76 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/build/proto/append_entry.pb.cc" "CMakeFiles/algorep_core.dir/proto/append_entry.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/append_entry.pb.cc.o.d"
+  "/root/repo/build/proto/command_entry.pb.cc" "CMakeFiles/algorep_core.dir/proto/command_entry.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/command_entry.pb.cc.o.d"
+  "/root/repo/build/proto/election_timeout.pb.cc" "CMakeFiles/algorep_core.dir/proto/election_timeout.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/election_timeout.pb.cc.o.d"
+  "/root/repo/build/proto/install_snapshot.pb.cc" "CMakeFiles/algorep_core.dir/proto/install_snapshot.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/install_snapshot.pb.cc.o.d"
+  "/root/repo/build/proto/kv_state.pb.cc" "CMakeFiles/algorep_core.dir/proto/kv_state.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/kv_state.pb.cc.o.d"
+  "/root/repo/build/proto/log_entry.pb.cc" "CMakeFiles/algorep_core.dir/proto/log_entry.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/log_entry.pb.cc.o.d"
+  "/root/repo/build/proto/message.pb.cc" "CMakeFiles/algorep_core.dir/proto/message.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/message.pb.cc.o.d"
+  "/root/repo/build/proto/message_batch.pb.cc" "CMakeFiles/algorep_core.dir/proto/message_batch.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/message_batch.pb.cc.o.d"
+  "/root/repo/build/proto/persistent_state.pb.cc" "CMakeFiles/algorep_core.dir/proto/persistent_state.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/persistent_state.pb.cc.o.d"
+  "/root/repo/build/proto/read_index.pb.cc" "CMakeFiles/algorep_core.dir/proto/read_index.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/read_index.pb.cc.o.d"
+  "/root/repo/build/proto/search_leader.pb.cc" "CMakeFiles/algorep_core.dir/proto/search_leader.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/search_leader.pb.cc.o.d"
+  "/root/repo/build/proto/snapshot.pb.cc" "CMakeFiles/algorep_core.dir/proto/snapshot.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/snapshot.pb.cc.o.d"
+  "/root/repo/build/proto/speed.pb.cc" "CMakeFiles/algorep_core.dir/proto/speed.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/speed.pb.cc.o.d"
+  "/root/repo/build/proto/transfer_leader.pb.cc" "CMakeFiles/algorep_core.dir/proto/transfer_leader.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/transfer_leader.pb.cc.o.d"
+  "/root/repo/build/proto/vote.pb.cc" "CMakeFiles/algorep_core.dir/proto/vote.pb.cc.o" "gcc" "CMakeFiles/algorep_core.dir/proto/vote.pb.cc.o.d"
+  "/root/repo/src/kv/kv_arena.cc" "CMakeFiles/algorep_core.dir/src/kv/kv_arena.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/kv/kv_arena.cc.o.d"
+  "/root/repo/src/kv/kv_engine.cc" "CMakeFiles/algorep_core.dir/src/kv/kv_engine.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/kv/kv_engine.cc.o.d"
+  "/root/repo/src/mpi/mpi_process.cc" "CMakeFiles/algorep_core.dir/src/mpi/mpi_process.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/mpi/mpi_process.cc.o.d"
+  "/root/repo/src/mpi/mpi_rpc.cc" "CMakeFiles/algorep_core.dir/src/mpi/mpi_rpc.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/mpi/mpi_rpc.cc.o.d"
+  "/root/repo/src/mpi/mpi_staged_rpc.cc" "CMakeFiles/algorep_core.dir/src/mpi/mpi_staged_rpc.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/mpi/mpi_staged_rpc.cc.o.d"
+  "/root/repo/src/raft/raft_applier.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_applier.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_applier.cc.o.d"
+  "/root/repo/src/raft/raft_client.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_client.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_client.cc.o.d"
+  "/root/repo/src/raft/raft_clock.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_clock.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_clock.cc.o.d"
+  "/root/repo/src/raft/raft_controller.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_controller.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_controller.cc.o.d"
+  "/root/repo/src/raft/raft_kv_state_machine.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_kv_state_machine.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_kv_state_machine.cc.o.d"
+  "/root/repo/src/raft/raft_multi_client.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_multi_client.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_multi_client.cc.o.d"
+  "/root/repo/src/raft/raft_multi_server.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_multi_server.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_multi_server.cc.o.d"
+  "/root/repo/src/raft/raft_progress.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_progress.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_progress.cc.o.d"
+  "/root/repo/src/raft/raft_quorum.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_quorum.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_quorum.cc.o.d"
+  "/root/repo/src/raft/raft_server.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_server.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_server.cc.o.d"
+  "/root/repo/src/raft/raft_sessions.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_sessions.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_sessions.cc.o.d"
+  "/root/repo/src/raft/raft_state_machine.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_state_machine.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_state_machine.cc.o.d"
+  "/root/repo/src/raft/raft_storage.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_storage.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_storage.cc.o.d"
+  "/root/repo/src/raft/raft_waiter.cc" "CMakeFiles/algorep_core.dir/src/raft/raft_waiter.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/raft/raft_waiter.cc.o.d"
+  "/root/repo/src/rpc/group_rpc.cc" "CMakeFiles/algorep_core.dir/src/rpc/group_rpc.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/rpc/group_rpc.cc.o.d"
+  "/root/repo/src/storage/wal.cc" "CMakeFiles/algorep_core.dir/src/storage/wal.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/storage/wal.cc.o.d"
+  "/root/repo/src/utils/arg_parser.cc" "CMakeFiles/algorep_core.dir/src/utils/arg_parser.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/utils/arg_parser.cc.o.d"
+  "/root/repo/src/utils/serialization.cc" "CMakeFiles/algorep_core.dir/src/utils/serialization.cc.o" "gcc" "CMakeFiles/algorep_core.dir/src/utils/serialization.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/proto/append_entry.pb.cc" "/root/repo/build/proto/append_entry.pb.h"
+  "/root/repo/build/proto/command_entry.pb.cc" "/root/repo/build/proto/command_entry.pb.h"
+  "/root/repo/build/proto/election_timeout.pb.cc" "/root/repo/build/proto/election_timeout.pb.h"
+  "/root/repo/build/proto/install_snapshot.pb.cc" "/root/repo/build/proto/install_snapshot.pb.h"
+  "/root/repo/build/proto/kv_state.pb.cc" "/root/repo/build/proto/kv_state.pb.h"
+  "/root/repo/build/proto/log_entry.pb.cc" "/root/repo/build/proto/log_entry.pb.h"
+  "/root/repo/build/proto/message.pb.cc" "/root/repo/build/proto/message.pb.h"
+  "/root/repo/build/proto/message_batch.pb.cc" "/root/repo/build/proto/message_batch.pb.h"
+  "/root/repo/build/proto/persistent_state.pb.cc" "/root/repo/build/proto/persistent_state.pb.h"
+  "/root/repo/build/proto/read_index.pb.cc" "/root/repo/build/proto/read_index.pb.h"
+  "/root/repo/build/proto/search_leader.pb.cc" "/root/repo/build/proto/search_leader.pb.h"
+  "/root/repo/build/proto/snapshot.pb.cc" "/root/repo/build/proto/snapshot.pb.h"
+  "/root/repo/build/proto/speed.pb.cc" "/root/repo/build/proto/speed.pb.h"
+  "/root/repo/build/proto/transfer_leader.pb.cc" "/root/repo/build/proto/transfer_leader.pb.h"
+  "/root/repo/build/proto/vote.pb.cc" "/root/repo/build/proto/vote.pb.h"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
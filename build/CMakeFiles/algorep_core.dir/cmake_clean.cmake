@@ -0,0 +1,115 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/algorep_core.dir/proto/append_entry.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/append_entry.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/command_entry.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/command_entry.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/election_timeout.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/election_timeout.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/install_snapshot.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/install_snapshot.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/kv_state.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/kv_state.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/log_entry.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/log_entry.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/message.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/message.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/message_batch.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/message_batch.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/persistent_state.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/persistent_state.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/read_index.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/read_index.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/search_leader.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/search_leader.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/snapshot.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/snapshot.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/speed.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/speed.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/transfer_leader.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/transfer_leader.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/proto/vote.pb.cc.o"
+  "CMakeFiles/algorep_core.dir/proto/vote.pb.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/kv/kv_arena.cc.o"
+  "CMakeFiles/algorep_core.dir/src/kv/kv_arena.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/kv/kv_engine.cc.o"
+  "CMakeFiles/algorep_core.dir/src/kv/kv_engine.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/mpi/mpi_process.cc.o"
+  "CMakeFiles/algorep_core.dir/src/mpi/mpi_process.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/mpi/mpi_rpc.cc.o"
+  "CMakeFiles/algorep_core.dir/src/mpi/mpi_rpc.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/mpi/mpi_staged_rpc.cc.o"
+  "CMakeFiles/algorep_core.dir/src/mpi/mpi_staged_rpc.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_applier.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_applier.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_client.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_client.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_clock.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_clock.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_controller.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_controller.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_kv_state_machine.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_kv_state_machine.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_multi_client.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_multi_client.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_multi_server.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_multi_server.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_progress.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_progress.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_quorum.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_quorum.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_server.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_server.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_sessions.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_sessions.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_state_machine.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_state_machine.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_storage.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_storage.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_waiter.cc.o"
+  "CMakeFiles/algorep_core.dir/src/raft/raft_waiter.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/rpc/group_rpc.cc.o"
+  "CMakeFiles/algorep_core.dir/src/rpc/group_rpc.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/storage/wal.cc.o"
+  "CMakeFiles/algorep_core.dir/src/storage/wal.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/utils/arg_parser.cc.o"
+  "CMakeFiles/algorep_core.dir/src/utils/arg_parser.cc.o.d"
+  "CMakeFiles/algorep_core.dir/src/utils/serialization.cc.o"
+  "CMakeFiles/algorep_core.dir/src/utils/serialization.cc.o.d"
+  "libalgorep_core.a"
+  "libalgorep_core.pdb"
+  "proto/append_entry.pb.cc"
+  "proto/append_entry.pb.h"
+  "proto/command_entry.pb.cc"
+  "proto/command_entry.pb.h"
+  "proto/election_timeout.pb.cc"
+  "proto/election_timeout.pb.h"
+  "proto/install_snapshot.pb.cc"
+  "proto/install_snapshot.pb.h"
+  "proto/kv_state.pb.cc"
+  "proto/kv_state.pb.h"
+  "proto/log_entry.pb.cc"
+  "proto/log_entry.pb.h"
+  "proto/message.pb.cc"
+  "proto/message.pb.h"
+  "proto/message_batch.pb.cc"
+  "proto/message_batch.pb.h"
+  "proto/persistent_state.pb.cc"
+  "proto/persistent_state.pb.h"
+  "proto/read_index.pb.cc"
+  "proto/read_index.pb.h"
+  "proto/search_leader.pb.cc"
+  "proto/search_leader.pb.h"
+  "proto/snapshot.pb.cc"
+  "proto/snapshot.pb.h"
+  "proto/speed.pb.cc"
+  "proto/speed.pb.h"
+  "proto/transfer_leader.pb.cc"
+  "proto/transfer_leader.pb.h"
+  "proto/vote.pb.cc"
+  "proto/vote.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorep_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/append_entries_test.dir/tests/unit/append_entries_test.cc.o"
+  "CMakeFiles/append_entries_test.dir/tests/unit/append_entries_test.cc.o.d"
+  "CMakeFiles/append_entries_test.dir/tests/unit/unit_test.cc.o"
+  "CMakeFiles/append_entries_test.dir/tests/unit/unit_test.cc.o.d"
+  "append_entries_test"
+  "append_entries_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/append_entries_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kv_engine_test.dir/tests/unit/kv_engine_test.cc.o"
+  "CMakeFiles/kv_engine_test.dir/tests/unit/kv_engine_test.cc.o.d"
+  "CMakeFiles/kv_engine_test.dir/tests/unit/unit_test.cc.o"
+  "CMakeFiles/kv_engine_test.dir/tests/unit/unit_test.cc.o.d"
+  "kv_engine_test"
+  "kv_engine_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kv_engine_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
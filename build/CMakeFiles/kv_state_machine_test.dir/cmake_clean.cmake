@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kv_state_machine_test.dir/tests/unit/kv_state_machine_test.cc.o"
+  "CMakeFiles/kv_state_machine_test.dir/tests/unit/kv_state_machine_test.cc.o.d"
+  "CMakeFiles/kv_state_machine_test.dir/tests/unit/unit_test.cc.o"
+  "CMakeFiles/kv_state_machine_test.dir/tests/unit/unit_test.cc.o.d"
+  "kv_state_machine_test"
+  "kv_state_machine_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kv_state_machine_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
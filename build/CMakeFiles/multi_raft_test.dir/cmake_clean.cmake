@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multi_raft_test.dir/tests/unit/multi_raft_test.cc.o"
+  "CMakeFiles/multi_raft_test.dir/tests/unit/multi_raft_test.cc.o.d"
+  "CMakeFiles/multi_raft_test.dir/tests/unit/unit_test.cc.o"
+  "CMakeFiles/multi_raft_test.dir/tests/unit/unit_test.cc.o.d"
+  "multi_raft_test"
+  "multi_raft_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/multi_raft_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
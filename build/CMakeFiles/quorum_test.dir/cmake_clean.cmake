@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/quorum_test.dir/tests/unit/quorum_test.cc.o"
+  "CMakeFiles/quorum_test.dir/tests/unit/quorum_test.cc.o.d"
+  "CMakeFiles/quorum_test.dir/tests/unit/unit_test.cc.o"
+  "CMakeFiles/quorum_test.dir/tests/unit/unit_test.cc.o.d"
+  "quorum_test"
+  "quorum_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/quorum_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(wal "/root/repo/build/wal_test")
+set_tests_properties(wal PROPERTIES  WORKING_DIRECTORY "/root/repo/build/unit_tests/wal" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;142;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(append_entries "/root/repo/build/append_entries_test")
+set_tests_properties(append_entries PROPERTIES  WORKING_DIRECTORY "/root/repo/build/unit_tests/append_entries" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;142;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(quorum "/root/repo/build/quorum_test")
+set_tests_properties(quorum PROPERTIES  WORKING_DIRECTORY "/root/repo/build/unit_tests/quorum" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;142;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(sessions "/root/repo/build/sessions_test")
+set_tests_properties(sessions PROPERTIES  WORKING_DIRECTORY "/root/repo/build/unit_tests/sessions" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;142;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(kv_engine "/root/repo/build/kv_engine_test")
+set_tests_properties(kv_engine PROPERTIES  WORKING_DIRECTORY "/root/repo/build/unit_tests/kv_engine" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;142;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(kv_state_machine "/root/repo/build/kv_state_machine_test")
+set_tests_properties(kv_state_machine PROPERTIES  WORKING_DIRECTORY "/root/repo/build/unit_tests/kv_state_machine" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;142;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(multi_raft "/root/repo/build/multi_raft_test")
+set_tests_properties(multi_raft PROPERTIES  WORKING_DIRECTORY "/root/repo/build/unit_tests/multi_raft" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;142;add_test;/root/repo/CMakeLists.txt;0;")
@@ -0,0 +1,1109 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/append_entry.proto
+
+#include "proto/append_entry.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace append_entry {
+PROTOBUF_CONSTEXPR PrevLogMetadata::PrevLogMetadata(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.prev_log_index_)*/0u
+  , /*decltype(_impl_.prev_log_term_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PrevLogMetadataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrevLogMetadataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrevLogMetadataDefaultTypeInternal() {}
+  union {
+    PrevLogMetadata _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrevLogMetadataDefaultTypeInternal _PrevLogMetadata_default_instance_;
+PROTOBUF_CONSTEXPR AppendEntriesRequest::AppendEntriesRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.log_entries_)*/{}
+  , /*decltype(_impl_.prev_log_metadata_)*/nullptr
+  , /*decltype(_impl_.leader_commit_index_)*/nullptr
+  , /*decltype(_impl_.term_)*/0u
+  , /*decltype(_impl_.leader_id_)*/0u
+  , /*decltype(_impl_.read_round_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppendEntriesRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppendEntriesRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppendEntriesRequestDefaultTypeInternal() {}
+  union {
+    AppendEntriesRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppendEntriesRequestDefaultTypeInternal _AppendEntriesRequest_default_instance_;
+PROTOBUF_CONSTEXPR AppendEntriesResponse::AppendEntriesResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.conflict_term_)*/nullptr
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.match_log_size_)*/0u
+  , /*decltype(_impl_.prev_log_size_)*/0u
+  , /*decltype(_impl_.conflict_index_)*/0u
+  , /*decltype(_impl_.read_round_)*/uint64_t{0u}
+  , /*decltype(_impl_.processing_latency_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppendEntriesResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppendEntriesResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppendEntriesResponseDefaultTypeInternal() {}
+  union {
+    AppendEntriesResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppendEntriesResponseDefaultTypeInternal _AppendEntriesResponse_default_instance_;
+}  // namespace append_entry
+static ::_pb::Metadata file_level_metadata_proto_2fappend_5fentry_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_proto_2fappend_5fentry_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fappend_5fentry_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fappend_5fentry_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::append_entry::PrevLogMetadata, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::append_entry::PrevLogMetadata, _impl_.prev_log_index_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::PrevLogMetadata, _impl_.prev_log_term_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesRequest, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesRequest, _impl_.leader_id_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesRequest, _impl_.prev_log_metadata_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesRequest, _impl_.log_entries_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesRequest, _impl_.leader_commit_index_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesRequest, _impl_.read_round_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesResponse, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesResponse, _impl_.match_log_size_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesResponse, _impl_.prev_log_size_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesResponse, _impl_.conflict_term_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesResponse, _impl_.conflict_index_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesResponse, _impl_.read_round_),
+  PROTOBUF_FIELD_OFFSET(::append_entry::AppendEntriesResponse, _impl_.processing_latency_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::append_entry::PrevLogMetadata)},
+  { 8, -1, -1, sizeof(::append_entry::AppendEntriesRequest)},
+  { 20, -1, -1, sizeof(::append_entry::AppendEntriesResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::append_entry::_PrevLogMetadata_default_instance_._instance,
+  &::append_entry::_AppendEntriesRequest_default_instance_._instance,
+  &::append_entry::_AppendEntriesResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fappend_5fentry_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\030proto/append_entry.proto\022\014append_entry"
+  "\032\036google/protobuf/wrappers.proto\032\025proto/"
+  "log_entry.proto\"@\n\017PrevLogMetadata\022\026\n\016pr"
+  "ev_log_index\030\001 \001(\r\022\025\n\rprev_log_term\030\002 \001("
+  "\r\"\352\001\n\024AppendEntriesRequest\022\014\n\004term\030\001 \001(\r"
+  "\022\021\n\tleader_id\030\002 \001(\r\0228\n\021prev_log_metadata"
+  "\030\003 \001(\0132\035.append_entry.PrevLogMetadata\022(\n"
+  "\013log_entries\030\005 \003(\0132\023.log_entry.LogEntry\022"
+  "9\n\023leader_commit_index\030\006 \001(\0132\034.google.pr"
+  "otobuf.UInt32Value\022\022\n\nread_round\030\007 \001(\004\"\332"
+  "\001\n\025AppendEntriesResponse\022\017\n\007success\030\001 \001("
+  "\010\022\026\n\016match_log_size\030\003 \001(\r\022\025\n\rprev_log_si"
+  "ze\030\004 \001(\r\0223\n\rconflict_term\030\005 \001(\0132\034.google"
+  ".protobuf.UInt32Value\022\026\n\016conflict_index\030"
+  "\006 \001(\r\022\022\n\nread_round\030\007 \001(\004\022\032\n\022processing_"
+  "latency\030\010 \001(\rJ\004\010\002\020\003b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_proto_2fappend_5fentry_2eproto_deps[2] = {
+  &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
+  &::descriptor_table_proto_2flog_5fentry_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_proto_2fappend_5fentry_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fappend_5fentry_2eproto = {
+    false, false, 627, descriptor_table_protodef_proto_2fappend_5fentry_2eproto,
+    "proto/append_entry.proto",
+    &descriptor_table_proto_2fappend_5fentry_2eproto_once, descriptor_table_proto_2fappend_5fentry_2eproto_deps, 2, 3,
+    schemas, file_default_instances, TableStruct_proto_2fappend_5fentry_2eproto::offsets,
+    file_level_metadata_proto_2fappend_5fentry_2eproto, file_level_enum_descriptors_proto_2fappend_5fentry_2eproto,
+    file_level_service_descriptors_proto_2fappend_5fentry_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fappend_5fentry_2eproto_getter() {
+  return &descriptor_table_proto_2fappend_5fentry_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fappend_5fentry_2eproto(&descriptor_table_proto_2fappend_5fentry_2eproto);
+namespace append_entry {
+
+// ===================================================================
+
+class PrevLogMetadata::_Internal {
+ public:
+};
+
+PrevLogMetadata::PrevLogMetadata(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:append_entry.PrevLogMetadata)
+}
+PrevLogMetadata::PrevLogMetadata(const PrevLogMetadata& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrevLogMetadata* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prev_log_index_){}
+    , decltype(_impl_.prev_log_term_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.prev_log_index_, &from._impl_.prev_log_index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.prev_log_term_) -
+    reinterpret_cast<char*>(&_impl_.prev_log_index_)) + sizeof(_impl_.prev_log_term_));
+  // @@protoc_insertion_point(copy_constructor:append_entry.PrevLogMetadata)
+}
+
+inline void PrevLogMetadata::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prev_log_index_){0u}
+    , decltype(_impl_.prev_log_term_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PrevLogMetadata::~PrevLogMetadata() {
+  // @@protoc_insertion_point(destructor:append_entry.PrevLogMetadata)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrevLogMetadata::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PrevLogMetadata::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrevLogMetadata::Clear() {
+// @@protoc_insertion_point(message_clear_start:append_entry.PrevLogMetadata)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.prev_log_index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.prev_log_term_) -
+      reinterpret_cast<char*>(&_impl_.prev_log_index_)) + sizeof(_impl_.prev_log_term_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrevLogMetadata::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 prev_log_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.prev_log_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 prev_log_term = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.prev_log_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrevLogMetadata::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:append_entry.PrevLogMetadata)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 prev_log_index = 1;
+  if (this->_internal_prev_log_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_prev_log_index(), target);
+  }
+
+  // uint32 prev_log_term = 2;
+  if (this->_internal_prev_log_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_prev_log_term(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:append_entry.PrevLogMetadata)
+  return target;
+}
+
+size_t PrevLogMetadata::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:append_entry.PrevLogMetadata)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 prev_log_index = 1;
+  if (this->_internal_prev_log_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_prev_log_index());
+  }
+
+  // uint32 prev_log_term = 2;
+  if (this->_internal_prev_log_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_prev_log_term());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrevLogMetadata::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrevLogMetadata::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrevLogMetadata::GetClassData() const { return &_class_data_; }
+
+
+void PrevLogMetadata::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrevLogMetadata*>(&to_msg);
+  auto& from = static_cast<const PrevLogMetadata&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:append_entry.PrevLogMetadata)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_prev_log_index() != 0) {
+    _this->_internal_set_prev_log_index(from._internal_prev_log_index());
+  }
+  if (from._internal_prev_log_term() != 0) {
+    _this->_internal_set_prev_log_term(from._internal_prev_log_term());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrevLogMetadata::CopyFrom(const PrevLogMetadata& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:append_entry.PrevLogMetadata)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrevLogMetadata::IsInitialized() const {
+  return true;
+}
+
+void PrevLogMetadata::InternalSwap(PrevLogMetadata* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrevLogMetadata, _impl_.prev_log_term_)
+      + sizeof(PrevLogMetadata::_impl_.prev_log_term_)
+      - PROTOBUF_FIELD_OFFSET(PrevLogMetadata, _impl_.prev_log_index_)>(
+          reinterpret_cast<char*>(&_impl_.prev_log_index_),
+          reinterpret_cast<char*>(&other->_impl_.prev_log_index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrevLogMetadata::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fappend_5fentry_2eproto_getter, &descriptor_table_proto_2fappend_5fentry_2eproto_once,
+      file_level_metadata_proto_2fappend_5fentry_2eproto[0]);
+}
+
+// ===================================================================
+
+class AppendEntriesRequest::_Internal {
+ public:
+  static const ::append_entry::PrevLogMetadata& prev_log_metadata(const AppendEntriesRequest* msg);
+  static const ::PROTOBUF_NAMESPACE_ID::UInt32Value& leader_commit_index(const AppendEntriesRequest* msg);
+};
+
+const ::append_entry::PrevLogMetadata&
+AppendEntriesRequest::_Internal::prev_log_metadata(const AppendEntriesRequest* msg) {
+  return *msg->_impl_.prev_log_metadata_;
+}
+const ::PROTOBUF_NAMESPACE_ID::UInt32Value&
+AppendEntriesRequest::_Internal::leader_commit_index(const AppendEntriesRequest* msg) {
+  return *msg->_impl_.leader_commit_index_;
+}
+void AppendEntriesRequest::clear_log_entries() {
+  _impl_.log_entries_.Clear();
+}
+void AppendEntriesRequest::clear_leader_commit_index() {
+  if (GetArenaForAllocation() == nullptr && _impl_.leader_commit_index_ != nullptr) {
+    delete _impl_.leader_commit_index_;
+  }
+  _impl_.leader_commit_index_ = nullptr;
+}
+AppendEntriesRequest::AppendEntriesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:append_entry.AppendEntriesRequest)
+}
+AppendEntriesRequest::AppendEntriesRequest(const AppendEntriesRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppendEntriesRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.log_entries_){from._impl_.log_entries_}
+    , decltype(_impl_.prev_log_metadata_){nullptr}
+    , decltype(_impl_.leader_commit_index_){nullptr}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.leader_id_){}
+    , decltype(_impl_.read_round_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_prev_log_metadata()) {
+    _this->_impl_.prev_log_metadata_ = new ::append_entry::PrevLogMetadata(*from._impl_.prev_log_metadata_);
+  }
+  if (from._internal_has_leader_commit_index()) {
+    _this->_impl_.leader_commit_index_ = new ::PROTOBUF_NAMESPACE_ID::UInt32Value(*from._impl_.leader_commit_index_);
+  }
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.read_round_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.read_round_));
+  // @@protoc_insertion_point(copy_constructor:append_entry.AppendEntriesRequest)
+}
+
+inline void AppendEntriesRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.log_entries_){arena}
+    , decltype(_impl_.prev_log_metadata_){nullptr}
+    , decltype(_impl_.leader_commit_index_){nullptr}
+    , decltype(_impl_.term_){0u}
+    , decltype(_impl_.leader_id_){0u}
+    , decltype(_impl_.read_round_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+AppendEntriesRequest::~AppendEntriesRequest() {
+  // @@protoc_insertion_point(destructor:append_entry.AppendEntriesRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AppendEntriesRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.log_entries_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.prev_log_metadata_;
+  if (this != internal_default_instance()) delete _impl_.leader_commit_index_;
+}
+
+void AppendEntriesRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AppendEntriesRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:append_entry.AppendEntriesRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.log_entries_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.prev_log_metadata_ != nullptr) {
+    delete _impl_.prev_log_metadata_;
+  }
+  _impl_.prev_log_metadata_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.leader_commit_index_ != nullptr) {
+    delete _impl_.leader_commit_index_;
+  }
+  _impl_.leader_commit_index_ = nullptr;
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.read_round_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.read_round_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppendEntriesRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 leader_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leader_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .append_entry.PrevLogMetadata prev_log_metadata = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prev_log_metadata(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .log_entry.LogEntry log_entries = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_log_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value leader_commit_index = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_leader_commit_index(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 read_round = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.read_round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AppendEntriesRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:append_entry.AppendEntriesRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // uint32 leader_id = 2;
+  if (this->_internal_leader_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_leader_id(), target);
+  }
+
+  // .append_entry.PrevLogMetadata prev_log_metadata = 3;
+  if (this->_internal_has_prev_log_metadata()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::prev_log_metadata(this),
+        _Internal::prev_log_metadata(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .log_entry.LogEntry log_entries = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_log_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_log_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.UInt32Value leader_commit_index = 6;
+  if (this->_internal_has_leader_commit_index()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::leader_commit_index(this),
+        _Internal::leader_commit_index(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 read_round = 7;
+  if (this->_internal_read_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_read_round(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:append_entry.AppendEntriesRequest)
+  return target;
+}
+
+size_t AppendEntriesRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:append_entry.AppendEntriesRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .log_entry.LogEntry log_entries = 5;
+  total_size += 1UL * this->_internal_log_entries_size();
+  for (const auto& msg : this->_impl_.log_entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .append_entry.PrevLogMetadata prev_log_metadata = 3;
+  if (this->_internal_has_prev_log_metadata()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.prev_log_metadata_);
+  }
+
+  // .google.protobuf.UInt32Value leader_commit_index = 6;
+  if (this->_internal_has_leader_commit_index()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.leader_commit_index_);
+  }
+
+  // uint32 term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+  }
+
+  // uint32 leader_id = 2;
+  if (this->_internal_leader_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_leader_id());
+  }
+
+  // uint64 read_round = 7;
+  if (this->_internal_read_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_read_round());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppendEntriesRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppendEntriesRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppendEntriesRequest::GetClassData() const { return &_class_data_; }
+
+
+void AppendEntriesRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppendEntriesRequest*>(&to_msg);
+  auto& from = static_cast<const AppendEntriesRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:append_entry.AppendEntriesRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.log_entries_.MergeFrom(from._impl_.log_entries_);
+  if (from._internal_has_prev_log_metadata()) {
+    _this->_internal_mutable_prev_log_metadata()->::append_entry::PrevLogMetadata::MergeFrom(
+        from._internal_prev_log_metadata());
+  }
+  if (from._internal_has_leader_commit_index()) {
+    _this->_internal_mutable_leader_commit_index()->::PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(
+        from._internal_leader_commit_index());
+  }
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_leader_id() != 0) {
+    _this->_internal_set_leader_id(from._internal_leader_id());
+  }
+  if (from._internal_read_round() != 0) {
+    _this->_internal_set_read_round(from._internal_read_round());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AppendEntriesRequest::CopyFrom(const AppendEntriesRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:append_entry.AppendEntriesRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppendEntriesRequest::IsInitialized() const {
+  return true;
+}
+
+void AppendEntriesRequest::InternalSwap(AppendEntriesRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.log_entries_.InternalSwap(&other->_impl_.log_entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AppendEntriesRequest, _impl_.read_round_)
+      + sizeof(AppendEntriesRequest::_impl_.read_round_)
+      - PROTOBUF_FIELD_OFFSET(AppendEntriesRequest, _impl_.prev_log_metadata_)>(
+          reinterpret_cast<char*>(&_impl_.prev_log_metadata_),
+          reinterpret_cast<char*>(&other->_impl_.prev_log_metadata_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fappend_5fentry_2eproto_getter, &descriptor_table_proto_2fappend_5fentry_2eproto_once,
+      file_level_metadata_proto_2fappend_5fentry_2eproto[1]);
+}
+
+// ===================================================================
+
+class AppendEntriesResponse::_Internal {
+ public:
+  static const ::PROTOBUF_NAMESPACE_ID::UInt32Value& conflict_term(const AppendEntriesResponse* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::UInt32Value&
+AppendEntriesResponse::_Internal::conflict_term(const AppendEntriesResponse* msg) {
+  return *msg->_impl_.conflict_term_;
+}
+void AppendEntriesResponse::clear_conflict_term() {
+  if (GetArenaForAllocation() == nullptr && _impl_.conflict_term_ != nullptr) {
+    delete _impl_.conflict_term_;
+  }
+  _impl_.conflict_term_ = nullptr;
+}
+AppendEntriesResponse::AppendEntriesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:append_entry.AppendEntriesResponse)
+}
+AppendEntriesResponse::AppendEntriesResponse(const AppendEntriesResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppendEntriesResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.conflict_term_){nullptr}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.match_log_size_){}
+    , decltype(_impl_.prev_log_size_){}
+    , decltype(_impl_.conflict_index_){}
+    , decltype(_impl_.read_round_){}
+    , decltype(_impl_.processing_latency_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_conflict_term()) {
+    _this->_impl_.conflict_term_ = new ::PROTOBUF_NAMESPACE_ID::UInt32Value(*from._impl_.conflict_term_);
+  }
+  ::memcpy(&_impl_.success_, &from._impl_.success_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.processing_latency_) -
+    reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.processing_latency_));
+  // @@protoc_insertion_point(copy_constructor:append_entry.AppendEntriesResponse)
+}
+
+inline void AppendEntriesResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.conflict_term_){nullptr}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.match_log_size_){0u}
+    , decltype(_impl_.prev_log_size_){0u}
+    , decltype(_impl_.conflict_index_){0u}
+    , decltype(_impl_.read_round_){uint64_t{0u}}
+    , decltype(_impl_.processing_latency_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+AppendEntriesResponse::~AppendEntriesResponse() {
+  // @@protoc_insertion_point(destructor:append_entry.AppendEntriesResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AppendEntriesResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.conflict_term_;
+}
+
+void AppendEntriesResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AppendEntriesResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:append_entry.AppendEntriesResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.conflict_term_ != nullptr) {
+    delete _impl_.conflict_term_;
+  }
+  _impl_.conflict_term_ = nullptr;
+  ::memset(&_impl_.success_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.processing_latency_) -
+      reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.processing_latency_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppendEntriesResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 match_log_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.match_log_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 prev_log_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.prev_log_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value conflict_term = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_conflict_term(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 conflict_index = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.conflict_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 read_round = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.read_round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 processing_latency = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.processing_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AppendEntriesResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:append_entry.AppendEntriesResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
+  }
+
+  // uint32 match_log_size = 3;
+  if (this->_internal_match_log_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_match_log_size(), target);
+  }
+
+  // uint32 prev_log_size = 4;
+  if (this->_internal_prev_log_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_prev_log_size(), target);
+  }
+
+  // .google.protobuf.UInt32Value conflict_term = 5;
+  if (this->_internal_has_conflict_term()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::conflict_term(this),
+        _Internal::conflict_term(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 conflict_index = 6;
+  if (this->_internal_conflict_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_conflict_index(), target);
+  }
+
+  // uint64 read_round = 7;
+  if (this->_internal_read_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_read_round(), target);
+  }
+
+  // uint32 processing_latency = 8;
+  if (this->_internal_processing_latency() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_processing_latency(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:append_entry.AppendEntriesResponse)
+  return target;
+}
+
+size_t AppendEntriesResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:append_entry.AppendEntriesResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.UInt32Value conflict_term = 5;
+  if (this->_internal_has_conflict_term()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.conflict_term_);
+  }
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 match_log_size = 3;
+  if (this->_internal_match_log_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_match_log_size());
+  }
+
+  // uint32 prev_log_size = 4;
+  if (this->_internal_prev_log_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_prev_log_size());
+  }
+
+  // uint32 conflict_index = 6;
+  if (this->_internal_conflict_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_conflict_index());
+  }
+
+  // uint64 read_round = 7;
+  if (this->_internal_read_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_read_round());
+  }
+
+  // uint32 processing_latency = 8;
+  if (this->_internal_processing_latency() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_processing_latency());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppendEntriesResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppendEntriesResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppendEntriesResponse::GetClassData() const { return &_class_data_; }
+
+
+void AppendEntriesResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppendEntriesResponse*>(&to_msg);
+  auto& from = static_cast<const AppendEntriesResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:append_entry.AppendEntriesResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_conflict_term()) {
+    _this->_internal_mutable_conflict_term()->::PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(
+        from._internal_conflict_term());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_match_log_size() != 0) {
+    _this->_internal_set_match_log_size(from._internal_match_log_size());
+  }
+  if (from._internal_prev_log_size() != 0) {
+    _this->_internal_set_prev_log_size(from._internal_prev_log_size());
+  }
+  if (from._internal_conflict_index() != 0) {
+    _this->_internal_set_conflict_index(from._internal_conflict_index());
+  }
+  if (from._internal_read_round() != 0) {
+    _this->_internal_set_read_round(from._internal_read_round());
+  }
+  if (from._internal_processing_latency() != 0) {
+    _this->_internal_set_processing_latency(from._internal_processing_latency());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AppendEntriesResponse::CopyFrom(const AppendEntriesResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:append_entry.AppendEntriesResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppendEntriesResponse::IsInitialized() const {
+  return true;
+}
+
+void AppendEntriesResponse::InternalSwap(AppendEntriesResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AppendEntriesResponse, _impl_.processing_latency_)
+      + sizeof(AppendEntriesResponse::_impl_.processing_latency_)
+      - PROTOBUF_FIELD_OFFSET(AppendEntriesResponse, _impl_.conflict_term_)>(
+          reinterpret_cast<char*>(&_impl_.conflict_term_),
+          reinterpret_cast<char*>(&other->_impl_.conflict_term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fappend_5fentry_2eproto_getter, &descriptor_table_proto_2fappend_5fentry_2eproto_once,
+      file_level_metadata_proto_2fappend_5fentry_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace append_entry
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::append_entry::PrevLogMetadata*
+Arena::CreateMaybeMessage< ::append_entry::PrevLogMetadata >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::append_entry::PrevLogMetadata >(arena);
+}
+template<> PROTOBUF_NOINLINE ::append_entry::AppendEntriesRequest*
+Arena::CreateMaybeMessage< ::append_entry::AppendEntriesRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::append_entry::AppendEntriesRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::append_entry::AppendEntriesResponse*
+Arena::CreateMaybeMessage< ::append_entry::AppendEntriesResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::append_entry::AppendEntriesResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
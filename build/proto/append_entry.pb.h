@@ -0,0 +1,1230 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/append_entry.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fappend_5fentry_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fappend_5fentry_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/wrappers.pb.h>
+#include "proto/log_entry.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fappend_5fentry_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fappend_5fentry_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fappend_5fentry_2eproto;
+namespace append_entry {
+class AppendEntriesRequest;
+struct AppendEntriesRequestDefaultTypeInternal;
+extern AppendEntriesRequestDefaultTypeInternal _AppendEntriesRequest_default_instance_;
+class AppendEntriesResponse;
+struct AppendEntriesResponseDefaultTypeInternal;
+extern AppendEntriesResponseDefaultTypeInternal _AppendEntriesResponse_default_instance_;
+class PrevLogMetadata;
+struct PrevLogMetadataDefaultTypeInternal;
+extern PrevLogMetadataDefaultTypeInternal _PrevLogMetadata_default_instance_;
+}  // namespace append_entry
+PROTOBUF_NAMESPACE_OPEN
+template<> ::append_entry::AppendEntriesRequest* Arena::CreateMaybeMessage<::append_entry::AppendEntriesRequest>(Arena*);
+template<> ::append_entry::AppendEntriesResponse* Arena::CreateMaybeMessage<::append_entry::AppendEntriesResponse>(Arena*);
+template<> ::append_entry::PrevLogMetadata* Arena::CreateMaybeMessage<::append_entry::PrevLogMetadata>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace append_entry {
+
+// ===================================================================
+
+class PrevLogMetadata final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:append_entry.PrevLogMetadata) */ {
+ public:
+  inline PrevLogMetadata() : PrevLogMetadata(nullptr) {}
+  ~PrevLogMetadata() override;
+  explicit PROTOBUF_CONSTEXPR PrevLogMetadata(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrevLogMetadata(const PrevLogMetadata& from);
+  PrevLogMetadata(PrevLogMetadata&& from) noexcept
+    : PrevLogMetadata() {
+    *this = ::std::move(from);
+  }
+
+  inline PrevLogMetadata& operator=(const PrevLogMetadata& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrevLogMetadata& operator=(PrevLogMetadata&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrevLogMetadata& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrevLogMetadata* internal_default_instance() {
+    return reinterpret_cast<const PrevLogMetadata*>(
+               &_PrevLogMetadata_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PrevLogMetadata& a, PrevLogMetadata& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrevLogMetadata* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrevLogMetadata* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrevLogMetadata* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrevLogMetadata>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrevLogMetadata& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrevLogMetadata& from) {
+    PrevLogMetadata::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrevLogMetadata* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "append_entry.PrevLogMetadata";
+  }
+  protected:
+  explicit PrevLogMetadata(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrevLogIndexFieldNumber = 1,
+    kPrevLogTermFieldNumber = 2,
+  };
+  // uint32 prev_log_index = 1;
+  void clear_prev_log_index();
+  uint32_t prev_log_index() const;
+  void set_prev_log_index(uint32_t value);
+  private:
+  uint32_t _internal_prev_log_index() const;
+  void _internal_set_prev_log_index(uint32_t value);
+  public:
+
+  // uint32 prev_log_term = 2;
+  void clear_prev_log_term();
+  uint32_t prev_log_term() const;
+  void set_prev_log_term(uint32_t value);
+  private:
+  uint32_t _internal_prev_log_term() const;
+  void _internal_set_prev_log_term(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:append_entry.PrevLogMetadata)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t prev_log_index_;
+    uint32_t prev_log_term_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fappend_5fentry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AppendEntriesRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:append_entry.AppendEntriesRequest) */ {
+ public:
+  inline AppendEntriesRequest() : AppendEntriesRequest(nullptr) {}
+  ~AppendEntriesRequest() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AppendEntriesRequest(const AppendEntriesRequest& from);
+  AppendEntriesRequest(AppendEntriesRequest&& from) noexcept
+    : AppendEntriesRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline AppendEntriesRequest& operator=(const AppendEntriesRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppendEntriesRequest& operator=(AppendEntriesRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendEntriesRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AppendEntriesRequest* internal_default_instance() {
+    return reinterpret_cast<const AppendEntriesRequest*>(
+               &_AppendEntriesRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(AppendEntriesRequest& a, AppendEntriesRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppendEntriesRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppendEntriesRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AppendEntriesRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AppendEntriesRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AppendEntriesRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesRequest& from) {
+    AppendEntriesRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppendEntriesRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "append_entry.AppendEntriesRequest";
+  }
+  protected:
+  explicit AppendEntriesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLogEntriesFieldNumber = 5,
+    kPrevLogMetadataFieldNumber = 3,
+    kLeaderCommitIndexFieldNumber = 6,
+    kTermFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+    kReadRoundFieldNumber = 7,
+  };
+  // repeated .log_entry.LogEntry log_entries = 5;
+  int log_entries_size() const;
+  private:
+  int _internal_log_entries_size() const;
+  public:
+  void clear_log_entries();
+  ::log_entry::LogEntry* mutable_log_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::log_entry::LogEntry >*
+      mutable_log_entries();
+  private:
+  const ::log_entry::LogEntry& _internal_log_entries(int index) const;
+  ::log_entry::LogEntry* _internal_add_log_entries();
+  public:
+  const ::log_entry::LogEntry& log_entries(int index) const;
+  ::log_entry::LogEntry* add_log_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::log_entry::LogEntry >&
+      log_entries() const;
+
+  // .append_entry.PrevLogMetadata prev_log_metadata = 3;
+  bool has_prev_log_metadata() const;
+  private:
+  bool _internal_has_prev_log_metadata() const;
+  public:
+  void clear_prev_log_metadata();
+  const ::append_entry::PrevLogMetadata& prev_log_metadata() const;
+  PROTOBUF_NODISCARD ::append_entry::PrevLogMetadata* release_prev_log_metadata();
+  ::append_entry::PrevLogMetadata* mutable_prev_log_metadata();
+  void set_allocated_prev_log_metadata(::append_entry::PrevLogMetadata* prev_log_metadata);
+  private:
+  const ::append_entry::PrevLogMetadata& _internal_prev_log_metadata() const;
+  ::append_entry::PrevLogMetadata* _internal_mutable_prev_log_metadata();
+  public:
+  void unsafe_arena_set_allocated_prev_log_metadata(
+      ::append_entry::PrevLogMetadata* prev_log_metadata);
+  ::append_entry::PrevLogMetadata* unsafe_arena_release_prev_log_metadata();
+
+  // .google.protobuf.UInt32Value leader_commit_index = 6;
+  bool has_leader_commit_index() const;
+  private:
+  bool _internal_has_leader_commit_index() const;
+  public:
+  void clear_leader_commit_index();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& leader_commit_index() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::UInt32Value* release_leader_commit_index();
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_leader_commit_index();
+  void set_allocated_leader_commit_index(::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_commit_index);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_leader_commit_index() const;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_leader_commit_index();
+  public:
+  void unsafe_arena_set_allocated_leader_commit_index(
+      ::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_commit_index);
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* unsafe_arena_release_leader_commit_index();
+
+  // uint32 term = 1;
+  void clear_term();
+  uint32_t term() const;
+  void set_term(uint32_t value);
+  private:
+  uint32_t _internal_term() const;
+  void _internal_set_term(uint32_t value);
+  public:
+
+  // uint32 leader_id = 2;
+  void clear_leader_id();
+  uint32_t leader_id() const;
+  void set_leader_id(uint32_t value);
+  private:
+  uint32_t _internal_leader_id() const;
+  void _internal_set_leader_id(uint32_t value);
+  public:
+
+  // uint64 read_round = 7;
+  void clear_read_round();
+  uint64_t read_round() const;
+  void set_read_round(uint64_t value);
+  private:
+  uint64_t _internal_read_round() const;
+  void _internal_set_read_round(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:append_entry.AppendEntriesRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::log_entry::LogEntry > log_entries_;
+    ::append_entry::PrevLogMetadata* prev_log_metadata_;
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_commit_index_;
+    uint32_t term_;
+    uint32_t leader_id_;
+    uint64_t read_round_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fappend_5fentry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AppendEntriesResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:append_entry.AppendEntriesResponse) */ {
+ public:
+  inline AppendEntriesResponse() : AppendEntriesResponse(nullptr) {}
+  ~AppendEntriesResponse() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AppendEntriesResponse(const AppendEntriesResponse& from);
+  AppendEntriesResponse(AppendEntriesResponse&& from) noexcept
+    : AppendEntriesResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline AppendEntriesResponse& operator=(const AppendEntriesResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppendEntriesResponse& operator=(AppendEntriesResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendEntriesResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AppendEntriesResponse* internal_default_instance() {
+    return reinterpret_cast<const AppendEntriesResponse*>(
+               &_AppendEntriesResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(AppendEntriesResponse& a, AppendEntriesResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppendEntriesResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppendEntriesResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AppendEntriesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AppendEntriesResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AppendEntriesResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesResponse& from) {
+    AppendEntriesResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppendEntriesResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "append_entry.AppendEntriesResponse";
+  }
+  protected:
+  explicit AppendEntriesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConflictTermFieldNumber = 5,
+    kSuccessFieldNumber = 1,
+    kMatchLogSizeFieldNumber = 3,
+    kPrevLogSizeFieldNumber = 4,
+    kConflictIndexFieldNumber = 6,
+    kReadRoundFieldNumber = 7,
+    kProcessingLatencyFieldNumber = 8,
+  };
+  // .google.protobuf.UInt32Value conflict_term = 5;
+  bool has_conflict_term() const;
+  private:
+  bool _internal_has_conflict_term() const;
+  public:
+  void clear_conflict_term();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& conflict_term() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::UInt32Value* release_conflict_term();
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_conflict_term();
+  void set_allocated_conflict_term(::PROTOBUF_NAMESPACE_ID::UInt32Value* conflict_term);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_conflict_term() const;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_conflict_term();
+  public:
+  void unsafe_arena_set_allocated_conflict_term(
+      ::PROTOBUF_NAMESPACE_ID::UInt32Value* conflict_term);
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* unsafe_arena_release_conflict_term();
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // uint32 match_log_size = 3;
+  void clear_match_log_size();
+  uint32_t match_log_size() const;
+  void set_match_log_size(uint32_t value);
+  private:
+  uint32_t _internal_match_log_size() const;
+  void _internal_set_match_log_size(uint32_t value);
+  public:
+
+  // uint32 prev_log_size = 4;
+  void clear_prev_log_size();
+  uint32_t prev_log_size() const;
+  void set_prev_log_size(uint32_t value);
+  private:
+  uint32_t _internal_prev_log_size() const;
+  void _internal_set_prev_log_size(uint32_t value);
+  public:
+
+  // uint32 conflict_index = 6;
+  void clear_conflict_index();
+  uint32_t conflict_index() const;
+  void set_conflict_index(uint32_t value);
+  private:
+  uint32_t _internal_conflict_index() const;
+  void _internal_set_conflict_index(uint32_t value);
+  public:
+
+  // uint64 read_round = 7;
+  void clear_read_round();
+  uint64_t read_round() const;
+  void set_read_round(uint64_t value);
+  private:
+  uint64_t _internal_read_round() const;
+  void _internal_set_read_round(uint64_t value);
+  public:
+
+  // uint32 processing_latency = 8;
+  void clear_processing_latency();
+  uint32_t processing_latency() const;
+  void set_processing_latency(uint32_t value);
+  private:
+  uint32_t _internal_processing_latency() const;
+  void _internal_set_processing_latency(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:append_entry.AppendEntriesResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* conflict_term_;
+    bool success_;
+    uint32_t match_log_size_;
+    uint32_t prev_log_size_;
+    uint32_t conflict_index_;
+    uint64_t read_round_;
+    uint32_t processing_latency_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fappend_5fentry_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PrevLogMetadata
+
+// uint32 prev_log_index = 1;
+inline void PrevLogMetadata::clear_prev_log_index() {
+  _impl_.prev_log_index_ = 0u;
+}
+inline uint32_t PrevLogMetadata::_internal_prev_log_index() const {
+  return _impl_.prev_log_index_;
+}
+inline uint32_t PrevLogMetadata::prev_log_index() const {
+  // @@protoc_insertion_point(field_get:append_entry.PrevLogMetadata.prev_log_index)
+  return _internal_prev_log_index();
+}
+inline void PrevLogMetadata::_internal_set_prev_log_index(uint32_t value) {
+  
+  _impl_.prev_log_index_ = value;
+}
+inline void PrevLogMetadata::set_prev_log_index(uint32_t value) {
+  _internal_set_prev_log_index(value);
+  // @@protoc_insertion_point(field_set:append_entry.PrevLogMetadata.prev_log_index)
+}
+
+// uint32 prev_log_term = 2;
+inline void PrevLogMetadata::clear_prev_log_term() {
+  _impl_.prev_log_term_ = 0u;
+}
+inline uint32_t PrevLogMetadata::_internal_prev_log_term() const {
+  return _impl_.prev_log_term_;
+}
+inline uint32_t PrevLogMetadata::prev_log_term() const {
+  // @@protoc_insertion_point(field_get:append_entry.PrevLogMetadata.prev_log_term)
+  return _internal_prev_log_term();
+}
+inline void PrevLogMetadata::_internal_set_prev_log_term(uint32_t value) {
+  
+  _impl_.prev_log_term_ = value;
+}
+inline void PrevLogMetadata::set_prev_log_term(uint32_t value) {
+  _internal_set_prev_log_term(value);
+  // @@protoc_insertion_point(field_set:append_entry.PrevLogMetadata.prev_log_term)
+}
+
+// -------------------------------------------------------------------
+
+// AppendEntriesRequest
+
+// uint32 term = 1;
+inline void AppendEntriesRequest::clear_term() {
+  _impl_.term_ = 0u;
+}
+inline uint32_t AppendEntriesRequest::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint32_t AppendEntriesRequest::term() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesRequest.term)
+  return _internal_term();
+}
+inline void AppendEntriesRequest::_internal_set_term(uint32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void AppendEntriesRequest::set_term(uint32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:append_entry.AppendEntriesRequest.term)
+}
+
+// uint32 leader_id = 2;
+inline void AppendEntriesRequest::clear_leader_id() {
+  _impl_.leader_id_ = 0u;
+}
+inline uint32_t AppendEntriesRequest::_internal_leader_id() const {
+  return _impl_.leader_id_;
+}
+inline uint32_t AppendEntriesRequest::leader_id() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesRequest.leader_id)
+  return _internal_leader_id();
+}
+inline void AppendEntriesRequest::_internal_set_leader_id(uint32_t value) {
+  
+  _impl_.leader_id_ = value;
+}
+inline void AppendEntriesRequest::set_leader_id(uint32_t value) {
+  _internal_set_leader_id(value);
+  // @@protoc_insertion_point(field_set:append_entry.AppendEntriesRequest.leader_id)
+}
+
+// .append_entry.PrevLogMetadata prev_log_metadata = 3;
+inline bool AppendEntriesRequest::_internal_has_prev_log_metadata() const {
+  return this != internal_default_instance() && _impl_.prev_log_metadata_ != nullptr;
+}
+inline bool AppendEntriesRequest::has_prev_log_metadata() const {
+  return _internal_has_prev_log_metadata();
+}
+inline void AppendEntriesRequest::clear_prev_log_metadata() {
+  if (GetArenaForAllocation() == nullptr && _impl_.prev_log_metadata_ != nullptr) {
+    delete _impl_.prev_log_metadata_;
+  }
+  _impl_.prev_log_metadata_ = nullptr;
+}
+inline const ::append_entry::PrevLogMetadata& AppendEntriesRequest::_internal_prev_log_metadata() const {
+  const ::append_entry::PrevLogMetadata* p = _impl_.prev_log_metadata_;
+  return p != nullptr ? *p : reinterpret_cast<const ::append_entry::PrevLogMetadata&>(
+      ::append_entry::_PrevLogMetadata_default_instance_);
+}
+inline const ::append_entry::PrevLogMetadata& AppendEntriesRequest::prev_log_metadata() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesRequest.prev_log_metadata)
+  return _internal_prev_log_metadata();
+}
+inline void AppendEntriesRequest::unsafe_arena_set_allocated_prev_log_metadata(
+    ::append_entry::PrevLogMetadata* prev_log_metadata) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.prev_log_metadata_);
+  }
+  _impl_.prev_log_metadata_ = prev_log_metadata;
+  if (prev_log_metadata) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:append_entry.AppendEntriesRequest.prev_log_metadata)
+}
+inline ::append_entry::PrevLogMetadata* AppendEntriesRequest::release_prev_log_metadata() {
+  
+  ::append_entry::PrevLogMetadata* temp = _impl_.prev_log_metadata_;
+  _impl_.prev_log_metadata_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::append_entry::PrevLogMetadata* AppendEntriesRequest::unsafe_arena_release_prev_log_metadata() {
+  // @@protoc_insertion_point(field_release:append_entry.AppendEntriesRequest.prev_log_metadata)
+  
+  ::append_entry::PrevLogMetadata* temp = _impl_.prev_log_metadata_;
+  _impl_.prev_log_metadata_ = nullptr;
+  return temp;
+}
+inline ::append_entry::PrevLogMetadata* AppendEntriesRequest::_internal_mutable_prev_log_metadata() {
+  
+  if (_impl_.prev_log_metadata_ == nullptr) {
+    auto* p = CreateMaybeMessage<::append_entry::PrevLogMetadata>(GetArenaForAllocation());
+    _impl_.prev_log_metadata_ = p;
+  }
+  return _impl_.prev_log_metadata_;
+}
+inline ::append_entry::PrevLogMetadata* AppendEntriesRequest::mutable_prev_log_metadata() {
+  ::append_entry::PrevLogMetadata* _msg = _internal_mutable_prev_log_metadata();
+  // @@protoc_insertion_point(field_mutable:append_entry.AppendEntriesRequest.prev_log_metadata)
+  return _msg;
+}
+inline void AppendEntriesRequest::set_allocated_prev_log_metadata(::append_entry::PrevLogMetadata* prev_log_metadata) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.prev_log_metadata_;
+  }
+  if (prev_log_metadata) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prev_log_metadata);
+    if (message_arena != submessage_arena) {
+      prev_log_metadata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prev_log_metadata, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.prev_log_metadata_ = prev_log_metadata;
+  // @@protoc_insertion_point(field_set_allocated:append_entry.AppendEntriesRequest.prev_log_metadata)
+}
+
+// repeated .log_entry.LogEntry log_entries = 5;
+inline int AppendEntriesRequest::_internal_log_entries_size() const {
+  return _impl_.log_entries_.size();
+}
+inline int AppendEntriesRequest::log_entries_size() const {
+  return _internal_log_entries_size();
+}
+inline ::log_entry::LogEntry* AppendEntriesRequest::mutable_log_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:append_entry.AppendEntriesRequest.log_entries)
+  return _impl_.log_entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::log_entry::LogEntry >*
+AppendEntriesRequest::mutable_log_entries() {
+  // @@protoc_insertion_point(field_mutable_list:append_entry.AppendEntriesRequest.log_entries)
+  return &_impl_.log_entries_;
+}
+inline const ::log_entry::LogEntry& AppendEntriesRequest::_internal_log_entries(int index) const {
+  return _impl_.log_entries_.Get(index);
+}
+inline const ::log_entry::LogEntry& AppendEntriesRequest::log_entries(int index) const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesRequest.log_entries)
+  return _internal_log_entries(index);
+}
+inline ::log_entry::LogEntry* AppendEntriesRequest::_internal_add_log_entries() {
+  return _impl_.log_entries_.Add();
+}
+inline ::log_entry::LogEntry* AppendEntriesRequest::add_log_entries() {
+  ::log_entry::LogEntry* _add = _internal_add_log_entries();
+  // @@protoc_insertion_point(field_add:append_entry.AppendEntriesRequest.log_entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::log_entry::LogEntry >&
+AppendEntriesRequest::log_entries() const {
+  // @@protoc_insertion_point(field_list:append_entry.AppendEntriesRequest.log_entries)
+  return _impl_.log_entries_;
+}
+
+// .google.protobuf.UInt32Value leader_commit_index = 6;
+inline bool AppendEntriesRequest::_internal_has_leader_commit_index() const {
+  return this != internal_default_instance() && _impl_.leader_commit_index_ != nullptr;
+}
+inline bool AppendEntriesRequest::has_leader_commit_index() const {
+  return _internal_has_leader_commit_index();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& AppendEntriesRequest::_internal_leader_commit_index() const {
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value* p = _impl_.leader_commit_index_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::UInt32Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& AppendEntriesRequest::leader_commit_index() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesRequest.leader_commit_index)
+  return _internal_leader_commit_index();
+}
+inline void AppendEntriesRequest::unsafe_arena_set_allocated_leader_commit_index(
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_commit_index) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.leader_commit_index_);
+  }
+  _impl_.leader_commit_index_ = leader_commit_index;
+  if (leader_commit_index) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:append_entry.AppendEntriesRequest.leader_commit_index)
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* AppendEntriesRequest::release_leader_commit_index() {
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.leader_commit_index_;
+  _impl_.leader_commit_index_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* AppendEntriesRequest::unsafe_arena_release_leader_commit_index() {
+  // @@protoc_insertion_point(field_release:append_entry.AppendEntriesRequest.leader_commit_index)
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.leader_commit_index_;
+  _impl_.leader_commit_index_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* AppendEntriesRequest::_internal_mutable_leader_commit_index() {
+  
+  if (_impl_.leader_commit_index_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaForAllocation());
+    _impl_.leader_commit_index_ = p;
+  }
+  return _impl_.leader_commit_index_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* AppendEntriesRequest::mutable_leader_commit_index() {
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _msg = _internal_mutable_leader_commit_index();
+  // @@protoc_insertion_point(field_mutable:append_entry.AppendEntriesRequest.leader_commit_index)
+  return _msg;
+}
+inline void AppendEntriesRequest::set_allocated_leader_commit_index(::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_commit_index) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.leader_commit_index_);
+  }
+  if (leader_commit_index) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(leader_commit_index));
+    if (message_arena != submessage_arena) {
+      leader_commit_index = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, leader_commit_index, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.leader_commit_index_ = leader_commit_index;
+  // @@protoc_insertion_point(field_set_allocated:append_entry.AppendEntriesRequest.leader_commit_index)
+}
+
+// uint64 read_round = 7;
+inline void AppendEntriesRequest::clear_read_round() {
+  _impl_.read_round_ = uint64_t{0u};
+}
+inline uint64_t AppendEntriesRequest::_internal_read_round() const {
+  return _impl_.read_round_;
+}
+inline uint64_t AppendEntriesRequest::read_round() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesRequest.read_round)
+  return _internal_read_round();
+}
+inline void AppendEntriesRequest::_internal_set_read_round(uint64_t value) {
+  
+  _impl_.read_round_ = value;
+}
+inline void AppendEntriesRequest::set_read_round(uint64_t value) {
+  _internal_set_read_round(value);
+  // @@protoc_insertion_point(field_set:append_entry.AppendEntriesRequest.read_round)
+}
+
+// -------------------------------------------------------------------
+
+// AppendEntriesResponse
+
+// bool success = 1;
+inline void AppendEntriesResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool AppendEntriesResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool AppendEntriesResponse::success() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesResponse.success)
+  return _internal_success();
+}
+inline void AppendEntriesResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void AppendEntriesResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:append_entry.AppendEntriesResponse.success)
+}
+
+// uint32 match_log_size = 3;
+inline void AppendEntriesResponse::clear_match_log_size() {
+  _impl_.match_log_size_ = 0u;
+}
+inline uint32_t AppendEntriesResponse::_internal_match_log_size() const {
+  return _impl_.match_log_size_;
+}
+inline uint32_t AppendEntriesResponse::match_log_size() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesResponse.match_log_size)
+  return _internal_match_log_size();
+}
+inline void AppendEntriesResponse::_internal_set_match_log_size(uint32_t value) {
+  
+  _impl_.match_log_size_ = value;
+}
+inline void AppendEntriesResponse::set_match_log_size(uint32_t value) {
+  _internal_set_match_log_size(value);
+  // @@protoc_insertion_point(field_set:append_entry.AppendEntriesResponse.match_log_size)
+}
+
+// uint32 prev_log_size = 4;
+inline void AppendEntriesResponse::clear_prev_log_size() {
+  _impl_.prev_log_size_ = 0u;
+}
+inline uint32_t AppendEntriesResponse::_internal_prev_log_size() const {
+  return _impl_.prev_log_size_;
+}
+inline uint32_t AppendEntriesResponse::prev_log_size() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesResponse.prev_log_size)
+  return _internal_prev_log_size();
+}
+inline void AppendEntriesResponse::_internal_set_prev_log_size(uint32_t value) {
+  
+  _impl_.prev_log_size_ = value;
+}
+inline void AppendEntriesResponse::set_prev_log_size(uint32_t value) {
+  _internal_set_prev_log_size(value);
+  // @@protoc_insertion_point(field_set:append_entry.AppendEntriesResponse.prev_log_size)
+}
+
+// .google.protobuf.UInt32Value conflict_term = 5;
+inline bool AppendEntriesResponse::_internal_has_conflict_term() const {
+  return this != internal_default_instance() && _impl_.conflict_term_ != nullptr;
+}
+inline bool AppendEntriesResponse::has_conflict_term() const {
+  return _internal_has_conflict_term();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& AppendEntriesResponse::_internal_conflict_term() const {
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value* p = _impl_.conflict_term_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::UInt32Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& AppendEntriesResponse::conflict_term() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesResponse.conflict_term)
+  return _internal_conflict_term();
+}
+inline void AppendEntriesResponse::unsafe_arena_set_allocated_conflict_term(
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* conflict_term) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.conflict_term_);
+  }
+  _impl_.conflict_term_ = conflict_term;
+  if (conflict_term) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:append_entry.AppendEntriesResponse.conflict_term)
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* AppendEntriesResponse::release_conflict_term() {
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.conflict_term_;
+  _impl_.conflict_term_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* AppendEntriesResponse::unsafe_arena_release_conflict_term() {
+  // @@protoc_insertion_point(field_release:append_entry.AppendEntriesResponse.conflict_term)
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.conflict_term_;
+  _impl_.conflict_term_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* AppendEntriesResponse::_internal_mutable_conflict_term() {
+  
+  if (_impl_.conflict_term_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaForAllocation());
+    _impl_.conflict_term_ = p;
+  }
+  return _impl_.conflict_term_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* AppendEntriesResponse::mutable_conflict_term() {
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _msg = _internal_mutable_conflict_term();
+  // @@protoc_insertion_point(field_mutable:append_entry.AppendEntriesResponse.conflict_term)
+  return _msg;
+}
+inline void AppendEntriesResponse::set_allocated_conflict_term(::PROTOBUF_NAMESPACE_ID::UInt32Value* conflict_term) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.conflict_term_);
+  }
+  if (conflict_term) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(conflict_term));
+    if (message_arena != submessage_arena) {
+      conflict_term = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, conflict_term, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.conflict_term_ = conflict_term;
+  // @@protoc_insertion_point(field_set_allocated:append_entry.AppendEntriesResponse.conflict_term)
+}
+
+// uint32 conflict_index = 6;
+inline void AppendEntriesResponse::clear_conflict_index() {
+  _impl_.conflict_index_ = 0u;
+}
+inline uint32_t AppendEntriesResponse::_internal_conflict_index() const {
+  return _impl_.conflict_index_;
+}
+inline uint32_t AppendEntriesResponse::conflict_index() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesResponse.conflict_index)
+  return _internal_conflict_index();
+}
+inline void AppendEntriesResponse::_internal_set_conflict_index(uint32_t value) {
+  
+  _impl_.conflict_index_ = value;
+}
+inline void AppendEntriesResponse::set_conflict_index(uint32_t value) {
+  _internal_set_conflict_index(value);
+  // @@protoc_insertion_point(field_set:append_entry.AppendEntriesResponse.conflict_index)
+}
+
+// uint64 read_round = 7;
+inline void AppendEntriesResponse::clear_read_round() {
+  _impl_.read_round_ = uint64_t{0u};
+}
+inline uint64_t AppendEntriesResponse::_internal_read_round() const {
+  return _impl_.read_round_;
+}
+inline uint64_t AppendEntriesResponse::read_round() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesResponse.read_round)
+  return _internal_read_round();
+}
+inline void AppendEntriesResponse::_internal_set_read_round(uint64_t value) {
+  
+  _impl_.read_round_ = value;
+}
+inline void AppendEntriesResponse::set_read_round(uint64_t value) {
+  _internal_set_read_round(value);
+  // @@protoc_insertion_point(field_set:append_entry.AppendEntriesResponse.read_round)
+}
+
+// uint32 processing_latency = 8;
+inline void AppendEntriesResponse::clear_processing_latency() {
+  _impl_.processing_latency_ = 0u;
+}
+inline uint32_t AppendEntriesResponse::_internal_processing_latency() const {
+  return _impl_.processing_latency_;
+}
+inline uint32_t AppendEntriesResponse::processing_latency() const {
+  // @@protoc_insertion_point(field_get:append_entry.AppendEntriesResponse.processing_latency)
+  return _internal_processing_latency();
+}
+inline void AppendEntriesResponse::_internal_set_processing_latency(uint32_t value) {
+  
+  _impl_.processing_latency_ = value;
+}
+inline void AppendEntriesResponse::set_processing_latency(uint32_t value) {
+  _internal_set_processing_latency(value);
+  // @@protoc_insertion_point(field_set:append_entry.AppendEntriesResponse.processing_latency)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace append_entry
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fappend_5fentry_2eproto
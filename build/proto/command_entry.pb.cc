@@ -0,0 +1,811 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/command_entry.proto
+
+#include "proto/command_entry.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace command_entry {
+PROTOBUF_CONSTEXPR CommandEntryRequest::CommandEntryRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.command_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.client_id_)*/nullptr
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.first_unacked_sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommandEntryRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommandEntryRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommandEntryRequestDefaultTypeInternal() {}
+  union {
+    CommandEntryRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommandEntryRequestDefaultTypeInternal _CommandEntryRequest_default_instance_;
+PROTOBUF_CONSTEXPR CommandEntryResponse::CommandEntryResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sequences_)*/{}
+  , /*decltype(_impl_._sequences_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.leader_hint_)*/nullptr
+  , /*decltype(_impl_.client_id_)*/nullptr
+  , /*decltype(_impl_.command_committed_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommandEntryResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommandEntryResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommandEntryResponseDefaultTypeInternal() {}
+  union {
+    CommandEntryResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommandEntryResponseDefaultTypeInternal _CommandEntryResponse_default_instance_;
+}  // namespace command_entry
+static ::_pb::Metadata file_level_metadata_proto_2fcommand_5fentry_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_proto_2fcommand_5fentry_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fcommand_5fentry_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fcommand_5fentry_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryRequest, _impl_.command_),
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryRequest, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryRequest, _impl_.client_id_),
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryRequest, _impl_.first_unacked_sequence_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryResponse, _impl_.command_committed_),
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryResponse, _impl_.sequences_),
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryResponse, _impl_.leader_hint_),
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryResponse, _impl_.client_id_),
+  PROTOBUF_FIELD_OFFSET(::command_entry::CommandEntryResponse, _impl_.results_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::command_entry::CommandEntryRequest)},
+  { 10, -1, -1, sizeof(::command_entry::CommandEntryResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::command_entry::_CommandEntryRequest_default_instance_._instance,
+  &::command_entry::_CommandEntryResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fcommand_5fentry_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\031proto/command_entry.proto\022\rcommand_ent"
+  "ry\032\036google/protobuf/wrappers.proto\"\211\001\n\023C"
+  "ommandEntryRequest\022\017\n\007command\030\001 \001(\t\022\020\n\010s"
+  "equence\030\002 \001(\004\022/\n\tclient_id\030\003 \001(\0132\034.googl"
+  "e.protobuf.UInt32Value\022\036\n\026first_unacked_"
+  "sequence\030\004 \001(\004\"\271\001\n\024CommandEntryResponse\022"
+  "\031\n\021command_committed\030\001 \001(\010\022\021\n\tsequences\030"
+  "\002 \003(\004\0221\n\013leader_hint\030\003 \001(\0132\034.google.prot"
+  "obuf.UInt32Value\022/\n\tclient_id\030\004 \001(\0132\034.go"
+  "ogle.protobuf.UInt32Value\022\017\n\007results\030\005 \003"
+  "(\tb\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_proto_2fcommand_5fentry_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_proto_2fcommand_5fentry_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fcommand_5fentry_2eproto = {
+    false, false, 410, descriptor_table_protodef_proto_2fcommand_5fentry_2eproto,
+    "proto/command_entry.proto",
+    &descriptor_table_proto_2fcommand_5fentry_2eproto_once, descriptor_table_proto_2fcommand_5fentry_2eproto_deps, 1, 2,
+    schemas, file_default_instances, TableStruct_proto_2fcommand_5fentry_2eproto::offsets,
+    file_level_metadata_proto_2fcommand_5fentry_2eproto, file_level_enum_descriptors_proto_2fcommand_5fentry_2eproto,
+    file_level_service_descriptors_proto_2fcommand_5fentry_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fcommand_5fentry_2eproto_getter() {
+  return &descriptor_table_proto_2fcommand_5fentry_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fcommand_5fentry_2eproto(&descriptor_table_proto_2fcommand_5fentry_2eproto);
+namespace command_entry {
+
+// ===================================================================
+
+class CommandEntryRequest::_Internal {
+ public:
+  static const ::PROTOBUF_NAMESPACE_ID::UInt32Value& client_id(const CommandEntryRequest* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::UInt32Value&
+CommandEntryRequest::_Internal::client_id(const CommandEntryRequest* msg) {
+  return *msg->_impl_.client_id_;
+}
+void CommandEntryRequest::clear_client_id() {
+  if (GetArenaForAllocation() == nullptr && _impl_.client_id_ != nullptr) {
+    delete _impl_.client_id_;
+  }
+  _impl_.client_id_ = nullptr;
+}
+CommandEntryRequest::CommandEntryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:command_entry.CommandEntryRequest)
+}
+CommandEntryRequest::CommandEntryRequest(const CommandEntryRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommandEntryRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.command_){}
+    , decltype(_impl_.client_id_){nullptr}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.first_unacked_sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_command().empty()) {
+    _this->_impl_.command_.Set(from._internal_command(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_client_id()) {
+    _this->_impl_.client_id_ = new ::PROTOBUF_NAMESPACE_ID::UInt32Value(*from._impl_.client_id_);
+  }
+  ::memcpy(&_impl_.sequence_, &from._impl_.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.first_unacked_sequence_) -
+    reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.first_unacked_sequence_));
+  // @@protoc_insertion_point(copy_constructor:command_entry.CommandEntryRequest)
+}
+
+inline void CommandEntryRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.command_){}
+    , decltype(_impl_.client_id_){nullptr}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.first_unacked_sequence_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CommandEntryRequest::~CommandEntryRequest() {
+  // @@protoc_insertion_point(destructor:command_entry.CommandEntryRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommandEntryRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.command_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.client_id_;
+}
+
+void CommandEntryRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommandEntryRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:command_entry.CommandEntryRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.command_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.client_id_ != nullptr) {
+    delete _impl_.client_id_;
+  }
+  _impl_.client_id_ = nullptr;
+  ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.first_unacked_sequence_) -
+      reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.first_unacked_sequence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommandEntryRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string command = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_command();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "command_entry.CommandEntryRequest.command"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sequence = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value client_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_client_id(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 first_unacked_sequence = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.first_unacked_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommandEntryRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:command_entry.CommandEntryRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string command = 1;
+  if (!this->_internal_command().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_command().data(), static_cast<int>(this->_internal_command().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "command_entry.CommandEntryRequest.command");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_command(), target);
+  }
+
+  // uint64 sequence = 2;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sequence(), target);
+  }
+
+  // .google.protobuf.UInt32Value client_id = 3;
+  if (this->_internal_has_client_id()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::client_id(this),
+        _Internal::client_id(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 first_unacked_sequence = 4;
+  if (this->_internal_first_unacked_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_first_unacked_sequence(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:command_entry.CommandEntryRequest)
+  return target;
+}
+
+size_t CommandEntryRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:command_entry.CommandEntryRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string command = 1;
+  if (!this->_internal_command().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_command());
+  }
+
+  // .google.protobuf.UInt32Value client_id = 3;
+  if (this->_internal_has_client_id()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.client_id_);
+  }
+
+  // uint64 sequence = 2;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
+  // uint64 first_unacked_sequence = 4;
+  if (this->_internal_first_unacked_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_first_unacked_sequence());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommandEntryRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommandEntryRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommandEntryRequest::GetClassData() const { return &_class_data_; }
+
+
+void CommandEntryRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommandEntryRequest*>(&to_msg);
+  auto& from = static_cast<const CommandEntryRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:command_entry.CommandEntryRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_command().empty()) {
+    _this->_internal_set_command(from._internal_command());
+  }
+  if (from._internal_has_client_id()) {
+    _this->_internal_mutable_client_id()->::PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(
+        from._internal_client_id());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  if (from._internal_first_unacked_sequence() != 0) {
+    _this->_internal_set_first_unacked_sequence(from._internal_first_unacked_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommandEntryRequest::CopyFrom(const CommandEntryRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:command_entry.CommandEntryRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommandEntryRequest::IsInitialized() const {
+  return true;
+}
+
+void CommandEntryRequest::InternalSwap(CommandEntryRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.command_, lhs_arena,
+      &other->_impl_.command_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CommandEntryRequest, _impl_.first_unacked_sequence_)
+      + sizeof(CommandEntryRequest::_impl_.first_unacked_sequence_)
+      - PROTOBUF_FIELD_OFFSET(CommandEntryRequest, _impl_.client_id_)>(
+          reinterpret_cast<char*>(&_impl_.client_id_),
+          reinterpret_cast<char*>(&other->_impl_.client_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommandEntryRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fcommand_5fentry_2eproto_getter, &descriptor_table_proto_2fcommand_5fentry_2eproto_once,
+      file_level_metadata_proto_2fcommand_5fentry_2eproto[0]);
+}
+
+// ===================================================================
+
+class CommandEntryResponse::_Internal {
+ public:
+  static const ::PROTOBUF_NAMESPACE_ID::UInt32Value& leader_hint(const CommandEntryResponse* msg);
+  static const ::PROTOBUF_NAMESPACE_ID::UInt32Value& client_id(const CommandEntryResponse* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::UInt32Value&
+CommandEntryResponse::_Internal::leader_hint(const CommandEntryResponse* msg) {
+  return *msg->_impl_.leader_hint_;
+}
+const ::PROTOBUF_NAMESPACE_ID::UInt32Value&
+CommandEntryResponse::_Internal::client_id(const CommandEntryResponse* msg) {
+  return *msg->_impl_.client_id_;
+}
+void CommandEntryResponse::clear_leader_hint() {
+  if (GetArenaForAllocation() == nullptr && _impl_.leader_hint_ != nullptr) {
+    delete _impl_.leader_hint_;
+  }
+  _impl_.leader_hint_ = nullptr;
+}
+void CommandEntryResponse::clear_client_id() {
+  if (GetArenaForAllocation() == nullptr && _impl_.client_id_ != nullptr) {
+    delete _impl_.client_id_;
+  }
+  _impl_.client_id_ = nullptr;
+}
+CommandEntryResponse::CommandEntryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:command_entry.CommandEntryResponse)
+}
+CommandEntryResponse::CommandEntryResponse(const CommandEntryResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommandEntryResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sequences_){from._impl_.sequences_}
+    , /*decltype(_impl_._sequences_cached_byte_size_)*/{0}
+    , decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.leader_hint_){nullptr}
+    , decltype(_impl_.client_id_){nullptr}
+    , decltype(_impl_.command_committed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_leader_hint()) {
+    _this->_impl_.leader_hint_ = new ::PROTOBUF_NAMESPACE_ID::UInt32Value(*from._impl_.leader_hint_);
+  }
+  if (from._internal_has_client_id()) {
+    _this->_impl_.client_id_ = new ::PROTOBUF_NAMESPACE_ID::UInt32Value(*from._impl_.client_id_);
+  }
+  _this->_impl_.command_committed_ = from._impl_.command_committed_;
+  // @@protoc_insertion_point(copy_constructor:command_entry.CommandEntryResponse)
+}
+
+inline void CommandEntryResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sequences_){arena}
+    , /*decltype(_impl_._sequences_cached_byte_size_)*/{0}
+    , decltype(_impl_.results_){arena}
+    , decltype(_impl_.leader_hint_){nullptr}
+    , decltype(_impl_.client_id_){nullptr}
+    , decltype(_impl_.command_committed_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CommandEntryResponse::~CommandEntryResponse() {
+  // @@protoc_insertion_point(destructor:command_entry.CommandEntryResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommandEntryResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sequences_.~RepeatedField();
+  _impl_.results_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.leader_hint_;
+  if (this != internal_default_instance()) delete _impl_.client_id_;
+}
+
+void CommandEntryResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommandEntryResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:command_entry.CommandEntryResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sequences_.Clear();
+  _impl_.results_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.leader_hint_ != nullptr) {
+    delete _impl_.leader_hint_;
+  }
+  _impl_.leader_hint_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.client_id_ != nullptr) {
+    delete _impl_.client_id_;
+  }
+  _impl_.client_id_ = nullptr;
+  _impl_.command_committed_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommandEntryResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool command_committed = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.command_committed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 sequences = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_sequences(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_sequences(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value leader_hint = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_leader_hint(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value client_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_client_id(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string results = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_results();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "command_entry.CommandEntryResponse.results"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommandEntryResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:command_entry.CommandEntryResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool command_committed = 1;
+  if (this->_internal_command_committed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_command_committed(), target);
+  }
+
+  // repeated uint64 sequences = 2;
+  {
+    int byte_size = _impl_._sequences_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          2, _internal_sequences(), byte_size, target);
+    }
+  }
+
+  // .google.protobuf.UInt32Value leader_hint = 3;
+  if (this->_internal_has_leader_hint()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::leader_hint(this),
+        _Internal::leader_hint(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.UInt32Value client_id = 4;
+  if (this->_internal_has_client_id()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::client_id(this),
+        _Internal::client_id(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated string results = 5;
+  for (int i = 0, n = this->_internal_results_size(); i < n; i++) {
+    const auto& s = this->_internal_results(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "command_entry.CommandEntryResponse.results");
+    target = stream->WriteString(5, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:command_entry.CommandEntryResponse)
+  return target;
+}
+
+size_t CommandEntryResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:command_entry.CommandEntryResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 sequences = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.sequences_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sequences_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated string results = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.results_.size());
+  for (int i = 0, n = _impl_.results_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.results_.Get(i));
+  }
+
+  // .google.protobuf.UInt32Value leader_hint = 3;
+  if (this->_internal_has_leader_hint()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.leader_hint_);
+  }
+
+  // .google.protobuf.UInt32Value client_id = 4;
+  if (this->_internal_has_client_id()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.client_id_);
+  }
+
+  // bool command_committed = 1;
+  if (this->_internal_command_committed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommandEntryResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommandEntryResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommandEntryResponse::GetClassData() const { return &_class_data_; }
+
+
+void CommandEntryResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommandEntryResponse*>(&to_msg);
+  auto& from = static_cast<const CommandEntryResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:command_entry.CommandEntryResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sequences_.MergeFrom(from._impl_.sequences_);
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (from._internal_has_leader_hint()) {
+    _this->_internal_mutable_leader_hint()->::PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(
+        from._internal_leader_hint());
+  }
+  if (from._internal_has_client_id()) {
+    _this->_internal_mutable_client_id()->::PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(
+        from._internal_client_id());
+  }
+  if (from._internal_command_committed() != 0) {
+    _this->_internal_set_command_committed(from._internal_command_committed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommandEntryResponse::CopyFrom(const CommandEntryResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:command_entry.CommandEntryResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommandEntryResponse::IsInitialized() const {
+  return true;
+}
+
+void CommandEntryResponse::InternalSwap(CommandEntryResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.sequences_.InternalSwap(&other->_impl_.sequences_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CommandEntryResponse, _impl_.command_committed_)
+      + sizeof(CommandEntryResponse::_impl_.command_committed_)
+      - PROTOBUF_FIELD_OFFSET(CommandEntryResponse, _impl_.leader_hint_)>(
+          reinterpret_cast<char*>(&_impl_.leader_hint_),
+          reinterpret_cast<char*>(&other->_impl_.leader_hint_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommandEntryResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fcommand_5fentry_2eproto_getter, &descriptor_table_proto_2fcommand_5fentry_2eproto_once,
+      file_level_metadata_proto_2fcommand_5fentry_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace command_entry
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::command_entry::CommandEntryRequest*
+Arena::CreateMaybeMessage< ::command_entry::CommandEntryRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::command_entry::CommandEntryRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::command_entry::CommandEntryResponse*
+Arena::CreateMaybeMessage< ::command_entry::CommandEntryResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::command_entry::CommandEntryResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1011 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/command_entry.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fcommand_5fentry_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fcommand_5fentry_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/wrappers.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fcommand_5fentry_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fcommand_5fentry_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fcommand_5fentry_2eproto;
+namespace command_entry {
+class CommandEntryRequest;
+struct CommandEntryRequestDefaultTypeInternal;
+extern CommandEntryRequestDefaultTypeInternal _CommandEntryRequest_default_instance_;
+class CommandEntryResponse;
+struct CommandEntryResponseDefaultTypeInternal;
+extern CommandEntryResponseDefaultTypeInternal _CommandEntryResponse_default_instance_;
+}  // namespace command_entry
+PROTOBUF_NAMESPACE_OPEN
+template<> ::command_entry::CommandEntryRequest* Arena::CreateMaybeMessage<::command_entry::CommandEntryRequest>(Arena*);
+template<> ::command_entry::CommandEntryResponse* Arena::CreateMaybeMessage<::command_entry::CommandEntryResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace command_entry {
+
+// ===================================================================
+
+class CommandEntryRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:command_entry.CommandEntryRequest) */ {
+ public:
+  inline CommandEntryRequest() : CommandEntryRequest(nullptr) {}
+  ~CommandEntryRequest() override;
+  explicit PROTOBUF_CONSTEXPR CommandEntryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommandEntryRequest(const CommandEntryRequest& from);
+  CommandEntryRequest(CommandEntryRequest&& from) noexcept
+    : CommandEntryRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CommandEntryRequest& operator=(const CommandEntryRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommandEntryRequest& operator=(CommandEntryRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommandEntryRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommandEntryRequest* internal_default_instance() {
+    return reinterpret_cast<const CommandEntryRequest*>(
+               &_CommandEntryRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CommandEntryRequest& a, CommandEntryRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommandEntryRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommandEntryRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommandEntryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommandEntryRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommandEntryRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommandEntryRequest& from) {
+    CommandEntryRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommandEntryRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "command_entry.CommandEntryRequest";
+  }
+  protected:
+  explicit CommandEntryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCommandFieldNumber = 1,
+    kClientIdFieldNumber = 3,
+    kSequenceFieldNumber = 2,
+    kFirstUnackedSequenceFieldNumber = 4,
+  };
+  // string command = 1;
+  void clear_command();
+  const std::string& command() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_command(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_command();
+  PROTOBUF_NODISCARD std::string* release_command();
+  void set_allocated_command(std::string* command);
+  private:
+  const std::string& _internal_command() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
+  std::string* _internal_mutable_command();
+  public:
+
+  // .google.protobuf.UInt32Value client_id = 3;
+  bool has_client_id() const;
+  private:
+  bool _internal_has_client_id() const;
+  public:
+  void clear_client_id();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& client_id() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::UInt32Value* release_client_id();
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_client_id();
+  void set_allocated_client_id(::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_client_id() const;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_client_id();
+  public:
+  void unsafe_arena_set_allocated_client_id(
+      ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id);
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* unsafe_arena_release_client_id();
+
+  // uint64 sequence = 2;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // uint64 first_unacked_sequence = 4;
+  void clear_first_unacked_sequence();
+  uint64_t first_unacked_sequence() const;
+  void set_first_unacked_sequence(uint64_t value);
+  private:
+  uint64_t _internal_first_unacked_sequence() const;
+  void _internal_set_first_unacked_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:command_entry.CommandEntryRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id_;
+    uint64_t sequence_;
+    uint64_t first_unacked_sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fcommand_5fentry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommandEntryResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:command_entry.CommandEntryResponse) */ {
+ public:
+  inline CommandEntryResponse() : CommandEntryResponse(nullptr) {}
+  ~CommandEntryResponse() override;
+  explicit PROTOBUF_CONSTEXPR CommandEntryResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommandEntryResponse(const CommandEntryResponse& from);
+  CommandEntryResponse(CommandEntryResponse&& from) noexcept
+    : CommandEntryResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CommandEntryResponse& operator=(const CommandEntryResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommandEntryResponse& operator=(CommandEntryResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommandEntryResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommandEntryResponse* internal_default_instance() {
+    return reinterpret_cast<const CommandEntryResponse*>(
+               &_CommandEntryResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(CommandEntryResponse& a, CommandEntryResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommandEntryResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommandEntryResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommandEntryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommandEntryResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommandEntryResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommandEntryResponse& from) {
+    CommandEntryResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommandEntryResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "command_entry.CommandEntryResponse";
+  }
+  protected:
+  explicit CommandEntryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSequencesFieldNumber = 2,
+    kResultsFieldNumber = 5,
+    kLeaderHintFieldNumber = 3,
+    kClientIdFieldNumber = 4,
+    kCommandCommittedFieldNumber = 1,
+  };
+  // repeated uint64 sequences = 2;
+  int sequences_size() const;
+  private:
+  int _internal_sequences_size() const;
+  public:
+  void clear_sequences();
+  private:
+  uint64_t _internal_sequences(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_sequences() const;
+  void _internal_add_sequences(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_sequences();
+  public:
+  uint64_t sequences(int index) const;
+  void set_sequences(int index, uint64_t value);
+  void add_sequences(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      sequences() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_sequences();
+
+  // repeated string results = 5;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  const std::string& results(int index) const;
+  std::string* mutable_results(int index);
+  void set_results(int index, const std::string& value);
+  void set_results(int index, std::string&& value);
+  void set_results(int index, const char* value);
+  void set_results(int index, const char* value, size_t size);
+  std::string* add_results();
+  void add_results(const std::string& value);
+  void add_results(std::string&& value);
+  void add_results(const char* value);
+  void add_results(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& results() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_results();
+  private:
+  const std::string& _internal_results(int index) const;
+  std::string* _internal_add_results();
+  public:
+
+  // .google.protobuf.UInt32Value leader_hint = 3;
+  bool has_leader_hint() const;
+  private:
+  bool _internal_has_leader_hint() const;
+  public:
+  void clear_leader_hint();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& leader_hint() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::UInt32Value* release_leader_hint();
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_leader_hint();
+  void set_allocated_leader_hint(::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_hint);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_leader_hint() const;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_leader_hint();
+  public:
+  void unsafe_arena_set_allocated_leader_hint(
+      ::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_hint);
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* unsafe_arena_release_leader_hint();
+
+  // .google.protobuf.UInt32Value client_id = 4;
+  bool has_client_id() const;
+  private:
+  bool _internal_has_client_id() const;
+  public:
+  void clear_client_id();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& client_id() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::UInt32Value* release_client_id();
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_client_id();
+  void set_allocated_client_id(::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_client_id() const;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_client_id();
+  public:
+  void unsafe_arena_set_allocated_client_id(
+      ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id);
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* unsafe_arena_release_client_id();
+
+  // bool command_committed = 1;
+  void clear_command_committed();
+  bool command_committed() const;
+  void set_command_committed(bool value);
+  private:
+  bool _internal_command_committed() const;
+  void _internal_set_command_committed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:command_entry.CommandEntryResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > sequences_;
+    mutable std::atomic<int> _sequences_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> results_;
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_hint_;
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id_;
+    bool command_committed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fcommand_5fentry_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CommandEntryRequest
+
+// string command = 1;
+inline void CommandEntryRequest::clear_command() {
+  _impl_.command_.ClearToEmpty();
+}
+inline const std::string& CommandEntryRequest::command() const {
+  // @@protoc_insertion_point(field_get:command_entry.CommandEntryRequest.command)
+  return _internal_command();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CommandEntryRequest::set_command(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.command_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:command_entry.CommandEntryRequest.command)
+}
+inline std::string* CommandEntryRequest::mutable_command() {
+  std::string* _s = _internal_mutable_command();
+  // @@protoc_insertion_point(field_mutable:command_entry.CommandEntryRequest.command)
+  return _s;
+}
+inline const std::string& CommandEntryRequest::_internal_command() const {
+  return _impl_.command_.Get();
+}
+inline void CommandEntryRequest::_internal_set_command(const std::string& value) {
+  
+  _impl_.command_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CommandEntryRequest::_internal_mutable_command() {
+  
+  return _impl_.command_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CommandEntryRequest::release_command() {
+  // @@protoc_insertion_point(field_release:command_entry.CommandEntryRequest.command)
+  return _impl_.command_.Release();
+}
+inline void CommandEntryRequest::set_allocated_command(std::string* command) {
+  if (command != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.command_.SetAllocated(command, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:command_entry.CommandEntryRequest.command)
+}
+
+// uint64 sequence = 2;
+inline void CommandEntryRequest::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t CommandEntryRequest::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t CommandEntryRequest::sequence() const {
+  // @@protoc_insertion_point(field_get:command_entry.CommandEntryRequest.sequence)
+  return _internal_sequence();
+}
+inline void CommandEntryRequest::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void CommandEntryRequest::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:command_entry.CommandEntryRequest.sequence)
+}
+
+// .google.protobuf.UInt32Value client_id = 3;
+inline bool CommandEntryRequest::_internal_has_client_id() const {
+  return this != internal_default_instance() && _impl_.client_id_ != nullptr;
+}
+inline bool CommandEntryRequest::has_client_id() const {
+  return _internal_has_client_id();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& CommandEntryRequest::_internal_client_id() const {
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value* p = _impl_.client_id_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::UInt32Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& CommandEntryRequest::client_id() const {
+  // @@protoc_insertion_point(field_get:command_entry.CommandEntryRequest.client_id)
+  return _internal_client_id();
+}
+inline void CommandEntryRequest::unsafe_arena_set_allocated_client_id(
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.client_id_);
+  }
+  _impl_.client_id_ = client_id;
+  if (client_id) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:command_entry.CommandEntryRequest.client_id)
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryRequest::release_client_id() {
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.client_id_;
+  _impl_.client_id_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryRequest::unsafe_arena_release_client_id() {
+  // @@protoc_insertion_point(field_release:command_entry.CommandEntryRequest.client_id)
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.client_id_;
+  _impl_.client_id_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryRequest::_internal_mutable_client_id() {
+  
+  if (_impl_.client_id_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaForAllocation());
+    _impl_.client_id_ = p;
+  }
+  return _impl_.client_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryRequest::mutable_client_id() {
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _msg = _internal_mutable_client_id();
+  // @@protoc_insertion_point(field_mutable:command_entry.CommandEntryRequest.client_id)
+  return _msg;
+}
+inline void CommandEntryRequest::set_allocated_client_id(::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.client_id_);
+  }
+  if (client_id) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(client_id));
+    if (message_arena != submessage_arena) {
+      client_id = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, client_id, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.client_id_ = client_id;
+  // @@protoc_insertion_point(field_set_allocated:command_entry.CommandEntryRequest.client_id)
+}
+
+// uint64 first_unacked_sequence = 4;
+inline void CommandEntryRequest::clear_first_unacked_sequence() {
+  _impl_.first_unacked_sequence_ = uint64_t{0u};
+}
+inline uint64_t CommandEntryRequest::_internal_first_unacked_sequence() const {
+  return _impl_.first_unacked_sequence_;
+}
+inline uint64_t CommandEntryRequest::first_unacked_sequence() const {
+  // @@protoc_insertion_point(field_get:command_entry.CommandEntryRequest.first_unacked_sequence)
+  return _internal_first_unacked_sequence();
+}
+inline void CommandEntryRequest::_internal_set_first_unacked_sequence(uint64_t value) {
+  
+  _impl_.first_unacked_sequence_ = value;
+}
+inline void CommandEntryRequest::set_first_unacked_sequence(uint64_t value) {
+  _internal_set_first_unacked_sequence(value);
+  // @@protoc_insertion_point(field_set:command_entry.CommandEntryRequest.first_unacked_sequence)
+}
+
+// -------------------------------------------------------------------
+
+// CommandEntryResponse
+
+// bool command_committed = 1;
+inline void CommandEntryResponse::clear_command_committed() {
+  _impl_.command_committed_ = false;
+}
+inline bool CommandEntryResponse::_internal_command_committed() const {
+  return _impl_.command_committed_;
+}
+inline bool CommandEntryResponse::command_committed() const {
+  // @@protoc_insertion_point(field_get:command_entry.CommandEntryResponse.command_committed)
+  return _internal_command_committed();
+}
+inline void CommandEntryResponse::_internal_set_command_committed(bool value) {
+  
+  _impl_.command_committed_ = value;
+}
+inline void CommandEntryResponse::set_command_committed(bool value) {
+  _internal_set_command_committed(value);
+  // @@protoc_insertion_point(field_set:command_entry.CommandEntryResponse.command_committed)
+}
+
+// repeated uint64 sequences = 2;
+inline int CommandEntryResponse::_internal_sequences_size() const {
+  return _impl_.sequences_.size();
+}
+inline int CommandEntryResponse::sequences_size() const {
+  return _internal_sequences_size();
+}
+inline void CommandEntryResponse::clear_sequences() {
+  _impl_.sequences_.Clear();
+}
+inline uint64_t CommandEntryResponse::_internal_sequences(int index) const {
+  return _impl_.sequences_.Get(index);
+}
+inline uint64_t CommandEntryResponse::sequences(int index) const {
+  // @@protoc_insertion_point(field_get:command_entry.CommandEntryResponse.sequences)
+  return _internal_sequences(index);
+}
+inline void CommandEntryResponse::set_sequences(int index, uint64_t value) {
+  _impl_.sequences_.Set(index, value);
+  // @@protoc_insertion_point(field_set:command_entry.CommandEntryResponse.sequences)
+}
+inline void CommandEntryResponse::_internal_add_sequences(uint64_t value) {
+  _impl_.sequences_.Add(value);
+}
+inline void CommandEntryResponse::add_sequences(uint64_t value) {
+  _internal_add_sequences(value);
+  // @@protoc_insertion_point(field_add:command_entry.CommandEntryResponse.sequences)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CommandEntryResponse::_internal_sequences() const {
+  return _impl_.sequences_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CommandEntryResponse::sequences() const {
+  // @@protoc_insertion_point(field_list:command_entry.CommandEntryResponse.sequences)
+  return _internal_sequences();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CommandEntryResponse::_internal_mutable_sequences() {
+  return &_impl_.sequences_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CommandEntryResponse::mutable_sequences() {
+  // @@protoc_insertion_point(field_mutable_list:command_entry.CommandEntryResponse.sequences)
+  return _internal_mutable_sequences();
+}
+
+// .google.protobuf.UInt32Value leader_hint = 3;
+inline bool CommandEntryResponse::_internal_has_leader_hint() const {
+  return this != internal_default_instance() && _impl_.leader_hint_ != nullptr;
+}
+inline bool CommandEntryResponse::has_leader_hint() const {
+  return _internal_has_leader_hint();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& CommandEntryResponse::_internal_leader_hint() const {
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value* p = _impl_.leader_hint_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::UInt32Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& CommandEntryResponse::leader_hint() const {
+  // @@protoc_insertion_point(field_get:command_entry.CommandEntryResponse.leader_hint)
+  return _internal_leader_hint();
+}
+inline void CommandEntryResponse::unsafe_arena_set_allocated_leader_hint(
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_hint) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.leader_hint_);
+  }
+  _impl_.leader_hint_ = leader_hint;
+  if (leader_hint) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:command_entry.CommandEntryResponse.leader_hint)
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryResponse::release_leader_hint() {
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.leader_hint_;
+  _impl_.leader_hint_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryResponse::unsafe_arena_release_leader_hint() {
+  // @@protoc_insertion_point(field_release:command_entry.CommandEntryResponse.leader_hint)
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.leader_hint_;
+  _impl_.leader_hint_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryResponse::_internal_mutable_leader_hint() {
+  
+  if (_impl_.leader_hint_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaForAllocation());
+    _impl_.leader_hint_ = p;
+  }
+  return _impl_.leader_hint_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryResponse::mutable_leader_hint() {
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _msg = _internal_mutable_leader_hint();
+  // @@protoc_insertion_point(field_mutable:command_entry.CommandEntryResponse.leader_hint)
+  return _msg;
+}
+inline void CommandEntryResponse::set_allocated_leader_hint(::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_hint) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.leader_hint_);
+  }
+  if (leader_hint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(leader_hint));
+    if (message_arena != submessage_arena) {
+      leader_hint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, leader_hint, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.leader_hint_ = leader_hint;
+  // @@protoc_insertion_point(field_set_allocated:command_entry.CommandEntryResponse.leader_hint)
+}
+
+// .google.protobuf.UInt32Value client_id = 4;
+inline bool CommandEntryResponse::_internal_has_client_id() const {
+  return this != internal_default_instance() && _impl_.client_id_ != nullptr;
+}
+inline bool CommandEntryResponse::has_client_id() const {
+  return _internal_has_client_id();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& CommandEntryResponse::_internal_client_id() const {
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value* p = _impl_.client_id_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::UInt32Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& CommandEntryResponse::client_id() const {
+  // @@protoc_insertion_point(field_get:command_entry.CommandEntryResponse.client_id)
+  return _internal_client_id();
+}
+inline void CommandEntryResponse::unsafe_arena_set_allocated_client_id(
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.client_id_);
+  }
+  _impl_.client_id_ = client_id;
+  if (client_id) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:command_entry.CommandEntryResponse.client_id)
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryResponse::release_client_id() {
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.client_id_;
+  _impl_.client_id_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryResponse::unsafe_arena_release_client_id() {
+  // @@protoc_insertion_point(field_release:command_entry.CommandEntryResponse.client_id)
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.client_id_;
+  _impl_.client_id_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryResponse::_internal_mutable_client_id() {
+  
+  if (_impl_.client_id_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaForAllocation());
+    _impl_.client_id_ = p;
+  }
+  return _impl_.client_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* CommandEntryResponse::mutable_client_id() {
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _msg = _internal_mutable_client_id();
+  // @@protoc_insertion_point(field_mutable:command_entry.CommandEntryResponse.client_id)
+  return _msg;
+}
+inline void CommandEntryResponse::set_allocated_client_id(::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.client_id_);
+  }
+  if (client_id) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(client_id));
+    if (message_arena != submessage_arena) {
+      client_id = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, client_id, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.client_id_ = client_id;
+  // @@protoc_insertion_point(field_set_allocated:command_entry.CommandEntryResponse.client_id)
+}
+
+// repeated string results = 5;
+inline int CommandEntryResponse::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int CommandEntryResponse::results_size() const {
+  return _internal_results_size();
+}
+inline void CommandEntryResponse::clear_results() {
+  _impl_.results_.Clear();
+}
+inline std::string* CommandEntryResponse::add_results() {
+  std::string* _s = _internal_add_results();
+  // @@protoc_insertion_point(field_add_mutable:command_entry.CommandEntryResponse.results)
+  return _s;
+}
+inline const std::string& CommandEntryResponse::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const std::string& CommandEntryResponse::results(int index) const {
+  // @@protoc_insertion_point(field_get:command_entry.CommandEntryResponse.results)
+  return _internal_results(index);
+}
+inline std::string* CommandEntryResponse::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:command_entry.CommandEntryResponse.results)
+  return _impl_.results_.Mutable(index);
+}
+inline void CommandEntryResponse::set_results(int index, const std::string& value) {
+  _impl_.results_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:command_entry.CommandEntryResponse.results)
+}
+inline void CommandEntryResponse::set_results(int index, std::string&& value) {
+  _impl_.results_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:command_entry.CommandEntryResponse.results)
+}
+inline void CommandEntryResponse::set_results(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.results_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:command_entry.CommandEntryResponse.results)
+}
+inline void CommandEntryResponse::set_results(int index, const char* value, size_t size) {
+  _impl_.results_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:command_entry.CommandEntryResponse.results)
+}
+inline std::string* CommandEntryResponse::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline void CommandEntryResponse::add_results(const std::string& value) {
+  _impl_.results_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:command_entry.CommandEntryResponse.results)
+}
+inline void CommandEntryResponse::add_results(std::string&& value) {
+  _impl_.results_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:command_entry.CommandEntryResponse.results)
+}
+inline void CommandEntryResponse::add_results(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.results_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:command_entry.CommandEntryResponse.results)
+}
+inline void CommandEntryResponse::add_results(const char* value, size_t size) {
+  _impl_.results_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:command_entry.CommandEntryResponse.results)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CommandEntryResponse::results() const {
+  // @@protoc_insertion_point(field_list:command_entry.CommandEntryResponse.results)
+  return _impl_.results_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CommandEntryResponse::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:command_entry.CommandEntryResponse.results)
+  return &_impl_.results_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace command_entry
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fcommand_5fentry_2eproto
@@ -0,0 +1,677 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/install_snapshot.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2finstall_5fsnapshot_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2finstall_5fsnapshot_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2finstall_5fsnapshot_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2finstall_5fsnapshot_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2finstall_5fsnapshot_2eproto;
+namespace install_snapshot {
+class InstallSnapshotRequest;
+struct InstallSnapshotRequestDefaultTypeInternal;
+extern InstallSnapshotRequestDefaultTypeInternal _InstallSnapshotRequest_default_instance_;
+class InstallSnapshotResponse;
+struct InstallSnapshotResponseDefaultTypeInternal;
+extern InstallSnapshotResponseDefaultTypeInternal _InstallSnapshotResponse_default_instance_;
+}  // namespace install_snapshot
+PROTOBUF_NAMESPACE_OPEN
+template<> ::install_snapshot::InstallSnapshotRequest* Arena::CreateMaybeMessage<::install_snapshot::InstallSnapshotRequest>(Arena*);
+template<> ::install_snapshot::InstallSnapshotResponse* Arena::CreateMaybeMessage<::install_snapshot::InstallSnapshotResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace install_snapshot {
+
+// ===================================================================
+
+class InstallSnapshotRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:install_snapshot.InstallSnapshotRequest) */ {
+ public:
+  inline InstallSnapshotRequest() : InstallSnapshotRequest(nullptr) {}
+  ~InstallSnapshotRequest() override;
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InstallSnapshotRequest(const InstallSnapshotRequest& from);
+  InstallSnapshotRequest(InstallSnapshotRequest&& from) noexcept
+    : InstallSnapshotRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline InstallSnapshotRequest& operator=(const InstallSnapshotRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InstallSnapshotRequest& operator=(InstallSnapshotRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InstallSnapshotRequest* internal_default_instance() {
+    return reinterpret_cast<const InstallSnapshotRequest*>(
+               &_InstallSnapshotRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(InstallSnapshotRequest& a, InstallSnapshotRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InstallSnapshotRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InstallSnapshotRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InstallSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InstallSnapshotRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InstallSnapshotRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstallSnapshotRequest& from) {
+    InstallSnapshotRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InstallSnapshotRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "install_snapshot.InstallSnapshotRequest";
+  }
+  protected:
+  explicit InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 5,
+    kLeaderIdFieldNumber = 1,
+    kLastIncludedIndexFieldNumber = 2,
+    kOffsetFieldNumber = 4,
+    kLastIncludedTermFieldNumber = 3,
+    kDoneFieldNumber = 6,
+  };
+  // bytes data = 5;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // uint32 leader_id = 1;
+  void clear_leader_id();
+  uint32_t leader_id() const;
+  void set_leader_id(uint32_t value);
+  private:
+  uint32_t _internal_leader_id() const;
+  void _internal_set_leader_id(uint32_t value);
+  public:
+
+  // uint32 last_included_index = 2;
+  void clear_last_included_index();
+  uint32_t last_included_index() const;
+  void set_last_included_index(uint32_t value);
+  private:
+  uint32_t _internal_last_included_index() const;
+  void _internal_set_last_included_index(uint32_t value);
+  public:
+
+  // uint64 offset = 4;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // uint32 last_included_term = 3;
+  void clear_last_included_term();
+  uint32_t last_included_term() const;
+  void set_last_included_term(uint32_t value);
+  private:
+  uint32_t _internal_last_included_term() const;
+  void _internal_set_last_included_term(uint32_t value);
+  public:
+
+  // bool done = 6;
+  void clear_done();
+  bool done() const;
+  void set_done(bool value);
+  private:
+  bool _internal_done() const;
+  void _internal_set_done(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:install_snapshot.InstallSnapshotRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint32_t leader_id_;
+    uint32_t last_included_index_;
+    uint64_t offset_;
+    uint32_t last_included_term_;
+    bool done_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2finstall_5fsnapshot_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InstallSnapshotResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:install_snapshot.InstallSnapshotResponse) */ {
+ public:
+  inline InstallSnapshotResponse() : InstallSnapshotResponse(nullptr) {}
+  ~InstallSnapshotResponse() override;
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InstallSnapshotResponse(const InstallSnapshotResponse& from);
+  InstallSnapshotResponse(InstallSnapshotResponse&& from) noexcept
+    : InstallSnapshotResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline InstallSnapshotResponse& operator=(const InstallSnapshotResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InstallSnapshotResponse& operator=(InstallSnapshotResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InstallSnapshotResponse* internal_default_instance() {
+    return reinterpret_cast<const InstallSnapshotResponse*>(
+               &_InstallSnapshotResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(InstallSnapshotResponse& a, InstallSnapshotResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InstallSnapshotResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InstallSnapshotResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InstallSnapshotResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InstallSnapshotResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstallSnapshotResponse& from) {
+    InstallSnapshotResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InstallSnapshotResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "install_snapshot.InstallSnapshotResponse";
+  }
+  protected:
+  explicit InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNextOffsetFieldNumber = 2,
+    kLastIncludedIndexFieldNumber = 1,
+    kDoneFieldNumber = 3,
+  };
+  // uint64 next_offset = 2;
+  void clear_next_offset();
+  uint64_t next_offset() const;
+  void set_next_offset(uint64_t value);
+  private:
+  uint64_t _internal_next_offset() const;
+  void _internal_set_next_offset(uint64_t value);
+  public:
+
+  // uint32 last_included_index = 1;
+  void clear_last_included_index();
+  uint32_t last_included_index() const;
+  void set_last_included_index(uint32_t value);
+  private:
+  uint32_t _internal_last_included_index() const;
+  void _internal_set_last_included_index(uint32_t value);
+  public:
+
+  // bool done = 3;
+  void clear_done();
+  bool done() const;
+  void set_done(bool value);
+  private:
+  bool _internal_done() const;
+  void _internal_set_done(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:install_snapshot.InstallSnapshotResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t next_offset_;
+    uint32_t last_included_index_;
+    bool done_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2finstall_5fsnapshot_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// InstallSnapshotRequest
+
+// uint32 leader_id = 1;
+inline void InstallSnapshotRequest::clear_leader_id() {
+  _impl_.leader_id_ = 0u;
+}
+inline uint32_t InstallSnapshotRequest::_internal_leader_id() const {
+  return _impl_.leader_id_;
+}
+inline uint32_t InstallSnapshotRequest::leader_id() const {
+  // @@protoc_insertion_point(field_get:install_snapshot.InstallSnapshotRequest.leader_id)
+  return _internal_leader_id();
+}
+inline void InstallSnapshotRequest::_internal_set_leader_id(uint32_t value) {
+  
+  _impl_.leader_id_ = value;
+}
+inline void InstallSnapshotRequest::set_leader_id(uint32_t value) {
+  _internal_set_leader_id(value);
+  // @@protoc_insertion_point(field_set:install_snapshot.InstallSnapshotRequest.leader_id)
+}
+
+// uint32 last_included_index = 2;
+inline void InstallSnapshotRequest::clear_last_included_index() {
+  _impl_.last_included_index_ = 0u;
+}
+inline uint32_t InstallSnapshotRequest::_internal_last_included_index() const {
+  return _impl_.last_included_index_;
+}
+inline uint32_t InstallSnapshotRequest::last_included_index() const {
+  // @@protoc_insertion_point(field_get:install_snapshot.InstallSnapshotRequest.last_included_index)
+  return _internal_last_included_index();
+}
+inline void InstallSnapshotRequest::_internal_set_last_included_index(uint32_t value) {
+  
+  _impl_.last_included_index_ = value;
+}
+inline void InstallSnapshotRequest::set_last_included_index(uint32_t value) {
+  _internal_set_last_included_index(value);
+  // @@protoc_insertion_point(field_set:install_snapshot.InstallSnapshotRequest.last_included_index)
+}
+
+// uint32 last_included_term = 3;
+inline void InstallSnapshotRequest::clear_last_included_term() {
+  _impl_.last_included_term_ = 0u;
+}
+inline uint32_t InstallSnapshotRequest::_internal_last_included_term() const {
+  return _impl_.last_included_term_;
+}
+inline uint32_t InstallSnapshotRequest::last_included_term() const {
+  // @@protoc_insertion_point(field_get:install_snapshot.InstallSnapshotRequest.last_included_term)
+  return _internal_last_included_term();
+}
+inline void InstallSnapshotRequest::_internal_set_last_included_term(uint32_t value) {
+  
+  _impl_.last_included_term_ = value;
+}
+inline void InstallSnapshotRequest::set_last_included_term(uint32_t value) {
+  _internal_set_last_included_term(value);
+  // @@protoc_insertion_point(field_set:install_snapshot.InstallSnapshotRequest.last_included_term)
+}
+
+// uint64 offset = 4;
+inline void InstallSnapshotRequest::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t InstallSnapshotRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t InstallSnapshotRequest::offset() const {
+  // @@protoc_insertion_point(field_get:install_snapshot.InstallSnapshotRequest.offset)
+  return _internal_offset();
+}
+inline void InstallSnapshotRequest::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void InstallSnapshotRequest::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:install_snapshot.InstallSnapshotRequest.offset)
+}
+
+// bytes data = 5;
+inline void InstallSnapshotRequest::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& InstallSnapshotRequest::data() const {
+  // @@protoc_insertion_point(field_get:install_snapshot.InstallSnapshotRequest.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InstallSnapshotRequest::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:install_snapshot.InstallSnapshotRequest.data)
+}
+inline std::string* InstallSnapshotRequest::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:install_snapshot.InstallSnapshotRequest.data)
+  return _s;
+}
+inline const std::string& InstallSnapshotRequest::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void InstallSnapshotRequest::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InstallSnapshotRequest::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InstallSnapshotRequest::release_data() {
+  // @@protoc_insertion_point(field_release:install_snapshot.InstallSnapshotRequest.data)
+  return _impl_.data_.Release();
+}
+inline void InstallSnapshotRequest::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:install_snapshot.InstallSnapshotRequest.data)
+}
+
+// bool done = 6;
+inline void InstallSnapshotRequest::clear_done() {
+  _impl_.done_ = false;
+}
+inline bool InstallSnapshotRequest::_internal_done() const {
+  return _impl_.done_;
+}
+inline bool InstallSnapshotRequest::done() const {
+  // @@protoc_insertion_point(field_get:install_snapshot.InstallSnapshotRequest.done)
+  return _internal_done();
+}
+inline void InstallSnapshotRequest::_internal_set_done(bool value) {
+  
+  _impl_.done_ = value;
+}
+inline void InstallSnapshotRequest::set_done(bool value) {
+  _internal_set_done(value);
+  // @@protoc_insertion_point(field_set:install_snapshot.InstallSnapshotRequest.done)
+}
+
+// -------------------------------------------------------------------
+
+// InstallSnapshotResponse
+
+// uint32 last_included_index = 1;
+inline void InstallSnapshotResponse::clear_last_included_index() {
+  _impl_.last_included_index_ = 0u;
+}
+inline uint32_t InstallSnapshotResponse::_internal_last_included_index() const {
+  return _impl_.last_included_index_;
+}
+inline uint32_t InstallSnapshotResponse::last_included_index() const {
+  // @@protoc_insertion_point(field_get:install_snapshot.InstallSnapshotResponse.last_included_index)
+  return _internal_last_included_index();
+}
+inline void InstallSnapshotResponse::_internal_set_last_included_index(uint32_t value) {
+  
+  _impl_.last_included_index_ = value;
+}
+inline void InstallSnapshotResponse::set_last_included_index(uint32_t value) {
+  _internal_set_last_included_index(value);
+  // @@protoc_insertion_point(field_set:install_snapshot.InstallSnapshotResponse.last_included_index)
+}
+
+// uint64 next_offset = 2;
+inline void InstallSnapshotResponse::clear_next_offset() {
+  _impl_.next_offset_ = uint64_t{0u};
+}
+inline uint64_t InstallSnapshotResponse::_internal_next_offset() const {
+  return _impl_.next_offset_;
+}
+inline uint64_t InstallSnapshotResponse::next_offset() const {
+  // @@protoc_insertion_point(field_get:install_snapshot.InstallSnapshotResponse.next_offset)
+  return _internal_next_offset();
+}
+inline void InstallSnapshotResponse::_internal_set_next_offset(uint64_t value) {
+  
+  _impl_.next_offset_ = value;
+}
+inline void InstallSnapshotResponse::set_next_offset(uint64_t value) {
+  _internal_set_next_offset(value);
+  // @@protoc_insertion_point(field_set:install_snapshot.InstallSnapshotResponse.next_offset)
+}
+
+// bool done = 3;
+inline void InstallSnapshotResponse::clear_done() {
+  _impl_.done_ = false;
+}
+inline bool InstallSnapshotResponse::_internal_done() const {
+  return _impl_.done_;
+}
+inline bool InstallSnapshotResponse::done() const {
+  // @@protoc_insertion_point(field_get:install_snapshot.InstallSnapshotResponse.done)
+  return _internal_done();
+}
+inline void InstallSnapshotResponse::_internal_set_done(bool value) {
+  
+  _impl_.done_ = value;
+}
+inline void InstallSnapshotResponse::set_done(bool value) {
+  _internal_set_done(value);
+  // @@protoc_insertion_point(field_set:install_snapshot.InstallSnapshotResponse.done)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace install_snapshot
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2finstall_5fsnapshot_2eproto
@@ -0,0 +1,468 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/log_entry.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2flog_5fentry_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2flog_5fentry_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2flog_5fentry_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2flog_5fentry_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2flog_5fentry_2eproto;
+namespace log_entry {
+class LogEntry;
+struct LogEntryDefaultTypeInternal;
+extern LogEntryDefaultTypeInternal _LogEntry_default_instance_;
+}  // namespace log_entry
+PROTOBUF_NAMESPACE_OPEN
+template<> ::log_entry::LogEntry* Arena::CreateMaybeMessage<::log_entry::LogEntry>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace log_entry {
+
+// ===================================================================
+
+class LogEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:log_entry.LogEntry) */ {
+ public:
+  inline LogEntry() : LogEntry(nullptr) {}
+  ~LogEntry() override;
+  explicit PROTOBUF_CONSTEXPR LogEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogEntry(const LogEntry& from);
+  LogEntry(LogEntry&& from) noexcept
+    : LogEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline LogEntry& operator=(const LogEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogEntry& operator=(LogEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogEntry* internal_default_instance() {
+    return reinterpret_cast<const LogEntry*>(
+               &_LogEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(LogEntry& a, LogEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogEntry& from) {
+    LogEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "log_entry.LogEntry";
+  }
+  protected:
+  explicit LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCommandFieldNumber = 4,
+    kClientIdFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+    kIndexFieldNumber = 3,
+    kTermFieldNumber = 5,
+    kSequenceFieldNumber = 6,
+    kFirstUnackedSequenceFieldNumber = 7,
+  };
+  // string command = 4;
+  void clear_command();
+  const std::string& command() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_command(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_command();
+  PROTOBUF_NODISCARD std::string* release_command();
+  void set_allocated_command(std::string* command);
+  private:
+  const std::string& _internal_command() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
+  std::string* _internal_mutable_command();
+  public:
+
+  // uint32 client_id = 1;
+  void clear_client_id();
+  uint32_t client_id() const;
+  void set_client_id(uint32_t value);
+  private:
+  uint32_t _internal_client_id() const;
+  void _internal_set_client_id(uint32_t value);
+  public:
+
+  // uint32 leader_id = 2;
+  void clear_leader_id();
+  uint32_t leader_id() const;
+  void set_leader_id(uint32_t value);
+  private:
+  uint32_t _internal_leader_id() const;
+  void _internal_set_leader_id(uint32_t value);
+  public:
+
+  // uint32 index = 3;
+  void clear_index();
+  uint32_t index() const;
+  void set_index(uint32_t value);
+  private:
+  uint32_t _internal_index() const;
+  void _internal_set_index(uint32_t value);
+  public:
+
+  // uint32 term = 5;
+  void clear_term();
+  uint32_t term() const;
+  void set_term(uint32_t value);
+  private:
+  uint32_t _internal_term() const;
+  void _internal_set_term(uint32_t value);
+  public:
+
+  // uint64 sequence = 6;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // uint64 first_unacked_sequence = 7;
+  void clear_first_unacked_sequence();
+  uint64_t first_unacked_sequence() const;
+  void set_first_unacked_sequence(uint64_t value);
+  private:
+  uint64_t _internal_first_unacked_sequence() const;
+  void _internal_set_first_unacked_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:log_entry.LogEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+    uint32_t client_id_;
+    uint32_t leader_id_;
+    uint32_t index_;
+    uint32_t term_;
+    uint64_t sequence_;
+    uint64_t first_unacked_sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2flog_5fentry_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LogEntry
+
+// uint32 client_id = 1;
+inline void LogEntry::clear_client_id() {
+  _impl_.client_id_ = 0u;
+}
+inline uint32_t LogEntry::_internal_client_id() const {
+  return _impl_.client_id_;
+}
+inline uint32_t LogEntry::client_id() const {
+  // @@protoc_insertion_point(field_get:log_entry.LogEntry.client_id)
+  return _internal_client_id();
+}
+inline void LogEntry::_internal_set_client_id(uint32_t value) {
+  
+  _impl_.client_id_ = value;
+}
+inline void LogEntry::set_client_id(uint32_t value) {
+  _internal_set_client_id(value);
+  // @@protoc_insertion_point(field_set:log_entry.LogEntry.client_id)
+}
+
+// uint32 leader_id = 2;
+inline void LogEntry::clear_leader_id() {
+  _impl_.leader_id_ = 0u;
+}
+inline uint32_t LogEntry::_internal_leader_id() const {
+  return _impl_.leader_id_;
+}
+inline uint32_t LogEntry::leader_id() const {
+  // @@protoc_insertion_point(field_get:log_entry.LogEntry.leader_id)
+  return _internal_leader_id();
+}
+inline void LogEntry::_internal_set_leader_id(uint32_t value) {
+  
+  _impl_.leader_id_ = value;
+}
+inline void LogEntry::set_leader_id(uint32_t value) {
+  _internal_set_leader_id(value);
+  // @@protoc_insertion_point(field_set:log_entry.LogEntry.leader_id)
+}
+
+// uint32 index = 3;
+inline void LogEntry::clear_index() {
+  _impl_.index_ = 0u;
+}
+inline uint32_t LogEntry::_internal_index() const {
+  return _impl_.index_;
+}
+inline uint32_t LogEntry::index() const {
+  // @@protoc_insertion_point(field_get:log_entry.LogEntry.index)
+  return _internal_index();
+}
+inline void LogEntry::_internal_set_index(uint32_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void LogEntry::set_index(uint32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:log_entry.LogEntry.index)
+}
+
+// string command = 4;
+inline void LogEntry::clear_command() {
+  _impl_.command_.ClearToEmpty();
+}
+inline const std::string& LogEntry::command() const {
+  // @@protoc_insertion_point(field_get:log_entry.LogEntry.command)
+  return _internal_command();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogEntry::set_command(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.command_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:log_entry.LogEntry.command)
+}
+inline std::string* LogEntry::mutable_command() {
+  std::string* _s = _internal_mutable_command();
+  // @@protoc_insertion_point(field_mutable:log_entry.LogEntry.command)
+  return _s;
+}
+inline const std::string& LogEntry::_internal_command() const {
+  return _impl_.command_.Get();
+}
+inline void LogEntry::_internal_set_command(const std::string& value) {
+  
+  _impl_.command_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LogEntry::_internal_mutable_command() {
+  
+  return _impl_.command_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogEntry::release_command() {
+  // @@protoc_insertion_point(field_release:log_entry.LogEntry.command)
+  return _impl_.command_.Release();
+}
+inline void LogEntry::set_allocated_command(std::string* command) {
+  if (command != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.command_.SetAllocated(command, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:log_entry.LogEntry.command)
+}
+
+// uint32 term = 5;
+inline void LogEntry::clear_term() {
+  _impl_.term_ = 0u;
+}
+inline uint32_t LogEntry::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint32_t LogEntry::term() const {
+  // @@protoc_insertion_point(field_get:log_entry.LogEntry.term)
+  return _internal_term();
+}
+inline void LogEntry::_internal_set_term(uint32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void LogEntry::set_term(uint32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:log_entry.LogEntry.term)
+}
+
+// uint64 sequence = 6;
+inline void LogEntry::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t LogEntry::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t LogEntry::sequence() const {
+  // @@protoc_insertion_point(field_get:log_entry.LogEntry.sequence)
+  return _internal_sequence();
+}
+inline void LogEntry::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void LogEntry::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:log_entry.LogEntry.sequence)
+}
+
+// uint64 first_unacked_sequence = 7;
+inline void LogEntry::clear_first_unacked_sequence() {
+  _impl_.first_unacked_sequence_ = uint64_t{0u};
+}
+inline uint64_t LogEntry::_internal_first_unacked_sequence() const {
+  return _impl_.first_unacked_sequence_;
+}
+inline uint64_t LogEntry::first_unacked_sequence() const {
+  // @@protoc_insertion_point(field_get:log_entry.LogEntry.first_unacked_sequence)
+  return _internal_first_unacked_sequence();
+}
+inline void LogEntry::_internal_set_first_unacked_sequence(uint64_t value) {
+  
+  _impl_.first_unacked_sequence_ = value;
+}
+inline void LogEntry::set_first_unacked_sequence(uint64_t value) {
+  _internal_set_first_unacked_sequence(value);
+  // @@protoc_insertion_point(field_set:log_entry.LogEntry.first_unacked_sequence)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace log_entry
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2flog_5fentry_2eproto
@@ -0,0 +1,487 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/message.proto
+
+#include "proto/message.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace message {
+PROTOBUF_CONSTEXPR Message::Message(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.payload_)*/nullptr
+  , /*decltype(_impl_.source_id_)*/0u
+  , /*decltype(_impl_.dest_id_)*/0u
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.term_)*/0u
+  , /*decltype(_impl_.group_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageDefaultTypeInternal() {}
+  union {
+    Message _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageDefaultTypeInternal _Message_default_instance_;
+}  // namespace message
+static ::_pb::Metadata file_level_metadata_proto_2fmessage_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_proto_2fmessage_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fmessage_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fmessage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::message::Message, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::message::Message, _impl_.source_id_),
+  PROTOBUF_FIELD_OFFSET(::message::Message, _impl_.dest_id_),
+  PROTOBUF_FIELD_OFFSET(::message::Message, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::message::Message, _impl_.payload_),
+  PROTOBUF_FIELD_OFFSET(::message::Message, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::message::Message, _impl_.group_id_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::message::Message)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::message::_Message_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fmessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\023proto/message.proto\022\007message\032\031google/p"
+  "rotobuf/any.proto\"\230\001\n\007Message\022\021\n\tsource_"
+  "id\030\001 \001(\r\022\017\n\007dest_id\030\002 \001(\r\022\"\n\004type\030\003 \001(\0162"
+  "\024.message.MessageType\022%\n\007payload\030\004 \001(\0132\024"
+  ".google.protobuf.Any\022\014\n\004term\030\005 \001(\r\022\020\n\010gr"
+  "oup_id\030\006 \001(\r*\204\004\n\013MessageType\022\013\n\007UNKNOWN\020"
+  "\000\022\020\n\014VOTE_REQUEST\020\001\022\021\n\rVOTE_RESPONSE\020\002\022\032"
+  "\n\026APPEND_ENTRIES_REQUEST\020\003\022\033\n\027APPEND_ENT"
+  "RIES_RESPONSE\020\004\022\031\n\025COMMAND_ENTRY_REQUEST"
+  "\020\005\022\032\n\026COMMAND_ENTRY_RESPONSE\020\006\022\031\n\025SEARCH"
+  "_LEADER_REQUEST\020\007\022\032\n\026SEARCH_LEADER_RESPO"
+  "NSE\020\010\022\021\n\rCRASH_REQUEST\020\t\022\021\n\rSTART_REQUES"
+  "T\020\n\022\034\n\030ELECTION_TIMEOUT_REQUEST\020\013\022\021\n\rSPE"
+  "ED_REQUEST\020\014\022\010\n\004EXIT\020\r\022\034\n\030INSTALL_SNAPSH"
+  "OT_REQUEST\020\016\022\035\n\031INSTALL_SNAPSHOT_RESPONS"
+  "E\020\017\022\020\n\014READ_REQUEST\020\020\022\021\n\rREAD_RESPONSE\020\021"
+  "\022\024\n\020PRE_VOTE_REQUEST\020\022\022\025\n\021PRE_VOTE_RESPO"
+  "NSE\020\023\022\033\n\027TRANSFER_LEADER_REQUEST\020\024\022\017\n\013TI"
+  "MEOUT_NOW\020\025b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_proto_2fmessage_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2fany_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_proto_2fmessage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fmessage_2eproto = {
+    false, false, 739, descriptor_table_protodef_proto_2fmessage_2eproto,
+    "proto/message.proto",
+    &descriptor_table_proto_2fmessage_2eproto_once, descriptor_table_proto_2fmessage_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_proto_2fmessage_2eproto::offsets,
+    file_level_metadata_proto_2fmessage_2eproto, file_level_enum_descriptors_proto_2fmessage_2eproto,
+    file_level_service_descriptors_proto_2fmessage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fmessage_2eproto_getter() {
+  return &descriptor_table_proto_2fmessage_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fmessage_2eproto(&descriptor_table_proto_2fmessage_2eproto);
+namespace message {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_proto_2fmessage_2eproto);
+  return file_level_enum_descriptors_proto_2fmessage_2eproto[0];
+}
+bool MessageType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class Message::_Internal {
+ public:
+  static const ::PROTOBUF_NAMESPACE_ID::Any& payload(const Message* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::Any&
+Message::_Internal::payload(const Message* msg) {
+  return *msg->_impl_.payload_;
+}
+void Message::clear_payload() {
+  if (GetArenaForAllocation() == nullptr && _impl_.payload_ != nullptr) {
+    delete _impl_.payload_;
+  }
+  _impl_.payload_ = nullptr;
+}
+Message::Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:message.Message)
+}
+Message::Message(const Message& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.payload_){nullptr}
+    , decltype(_impl_.source_id_){}
+    , decltype(_impl_.dest_id_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.group_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_payload()) {
+    _this->_impl_.payload_ = new ::PROTOBUF_NAMESPACE_ID::Any(*from._impl_.payload_);
+  }
+  ::memcpy(&_impl_.source_id_, &from._impl_.source_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.group_id_) -
+    reinterpret_cast<char*>(&_impl_.source_id_)) + sizeof(_impl_.group_id_));
+  // @@protoc_insertion_point(copy_constructor:message.Message)
+}
+
+inline void Message::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.payload_){nullptr}
+    , decltype(_impl_.source_id_){0u}
+    , decltype(_impl_.dest_id_){0u}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.term_){0u}
+    , decltype(_impl_.group_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Message::~Message() {
+  // @@protoc_insertion_point(destructor:message.Message)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Message::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.payload_;
+}
+
+void Message::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message::Clear() {
+// @@protoc_insertion_point(message_clear_start:message.Message)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.payload_ != nullptr) {
+    delete _impl_.payload_;
+  }
+  _impl_.payload_ = nullptr;
+  ::memset(&_impl_.source_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.group_id_) -
+      reinterpret_cast<char*>(&_impl_.source_id_)) + sizeof(_impl_.group_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 source_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.source_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 dest_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.dest_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .message.MessageType type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::message::MessageType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.Any payload = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_payload(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 term = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 group_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.group_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:message.Message)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 source_id = 1;
+  if (this->_internal_source_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_source_id(), target);
+  }
+
+  // uint32 dest_id = 2;
+  if (this->_internal_dest_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_dest_id(), target);
+  }
+
+  // .message.MessageType type = 3;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_type(), target);
+  }
+
+  // .google.protobuf.Any payload = 4;
+  if (this->_internal_has_payload()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::payload(this),
+        _Internal::payload(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 term = 5;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_term(), target);
+  }
+
+  // uint32 group_id = 6;
+  if (this->_internal_group_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_group_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:message.Message)
+  return target;
+}
+
+size_t Message::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:message.Message)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .google.protobuf.Any payload = 4;
+  if (this->_internal_has_payload()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.payload_);
+  }
+
+  // uint32 source_id = 1;
+  if (this->_internal_source_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_source_id());
+  }
+
+  // uint32 dest_id = 2;
+  if (this->_internal_dest_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dest_id());
+  }
+
+  // .message.MessageType type = 3;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // uint32 term = 5;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_term());
+  }
+
+  // uint32 group_id = 6;
+  if (this->_internal_group_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_group_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message::GetClassData() const { return &_class_data_; }
+
+
+void Message::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message*>(&to_msg);
+  auto& from = static_cast<const Message&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:message.Message)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_payload()) {
+    _this->_internal_mutable_payload()->::PROTOBUF_NAMESPACE_ID::Any::MergeFrom(
+        from._internal_payload());
+  }
+  if (from._internal_source_id() != 0) {
+    _this->_internal_set_source_id(from._internal_source_id());
+  }
+  if (from._internal_dest_id() != 0) {
+    _this->_internal_set_dest_id(from._internal_dest_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_group_id() != 0) {
+    _this->_internal_set_group_id(from._internal_group_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message::CopyFrom(const Message& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:message.Message)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message::IsInitialized() const {
+  return true;
+}
+
+void Message::InternalSwap(Message* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message, _impl_.group_id_)
+      + sizeof(Message::_impl_.group_id_)
+      - PROTOBUF_FIELD_OFFSET(Message, _impl_.payload_)>(
+          reinterpret_cast<char*>(&_impl_.payload_),
+          reinterpret_cast<char*>(&other->_impl_.payload_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fmessage_2eproto_getter, &descriptor_table_proto_2fmessage_2eproto_once,
+      file_level_metadata_proto_2fmessage_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace message
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::message::Message*
+Arena::CreateMaybeMessage< ::message::Message >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::Message >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,533 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/message.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fmessage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fmessage_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/any.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fmessage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fmessage_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fmessage_2eproto;
+namespace message {
+class Message;
+struct MessageDefaultTypeInternal;
+extern MessageDefaultTypeInternal _Message_default_instance_;
+}  // namespace message
+PROTOBUF_NAMESPACE_OPEN
+template<> ::message::Message* Arena::CreateMaybeMessage<::message::Message>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace message {
+
+enum MessageType : int {
+  UNKNOWN = 0,
+  VOTE_REQUEST = 1,
+  VOTE_RESPONSE = 2,
+  APPEND_ENTRIES_REQUEST = 3,
+  APPEND_ENTRIES_RESPONSE = 4,
+  COMMAND_ENTRY_REQUEST = 5,
+  COMMAND_ENTRY_RESPONSE = 6,
+  SEARCH_LEADER_REQUEST = 7,
+  SEARCH_LEADER_RESPONSE = 8,
+  CRASH_REQUEST = 9,
+  START_REQUEST = 10,
+  ELECTION_TIMEOUT_REQUEST = 11,
+  SPEED_REQUEST = 12,
+  EXIT = 13,
+  INSTALL_SNAPSHOT_REQUEST = 14,
+  INSTALL_SNAPSHOT_RESPONSE = 15,
+  READ_REQUEST = 16,
+  READ_RESPONSE = 17,
+  PRE_VOTE_REQUEST = 18,
+  PRE_VOTE_RESPONSE = 19,
+  TRANSFER_LEADER_REQUEST = 20,
+  TIMEOUT_NOW = 21,
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool MessageType_IsValid(int value);
+constexpr MessageType MessageType_MIN = UNKNOWN;
+constexpr MessageType MessageType_MAX = TIMEOUT_NOW;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
+}
+inline bool MessageType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
+    MessageType_descriptor(), name, value);
+}
+// ===================================================================
+
+class Message final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.Message) */ {
+ public:
+  inline Message() : Message(nullptr) {}
+  ~Message() override;
+  explicit PROTOBUF_CONSTEXPR Message(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message(const Message& from);
+  Message(Message&& from) noexcept
+    : Message() {
+    *this = ::std::move(from);
+  }
+
+  inline Message& operator=(const Message& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message& operator=(Message&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message* internal_default_instance() {
+    return reinterpret_cast<const Message*>(
+               &_Message_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Message& a, Message& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message& from) {
+    Message::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.Message";
+  }
+  protected:
+  explicit Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPayloadFieldNumber = 4,
+    kSourceIdFieldNumber = 1,
+    kDestIdFieldNumber = 2,
+    kTypeFieldNumber = 3,
+    kTermFieldNumber = 5,
+    kGroupIdFieldNumber = 6,
+  };
+  // .google.protobuf.Any payload = 4;
+  bool has_payload() const;
+  private:
+  bool _internal_has_payload() const;
+  public:
+  void clear_payload();
+  const ::PROTOBUF_NAMESPACE_ID::Any& payload() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::Any* release_payload();
+  ::PROTOBUF_NAMESPACE_ID::Any* mutable_payload();
+  void set_allocated_payload(::PROTOBUF_NAMESPACE_ID::Any* payload);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Any& _internal_payload() const;
+  ::PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_payload();
+  public:
+  void unsafe_arena_set_allocated_payload(
+      ::PROTOBUF_NAMESPACE_ID::Any* payload);
+  ::PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_payload();
+
+  // uint32 source_id = 1;
+  void clear_source_id();
+  uint32_t source_id() const;
+  void set_source_id(uint32_t value);
+  private:
+  uint32_t _internal_source_id() const;
+  void _internal_set_source_id(uint32_t value);
+  public:
+
+  // uint32 dest_id = 2;
+  void clear_dest_id();
+  uint32_t dest_id() const;
+  void set_dest_id(uint32_t value);
+  private:
+  uint32_t _internal_dest_id() const;
+  void _internal_set_dest_id(uint32_t value);
+  public:
+
+  // .message.MessageType type = 3;
+  void clear_type();
+  ::message::MessageType type() const;
+  void set_type(::message::MessageType value);
+  private:
+  ::message::MessageType _internal_type() const;
+  void _internal_set_type(::message::MessageType value);
+  public:
+
+  // uint32 term = 5;
+  void clear_term();
+  uint32_t term() const;
+  void set_term(uint32_t value);
+  private:
+  uint32_t _internal_term() const;
+  void _internal_set_term(uint32_t value);
+  public:
+
+  // uint32 group_id = 6;
+  void clear_group_id();
+  uint32_t group_id() const;
+  void set_group_id(uint32_t value);
+  private:
+  uint32_t _internal_group_id() const;
+  void _internal_set_group_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.Message)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::Any* payload_;
+    uint32_t source_id_;
+    uint32_t dest_id_;
+    int type_;
+    uint32_t term_;
+    uint32_t group_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fmessage_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Message
+
+// uint32 source_id = 1;
+inline void Message::clear_source_id() {
+  _impl_.source_id_ = 0u;
+}
+inline uint32_t Message::_internal_source_id() const {
+  return _impl_.source_id_;
+}
+inline uint32_t Message::source_id() const {
+  // @@protoc_insertion_point(field_get:message.Message.source_id)
+  return _internal_source_id();
+}
+inline void Message::_internal_set_source_id(uint32_t value) {
+  
+  _impl_.source_id_ = value;
+}
+inline void Message::set_source_id(uint32_t value) {
+  _internal_set_source_id(value);
+  // @@protoc_insertion_point(field_set:message.Message.source_id)
+}
+
+// uint32 dest_id = 2;
+inline void Message::clear_dest_id() {
+  _impl_.dest_id_ = 0u;
+}
+inline uint32_t Message::_internal_dest_id() const {
+  return _impl_.dest_id_;
+}
+inline uint32_t Message::dest_id() const {
+  // @@protoc_insertion_point(field_get:message.Message.dest_id)
+  return _internal_dest_id();
+}
+inline void Message::_internal_set_dest_id(uint32_t value) {
+  
+  _impl_.dest_id_ = value;
+}
+inline void Message::set_dest_id(uint32_t value) {
+  _internal_set_dest_id(value);
+  // @@protoc_insertion_point(field_set:message.Message.dest_id)
+}
+
+// .message.MessageType type = 3;
+inline void Message::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::message::MessageType Message::_internal_type() const {
+  return static_cast< ::message::MessageType >(_impl_.type_);
+}
+inline ::message::MessageType Message::type() const {
+  // @@protoc_insertion_point(field_get:message.Message.type)
+  return _internal_type();
+}
+inline void Message::_internal_set_type(::message::MessageType value) {
+  
+  _impl_.type_ = value;
+}
+inline void Message::set_type(::message::MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:message.Message.type)
+}
+
+// .google.protobuf.Any payload = 4;
+inline bool Message::_internal_has_payload() const {
+  return this != internal_default_instance() && _impl_.payload_ != nullptr;
+}
+inline bool Message::has_payload() const {
+  return _internal_has_payload();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Any& Message::_internal_payload() const {
+  const ::PROTOBUF_NAMESPACE_ID::Any* p = _impl_.payload_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Any&>(
+      ::PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Any& Message::payload() const {
+  // @@protoc_insertion_point(field_get:message.Message.payload)
+  return _internal_payload();
+}
+inline void Message::unsafe_arena_set_allocated_payload(
+    ::PROTOBUF_NAMESPACE_ID::Any* payload) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.payload_);
+  }
+  _impl_.payload_ = payload;
+  if (payload) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:message.Message.payload)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* Message::release_payload() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Any* temp = _impl_.payload_;
+  _impl_.payload_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* Message::unsafe_arena_release_payload() {
+  // @@protoc_insertion_point(field_release:message.Message.payload)
+  
+  ::PROTOBUF_NAMESPACE_ID::Any* temp = _impl_.payload_;
+  _impl_.payload_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* Message::_internal_mutable_payload() {
+  
+  if (_impl_.payload_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Any>(GetArenaForAllocation());
+    _impl_.payload_ = p;
+  }
+  return _impl_.payload_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* Message::mutable_payload() {
+  ::PROTOBUF_NAMESPACE_ID::Any* _msg = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:message.Message.payload)
+  return _msg;
+}
+inline void Message::set_allocated_payload(::PROTOBUF_NAMESPACE_ID::Any* payload) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.payload_);
+  }
+  if (payload) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(payload));
+    if (message_arena != submessage_arena) {
+      payload = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, payload, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.payload_ = payload;
+  // @@protoc_insertion_point(field_set_allocated:message.Message.payload)
+}
+
+// uint32 term = 5;
+inline void Message::clear_term() {
+  _impl_.term_ = 0u;
+}
+inline uint32_t Message::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint32_t Message::term() const {
+  // @@protoc_insertion_point(field_get:message.Message.term)
+  return _internal_term();
+}
+inline void Message::_internal_set_term(uint32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void Message::set_term(uint32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:message.Message.term)
+}
+
+// uint32 group_id = 6;
+inline void Message::clear_group_id() {
+  _impl_.group_id_ = 0u;
+}
+inline uint32_t Message::_internal_group_id() const {
+  return _impl_.group_id_;
+}
+inline uint32_t Message::group_id() const {
+  // @@protoc_insertion_point(field_get:message.Message.group_id)
+  return _internal_group_id();
+}
+inline void Message::_internal_set_group_id(uint32_t value) {
+  
+  _impl_.group_id_ = value;
+}
+inline void Message::set_group_id(uint32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:message.Message.group_id)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace message
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::message::MessageType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::message::MessageType>() {
+  return ::message::MessageType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fmessage_2eproto
@@ -0,0 +1,274 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/message_batch.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fmessage_5fbatch_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fmessage_5fbatch_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "proto/message.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fmessage_5fbatch_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fmessage_5fbatch_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fmessage_5fbatch_2eproto;
+namespace message_batch {
+class MessageBatch;
+struct MessageBatchDefaultTypeInternal;
+extern MessageBatchDefaultTypeInternal _MessageBatch_default_instance_;
+}  // namespace message_batch
+PROTOBUF_NAMESPACE_OPEN
+template<> ::message_batch::MessageBatch* Arena::CreateMaybeMessage<::message_batch::MessageBatch>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace message_batch {
+
+// ===================================================================
+
+class MessageBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message_batch.MessageBatch) */ {
+ public:
+  inline MessageBatch() : MessageBatch(nullptr) {}
+  ~MessageBatch() override;
+  explicit PROTOBUF_CONSTEXPR MessageBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MessageBatch(const MessageBatch& from);
+  MessageBatch(MessageBatch&& from) noexcept
+    : MessageBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline MessageBatch& operator=(const MessageBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MessageBatch& operator=(MessageBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MessageBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MessageBatch* internal_default_instance() {
+    return reinterpret_cast<const MessageBatch*>(
+               &_MessageBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(MessageBatch& a, MessageBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MessageBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MessageBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MessageBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MessageBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MessageBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MessageBatch& from) {
+    MessageBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MessageBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message_batch.MessageBatch";
+  }
+  protected:
+  explicit MessageBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated .message.Message messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::message::Message* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::Message >*
+      mutable_messages();
+  private:
+  const ::message::Message& _internal_messages(int index) const;
+  ::message::Message* _internal_add_messages();
+  public:
+  const ::message::Message& messages(int index) const;
+  ::message::Message* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::Message >&
+      messages() const;
+
+  // @@protoc_insertion_point(class_scope:message_batch.MessageBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::Message > messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fmessage_5fbatch_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// MessageBatch
+
+// repeated .message.Message messages = 1;
+inline int MessageBatch::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int MessageBatch::messages_size() const {
+  return _internal_messages_size();
+}
+inline ::message::Message* MessageBatch::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:message_batch.MessageBatch.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::Message >*
+MessageBatch::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:message_batch.MessageBatch.messages)
+  return &_impl_.messages_;
+}
+inline const ::message::Message& MessageBatch::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::message::Message& MessageBatch::messages(int index) const {
+  // @@protoc_insertion_point(field_get:message_batch.MessageBatch.messages)
+  return _internal_messages(index);
+}
+inline ::message::Message* MessageBatch::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::message::Message* MessageBatch::add_messages() {
+  ::message::Message* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:message_batch.MessageBatch.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::Message >&
+MessageBatch::messages() const {
+  // @@protoc_insertion_point(field_list:message_batch.MessageBatch.messages)
+  return _impl_.messages_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace message_batch
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fmessage_5fbatch_2eproto
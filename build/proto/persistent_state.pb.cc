@@ -0,0 +1,370 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/persistent_state.proto
+
+#include "proto/persistent_state.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace persistent_state {
+PROTOBUF_CONSTEXPR PersistentState::PersistentState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.log_entries_)*/{}
+  , /*decltype(_impl_.voted_for_)*/nullptr
+  , /*decltype(_impl_.current_term_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PersistentStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PersistentStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PersistentStateDefaultTypeInternal() {}
+  union {
+    PersistentState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PersistentStateDefaultTypeInternal _PersistentState_default_instance_;
+}  // namespace persistent_state
+static ::_pb::Metadata file_level_metadata_proto_2fpersistent_5fstate_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_proto_2fpersistent_5fstate_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fpersistent_5fstate_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fpersistent_5fstate_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::persistent_state::PersistentState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::persistent_state::PersistentState, _impl_.current_term_),
+  PROTOBUF_FIELD_OFFSET(::persistent_state::PersistentState, _impl_.voted_for_),
+  PROTOBUF_FIELD_OFFSET(::persistent_state::PersistentState, _impl_.log_entries_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::persistent_state::PersistentState)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::persistent_state::_PersistentState_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fpersistent_5fstate_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\034proto/persistent_state.proto\022\020persiste"
+  "nt_state\032\036google/protobuf/wrappers.proto"
+  "\032\025proto/log_entry.proto\"\202\001\n\017PersistentSt"
+  "ate\022\024\n\014current_term\030\001 \001(\r\022/\n\tvoted_for\030\002"
+  " \001(\0132\034.google.protobuf.UInt32Value\022(\n\013lo"
+  "g_entries\030\003 \003(\0132\023.log_entry.LogEntryb\006pr"
+  "oto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_proto_2fpersistent_5fstate_2eproto_deps[2] = {
+  &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
+  &::descriptor_table_proto_2flog_5fentry_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_proto_2fpersistent_5fstate_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fpersistent_5fstate_2eproto = {
+    false, false, 244, descriptor_table_protodef_proto_2fpersistent_5fstate_2eproto,
+    "proto/persistent_state.proto",
+    &descriptor_table_proto_2fpersistent_5fstate_2eproto_once, descriptor_table_proto_2fpersistent_5fstate_2eproto_deps, 2, 1,
+    schemas, file_default_instances, TableStruct_proto_2fpersistent_5fstate_2eproto::offsets,
+    file_level_metadata_proto_2fpersistent_5fstate_2eproto, file_level_enum_descriptors_proto_2fpersistent_5fstate_2eproto,
+    file_level_service_descriptors_proto_2fpersistent_5fstate_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fpersistent_5fstate_2eproto_getter() {
+  return &descriptor_table_proto_2fpersistent_5fstate_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fpersistent_5fstate_2eproto(&descriptor_table_proto_2fpersistent_5fstate_2eproto);
+namespace persistent_state {
+
+// ===================================================================
+
+class PersistentState::_Internal {
+ public:
+  static const ::PROTOBUF_NAMESPACE_ID::UInt32Value& voted_for(const PersistentState* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::UInt32Value&
+PersistentState::_Internal::voted_for(const PersistentState* msg) {
+  return *msg->_impl_.voted_for_;
+}
+void PersistentState::clear_voted_for() {
+  if (GetArenaForAllocation() == nullptr && _impl_.voted_for_ != nullptr) {
+    delete _impl_.voted_for_;
+  }
+  _impl_.voted_for_ = nullptr;
+}
+void PersistentState::clear_log_entries() {
+  _impl_.log_entries_.Clear();
+}
+PersistentState::PersistentState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:persistent_state.PersistentState)
+}
+PersistentState::PersistentState(const PersistentState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PersistentState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.log_entries_){from._impl_.log_entries_}
+    , decltype(_impl_.voted_for_){nullptr}
+    , decltype(_impl_.current_term_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_voted_for()) {
+    _this->_impl_.voted_for_ = new ::PROTOBUF_NAMESPACE_ID::UInt32Value(*from._impl_.voted_for_);
+  }
+  _this->_impl_.current_term_ = from._impl_.current_term_;
+  // @@protoc_insertion_point(copy_constructor:persistent_state.PersistentState)
+}
+
+inline void PersistentState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.log_entries_){arena}
+    , decltype(_impl_.voted_for_){nullptr}
+    , decltype(_impl_.current_term_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PersistentState::~PersistentState() {
+  // @@protoc_insertion_point(destructor:persistent_state.PersistentState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PersistentState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.log_entries_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.voted_for_;
+}
+
+void PersistentState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PersistentState::Clear() {
+// @@protoc_insertion_point(message_clear_start:persistent_state.PersistentState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.log_entries_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.voted_for_ != nullptr) {
+    delete _impl_.voted_for_;
+  }
+  _impl_.voted_for_ = nullptr;
+  _impl_.current_term_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PersistentState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 current_term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.current_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value voted_for = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_voted_for(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .log_entry.LogEntry log_entries = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_log_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PersistentState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:persistent_state.PersistentState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 current_term = 1;
+  if (this->_internal_current_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_current_term(), target);
+  }
+
+  // .google.protobuf.UInt32Value voted_for = 2;
+  if (this->_internal_has_voted_for()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::voted_for(this),
+        _Internal::voted_for(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .log_entry.LogEntry log_entries = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_log_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_log_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:persistent_state.PersistentState)
+  return target;
+}
+
+size_t PersistentState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:persistent_state.PersistentState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .log_entry.LogEntry log_entries = 3;
+  total_size += 1UL * this->_internal_log_entries_size();
+  for (const auto& msg : this->_impl_.log_entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .google.protobuf.UInt32Value voted_for = 2;
+  if (this->_internal_has_voted_for()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.voted_for_);
+  }
+
+  // uint32 current_term = 1;
+  if (this->_internal_current_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_current_term());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PersistentState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PersistentState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PersistentState::GetClassData() const { return &_class_data_; }
+
+
+void PersistentState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PersistentState*>(&to_msg);
+  auto& from = static_cast<const PersistentState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:persistent_state.PersistentState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.log_entries_.MergeFrom(from._impl_.log_entries_);
+  if (from._internal_has_voted_for()) {
+    _this->_internal_mutable_voted_for()->::PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(
+        from._internal_voted_for());
+  }
+  if (from._internal_current_term() != 0) {
+    _this->_internal_set_current_term(from._internal_current_term());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PersistentState::CopyFrom(const PersistentState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:persistent_state.PersistentState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PersistentState::IsInitialized() const {
+  return true;
+}
+
+void PersistentState::InternalSwap(PersistentState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.log_entries_.InternalSwap(&other->_impl_.log_entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PersistentState, _impl_.current_term_)
+      + sizeof(PersistentState::_impl_.current_term_)
+      - PROTOBUF_FIELD_OFFSET(PersistentState, _impl_.voted_for_)>(
+          reinterpret_cast<char*>(&_impl_.voted_for_),
+          reinterpret_cast<char*>(&other->_impl_.voted_for_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PersistentState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fpersistent_5fstate_2eproto_getter, &descriptor_table_proto_2fpersistent_5fstate_2eproto_once,
+      file_level_metadata_proto_2fpersistent_5fstate_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace persistent_state
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::persistent_state::PersistentState*
+Arena::CreateMaybeMessage< ::persistent_state::PersistentState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::persistent_state::PersistentState >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
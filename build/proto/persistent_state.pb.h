@@ -0,0 +1,411 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/persistent_state.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fpersistent_5fstate_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fpersistent_5fstate_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/wrappers.pb.h>
+#include "proto/log_entry.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fpersistent_5fstate_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fpersistent_5fstate_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fpersistent_5fstate_2eproto;
+namespace persistent_state {
+class PersistentState;
+struct PersistentStateDefaultTypeInternal;
+extern PersistentStateDefaultTypeInternal _PersistentState_default_instance_;
+}  // namespace persistent_state
+PROTOBUF_NAMESPACE_OPEN
+template<> ::persistent_state::PersistentState* Arena::CreateMaybeMessage<::persistent_state::PersistentState>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace persistent_state {
+
+// ===================================================================
+
+class PersistentState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:persistent_state.PersistentState) */ {
+ public:
+  inline PersistentState() : PersistentState(nullptr) {}
+  ~PersistentState() override;
+  explicit PROTOBUF_CONSTEXPR PersistentState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PersistentState(const PersistentState& from);
+  PersistentState(PersistentState&& from) noexcept
+    : PersistentState() {
+    *this = ::std::move(from);
+  }
+
+  inline PersistentState& operator=(const PersistentState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PersistentState& operator=(PersistentState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PersistentState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PersistentState* internal_default_instance() {
+    return reinterpret_cast<const PersistentState*>(
+               &_PersistentState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PersistentState& a, PersistentState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PersistentState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PersistentState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PersistentState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PersistentState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PersistentState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PersistentState& from) {
+    PersistentState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PersistentState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "persistent_state.PersistentState";
+  }
+  protected:
+  explicit PersistentState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLogEntriesFieldNumber = 3,
+    kVotedForFieldNumber = 2,
+    kCurrentTermFieldNumber = 1,
+  };
+  // repeated .log_entry.LogEntry log_entries = 3;
+  int log_entries_size() const;
+  private:
+  int _internal_log_entries_size() const;
+  public:
+  void clear_log_entries();
+  ::log_entry::LogEntry* mutable_log_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::log_entry::LogEntry >*
+      mutable_log_entries();
+  private:
+  const ::log_entry::LogEntry& _internal_log_entries(int index) const;
+  ::log_entry::LogEntry* _internal_add_log_entries();
+  public:
+  const ::log_entry::LogEntry& log_entries(int index) const;
+  ::log_entry::LogEntry* add_log_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::log_entry::LogEntry >&
+      log_entries() const;
+
+  // .google.protobuf.UInt32Value voted_for = 2;
+  bool has_voted_for() const;
+  private:
+  bool _internal_has_voted_for() const;
+  public:
+  void clear_voted_for();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& voted_for() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::UInt32Value* release_voted_for();
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_voted_for();
+  void set_allocated_voted_for(::PROTOBUF_NAMESPACE_ID::UInt32Value* voted_for);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_voted_for() const;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_voted_for();
+  public:
+  void unsafe_arena_set_allocated_voted_for(
+      ::PROTOBUF_NAMESPACE_ID::UInt32Value* voted_for);
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* unsafe_arena_release_voted_for();
+
+  // uint32 current_term = 1;
+  void clear_current_term();
+  uint32_t current_term() const;
+  void set_current_term(uint32_t value);
+  private:
+  uint32_t _internal_current_term() const;
+  void _internal_set_current_term(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:persistent_state.PersistentState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::log_entry::LogEntry > log_entries_;
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* voted_for_;
+    uint32_t current_term_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fpersistent_5fstate_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PersistentState
+
+// uint32 current_term = 1;
+inline void PersistentState::clear_current_term() {
+  _impl_.current_term_ = 0u;
+}
+inline uint32_t PersistentState::_internal_current_term() const {
+  return _impl_.current_term_;
+}
+inline uint32_t PersistentState::current_term() const {
+  // @@protoc_insertion_point(field_get:persistent_state.PersistentState.current_term)
+  return _internal_current_term();
+}
+inline void PersistentState::_internal_set_current_term(uint32_t value) {
+  
+  _impl_.current_term_ = value;
+}
+inline void PersistentState::set_current_term(uint32_t value) {
+  _internal_set_current_term(value);
+  // @@protoc_insertion_point(field_set:persistent_state.PersistentState.current_term)
+}
+
+// .google.protobuf.UInt32Value voted_for = 2;
+inline bool PersistentState::_internal_has_voted_for() const {
+  return this != internal_default_instance() && _impl_.voted_for_ != nullptr;
+}
+inline bool PersistentState::has_voted_for() const {
+  return _internal_has_voted_for();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& PersistentState::_internal_voted_for() const {
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value* p = _impl_.voted_for_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::UInt32Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& PersistentState::voted_for() const {
+  // @@protoc_insertion_point(field_get:persistent_state.PersistentState.voted_for)
+  return _internal_voted_for();
+}
+inline void PersistentState::unsafe_arena_set_allocated_voted_for(
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* voted_for) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.voted_for_);
+  }
+  _impl_.voted_for_ = voted_for;
+  if (voted_for) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:persistent_state.PersistentState.voted_for)
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* PersistentState::release_voted_for() {
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.voted_for_;
+  _impl_.voted_for_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* PersistentState::unsafe_arena_release_voted_for() {
+  // @@protoc_insertion_point(field_release:persistent_state.PersistentState.voted_for)
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.voted_for_;
+  _impl_.voted_for_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* PersistentState::_internal_mutable_voted_for() {
+  
+  if (_impl_.voted_for_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaForAllocation());
+    _impl_.voted_for_ = p;
+  }
+  return _impl_.voted_for_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* PersistentState::mutable_voted_for() {
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _msg = _internal_mutable_voted_for();
+  // @@protoc_insertion_point(field_mutable:persistent_state.PersistentState.voted_for)
+  return _msg;
+}
+inline void PersistentState::set_allocated_voted_for(::PROTOBUF_NAMESPACE_ID::UInt32Value* voted_for) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.voted_for_);
+  }
+  if (voted_for) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(voted_for));
+    if (message_arena != submessage_arena) {
+      voted_for = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, voted_for, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.voted_for_ = voted_for;
+  // @@protoc_insertion_point(field_set_allocated:persistent_state.PersistentState.voted_for)
+}
+
+// repeated .log_entry.LogEntry log_entries = 3;
+inline int PersistentState::_internal_log_entries_size() const {
+  return _impl_.log_entries_.size();
+}
+inline int PersistentState::log_entries_size() const {
+  return _internal_log_entries_size();
+}
+inline ::log_entry::LogEntry* PersistentState::mutable_log_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:persistent_state.PersistentState.log_entries)
+  return _impl_.log_entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::log_entry::LogEntry >*
+PersistentState::mutable_log_entries() {
+  // @@protoc_insertion_point(field_mutable_list:persistent_state.PersistentState.log_entries)
+  return &_impl_.log_entries_;
+}
+inline const ::log_entry::LogEntry& PersistentState::_internal_log_entries(int index) const {
+  return _impl_.log_entries_.Get(index);
+}
+inline const ::log_entry::LogEntry& PersistentState::log_entries(int index) const {
+  // @@protoc_insertion_point(field_get:persistent_state.PersistentState.log_entries)
+  return _internal_log_entries(index);
+}
+inline ::log_entry::LogEntry* PersistentState::_internal_add_log_entries() {
+  return _impl_.log_entries_.Add();
+}
+inline ::log_entry::LogEntry* PersistentState::add_log_entries() {
+  ::log_entry::LogEntry* _add = _internal_add_log_entries();
+  // @@protoc_insertion_point(field_add:persistent_state.PersistentState.log_entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::log_entry::LogEntry >&
+PersistentState::log_entries() const {
+  // @@protoc_insertion_point(field_list:persistent_state.PersistentState.log_entries)
+  return _impl_.log_entries_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace persistent_state
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fpersistent_5fstate_2eproto
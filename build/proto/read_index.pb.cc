@@ -0,0 +1,803 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/read_index.proto
+
+#include "proto/read_index.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace read_index {
+PROTOBUF_CONSTEXPR ReadRequest::ReadRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.query_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.client_id_)*/nullptr
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadRequestDefaultTypeInternal() {}
+  union {
+    ReadRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadRequestDefaultTypeInternal _ReadRequest_default_instance_;
+PROTOBUF_CONSTEXPR ReadResponse::ReadResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leader_hint_)*/nullptr
+  , /*decltype(_impl_.client_id_)*/nullptr
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.read_index_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadResponseDefaultTypeInternal() {}
+  union {
+    ReadResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadResponseDefaultTypeInternal _ReadResponse_default_instance_;
+}  // namespace read_index
+static ::_pb::Metadata file_level_metadata_proto_2fread_5findex_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_proto_2fread_5findex_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fread_5findex_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fread_5findex_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadRequest, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadRequest, _impl_.client_id_),
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadRequest, _impl_.query_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadResponse, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadResponse, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadResponse, _impl_.read_index_),
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadResponse, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadResponse, _impl_.leader_hint_),
+  PROTOBUF_FIELD_OFFSET(::read_index::ReadResponse, _impl_.client_id_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::read_index::ReadRequest)},
+  { 9, -1, -1, sizeof(::read_index::ReadResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::read_index::_ReadRequest_default_instance_._instance,
+  &::read_index::_ReadResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fread_5findex_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026proto/read_index.proto\022\nread_index\032\036go"
+  "ogle/protobuf/wrappers.proto\"_\n\013ReadRequ"
+  "est\022\020\n\010sequence\030\001 \001(\004\022/\n\tclient_id\030\002 \001(\013"
+  "2\034.google.protobuf.UInt32Value\022\r\n\005query\030"
+  "\003 \001(\t\"\270\001\n\014ReadResponse\022\017\n\007success\030\001 \001(\010\022"
+  "\020\n\010sequence\030\002 \001(\004\022\022\n\nread_index\030\003 \001(\r\022\r\n"
+  "\005value\030\004 \001(\t\0221\n\013leader_hint\030\005 \001(\0132\034.goog"
+  "le.protobuf.UInt32Value\022/\n\tclient_id\030\006 \001"
+  "(\0132\034.google.protobuf.UInt32Valueb\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_proto_2fread_5findex_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2fwrappers_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_proto_2fread_5findex_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fread_5findex_2eproto = {
+    false, false, 360, descriptor_table_protodef_proto_2fread_5findex_2eproto,
+    "proto/read_index.proto",
+    &descriptor_table_proto_2fread_5findex_2eproto_once, descriptor_table_proto_2fread_5findex_2eproto_deps, 1, 2,
+    schemas, file_default_instances, TableStruct_proto_2fread_5findex_2eproto::offsets,
+    file_level_metadata_proto_2fread_5findex_2eproto, file_level_enum_descriptors_proto_2fread_5findex_2eproto,
+    file_level_service_descriptors_proto_2fread_5findex_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fread_5findex_2eproto_getter() {
+  return &descriptor_table_proto_2fread_5findex_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fread_5findex_2eproto(&descriptor_table_proto_2fread_5findex_2eproto);
+namespace read_index {
+
+// ===================================================================
+
+class ReadRequest::_Internal {
+ public:
+  static const ::PROTOBUF_NAMESPACE_ID::UInt32Value& client_id(const ReadRequest* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::UInt32Value&
+ReadRequest::_Internal::client_id(const ReadRequest* msg) {
+  return *msg->_impl_.client_id_;
+}
+void ReadRequest::clear_client_id() {
+  if (GetArenaForAllocation() == nullptr && _impl_.client_id_ != nullptr) {
+    delete _impl_.client_id_;
+  }
+  _impl_.client_id_ = nullptr;
+}
+ReadRequest::ReadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:read_index.ReadRequest)
+}
+ReadRequest::ReadRequest(const ReadRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.query_){}
+    , decltype(_impl_.client_id_){nullptr}
+    , decltype(_impl_.sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.query_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.query_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_query().empty()) {
+    _this->_impl_.query_.Set(from._internal_query(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_client_id()) {
+    _this->_impl_.client_id_ = new ::PROTOBUF_NAMESPACE_ID::UInt32Value(*from._impl_.client_id_);
+  }
+  _this->_impl_.sequence_ = from._impl_.sequence_;
+  // @@protoc_insertion_point(copy_constructor:read_index.ReadRequest)
+}
+
+inline void ReadRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.query_){}
+    , decltype(_impl_.client_id_){nullptr}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.query_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.query_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReadRequest::~ReadRequest() {
+  // @@protoc_insertion_point(destructor:read_index.ReadRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.query_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.client_id_;
+}
+
+void ReadRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:read_index.ReadRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.query_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.client_id_ != nullptr) {
+    delete _impl_.client_id_;
+  }
+  _impl_.client_id_ = nullptr;
+  _impl_.sequence_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 sequence = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value client_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_client_id(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string query = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_query();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "read_index.ReadRequest.query"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:read_index.ReadRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sequence(), target);
+  }
+
+  // .google.protobuf.UInt32Value client_id = 2;
+  if (this->_internal_has_client_id()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::client_id(this),
+        _Internal::client_id(this).GetCachedSize(), target, stream);
+  }
+
+  // string query = 3;
+  if (!this->_internal_query().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_query().data(), static_cast<int>(this->_internal_query().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "read_index.ReadRequest.query");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_query(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:read_index.ReadRequest)
+  return target;
+}
+
+size_t ReadRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:read_index.ReadRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string query = 3;
+  if (!this->_internal_query().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_query());
+  }
+
+  // .google.protobuf.UInt32Value client_id = 2;
+  if (this->_internal_has_client_id()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.client_id_);
+  }
+
+  // uint64 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReadRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadRequest*>(&to_msg);
+  auto& from = static_cast<const ReadRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:read_index.ReadRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_query().empty()) {
+    _this->_internal_set_query(from._internal_query());
+  }
+  if (from._internal_has_client_id()) {
+    _this->_internal_mutable_client_id()->::PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(
+        from._internal_client_id());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadRequest::CopyFrom(const ReadRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:read_index.ReadRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadRequest::IsInitialized() const {
+  return true;
+}
+
+void ReadRequest::InternalSwap(ReadRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.query_, lhs_arena,
+      &other->_impl_.query_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadRequest, _impl_.sequence_)
+      + sizeof(ReadRequest::_impl_.sequence_)
+      - PROTOBUF_FIELD_OFFSET(ReadRequest, _impl_.client_id_)>(
+          reinterpret_cast<char*>(&_impl_.client_id_),
+          reinterpret_cast<char*>(&other->_impl_.client_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fread_5findex_2eproto_getter, &descriptor_table_proto_2fread_5findex_2eproto_once,
+      file_level_metadata_proto_2fread_5findex_2eproto[0]);
+}
+
+// ===================================================================
+
+class ReadResponse::_Internal {
+ public:
+  static const ::PROTOBUF_NAMESPACE_ID::UInt32Value& leader_hint(const ReadResponse* msg);
+  static const ::PROTOBUF_NAMESPACE_ID::UInt32Value& client_id(const ReadResponse* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::UInt32Value&
+ReadResponse::_Internal::leader_hint(const ReadResponse* msg) {
+  return *msg->_impl_.leader_hint_;
+}
+const ::PROTOBUF_NAMESPACE_ID::UInt32Value&
+ReadResponse::_Internal::client_id(const ReadResponse* msg) {
+  return *msg->_impl_.client_id_;
+}
+void ReadResponse::clear_leader_hint() {
+  if (GetArenaForAllocation() == nullptr && _impl_.leader_hint_ != nullptr) {
+    delete _impl_.leader_hint_;
+  }
+  _impl_.leader_hint_ = nullptr;
+}
+void ReadResponse::clear_client_id() {
+  if (GetArenaForAllocation() == nullptr && _impl_.client_id_ != nullptr) {
+    delete _impl_.client_id_;
+  }
+  _impl_.client_id_ = nullptr;
+}
+ReadResponse::ReadResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:read_index.ReadResponse)
+}
+ReadResponse::ReadResponse(const ReadResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.leader_hint_){nullptr}
+    , decltype(_impl_.client_id_){nullptr}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.read_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_leader_hint()) {
+    _this->_impl_.leader_hint_ = new ::PROTOBUF_NAMESPACE_ID::UInt32Value(*from._impl_.leader_hint_);
+  }
+  if (from._internal_has_client_id()) {
+    _this->_impl_.client_id_ = new ::PROTOBUF_NAMESPACE_ID::UInt32Value(*from._impl_.client_id_);
+  }
+  ::memcpy(&_impl_.sequence_, &from._impl_.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.read_index_) -
+    reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.read_index_));
+  // @@protoc_insertion_point(copy_constructor:read_index.ReadResponse)
+}
+
+inline void ReadResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.leader_hint_){nullptr}
+    , decltype(_impl_.client_id_){nullptr}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.read_index_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReadResponse::~ReadResponse() {
+  // @@protoc_insertion_point(destructor:read_index.ReadResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.leader_hint_;
+  if (this != internal_default_instance()) delete _impl_.client_id_;
+}
+
+void ReadResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:read_index.ReadResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.leader_hint_ != nullptr) {
+    delete _impl_.leader_hint_;
+  }
+  _impl_.leader_hint_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.client_id_ != nullptr) {
+    delete _impl_.client_id_;
+  }
+  _impl_.client_id_ = nullptr;
+  ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.read_index_) -
+      reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.read_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sequence = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 read_index = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.read_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "read_index.ReadResponse.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value leader_hint = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_leader_hint(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.UInt32Value client_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_client_id(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:read_index.ReadResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
+  }
+
+  // uint64 sequence = 2;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sequence(), target);
+  }
+
+  // uint32 read_index = 3;
+  if (this->_internal_read_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_read_index(), target);
+  }
+
+  // string value = 4;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "read_index.ReadResponse.value");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_value(), target);
+  }
+
+  // .google.protobuf.UInt32Value leader_hint = 5;
+  if (this->_internal_has_leader_hint()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::leader_hint(this),
+        _Internal::leader_hint(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.UInt32Value client_id = 6;
+  if (this->_internal_has_client_id()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::client_id(this),
+        _Internal::client_id(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:read_index.ReadResponse)
+  return target;
+}
+
+size_t ReadResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:read_index.ReadResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string value = 4;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  // .google.protobuf.UInt32Value leader_hint = 5;
+  if (this->_internal_has_leader_hint()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.leader_hint_);
+  }
+
+  // .google.protobuf.UInt32Value client_id = 6;
+  if (this->_internal_has_client_id()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.client_id_);
+  }
+
+  // uint64 sequence = 2;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 read_index = 3;
+  if (this->_internal_read_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_read_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadResponse::GetClassData() const { return &_class_data_; }
+
+
+void ReadResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadResponse*>(&to_msg);
+  auto& from = static_cast<const ReadResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:read_index.ReadResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_has_leader_hint()) {
+    _this->_internal_mutable_leader_hint()->::PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(
+        from._internal_leader_hint());
+  }
+  if (from._internal_has_client_id()) {
+    _this->_internal_mutable_client_id()->::PROTOBUF_NAMESPACE_ID::UInt32Value::MergeFrom(
+        from._internal_client_id());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_read_index() != 0) {
+    _this->_internal_set_read_index(from._internal_read_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadResponse::CopyFrom(const ReadResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:read_index.ReadResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadResponse::IsInitialized() const {
+  return true;
+}
+
+void ReadResponse::InternalSwap(ReadResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadResponse, _impl_.read_index_)
+      + sizeof(ReadResponse::_impl_.read_index_)
+      - PROTOBUF_FIELD_OFFSET(ReadResponse, _impl_.leader_hint_)>(
+          reinterpret_cast<char*>(&_impl_.leader_hint_),
+          reinterpret_cast<char*>(&other->_impl_.leader_hint_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fread_5findex_2eproto_getter, &descriptor_table_proto_2fread_5findex_2eproto_once,
+      file_level_metadata_proto_2fread_5findex_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace read_index
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::read_index::ReadRequest*
+Arena::CreateMaybeMessage< ::read_index::ReadRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::read_index::ReadRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::read_index::ReadResponse*
+Arena::CreateMaybeMessage< ::read_index::ReadResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::read_index::ReadResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,935 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/read_index.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fread_5findex_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fread_5findex_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/wrappers.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fread_5findex_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fread_5findex_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fread_5findex_2eproto;
+namespace read_index {
+class ReadRequest;
+struct ReadRequestDefaultTypeInternal;
+extern ReadRequestDefaultTypeInternal _ReadRequest_default_instance_;
+class ReadResponse;
+struct ReadResponseDefaultTypeInternal;
+extern ReadResponseDefaultTypeInternal _ReadResponse_default_instance_;
+}  // namespace read_index
+PROTOBUF_NAMESPACE_OPEN
+template<> ::read_index::ReadRequest* Arena::CreateMaybeMessage<::read_index::ReadRequest>(Arena*);
+template<> ::read_index::ReadResponse* Arena::CreateMaybeMessage<::read_index::ReadResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace read_index {
+
+// ===================================================================
+
+class ReadRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:read_index.ReadRequest) */ {
+ public:
+  inline ReadRequest() : ReadRequest(nullptr) {}
+  ~ReadRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadRequest(const ReadRequest& from);
+  ReadRequest(ReadRequest&& from) noexcept
+    : ReadRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadRequest& operator=(const ReadRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadRequest& operator=(ReadRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadRequest*>(
+               &_ReadRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ReadRequest& a, ReadRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadRequest& from) {
+    ReadRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "read_index.ReadRequest";
+  }
+  protected:
+  explicit ReadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueryFieldNumber = 3,
+    kClientIdFieldNumber = 2,
+    kSequenceFieldNumber = 1,
+  };
+  // string query = 3;
+  void clear_query();
+  const std::string& query() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_query(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_query();
+  PROTOBUF_NODISCARD std::string* release_query();
+  void set_allocated_query(std::string* query);
+  private:
+  const std::string& _internal_query() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_query(const std::string& value);
+  std::string* _internal_mutable_query();
+  public:
+
+  // .google.protobuf.UInt32Value client_id = 2;
+  bool has_client_id() const;
+  private:
+  bool _internal_has_client_id() const;
+  public:
+  void clear_client_id();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& client_id() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::UInt32Value* release_client_id();
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_client_id();
+  void set_allocated_client_id(::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_client_id() const;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_client_id();
+  public:
+  void unsafe_arena_set_allocated_client_id(
+      ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id);
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* unsafe_arena_release_client_id();
+
+  // uint64 sequence = 1;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:read_index.ReadRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr query_;
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id_;
+    uint64_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fread_5findex_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:read_index.ReadResponse) */ {
+ public:
+  inline ReadResponse() : ReadResponse(nullptr) {}
+  ~ReadResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReadResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadResponse(const ReadResponse& from);
+  ReadResponse(ReadResponse&& from) noexcept
+    : ReadResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadResponse& operator=(const ReadResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadResponse& operator=(ReadResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadResponse* internal_default_instance() {
+    return reinterpret_cast<const ReadResponse*>(
+               &_ReadResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ReadResponse& a, ReadResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadResponse& from) {
+    ReadResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "read_index.ReadResponse";
+  }
+  protected:
+  explicit ReadResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 4,
+    kLeaderHintFieldNumber = 5,
+    kClientIdFieldNumber = 6,
+    kSequenceFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+    kReadIndexFieldNumber = 3,
+  };
+  // string value = 4;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // .google.protobuf.UInt32Value leader_hint = 5;
+  bool has_leader_hint() const;
+  private:
+  bool _internal_has_leader_hint() const;
+  public:
+  void clear_leader_hint();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& leader_hint() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::UInt32Value* release_leader_hint();
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_leader_hint();
+  void set_allocated_leader_hint(::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_hint);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_leader_hint() const;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_leader_hint();
+  public:
+  void unsafe_arena_set_allocated_leader_hint(
+      ::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_hint);
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* unsafe_arena_release_leader_hint();
+
+  // .google.protobuf.UInt32Value client_id = 6;
+  bool has_client_id() const;
+  private:
+  bool _internal_has_client_id() const;
+  public:
+  void clear_client_id();
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& client_id() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::UInt32Value* release_client_id();
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* mutable_client_id();
+  void set_allocated_client_id(::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value& _internal_client_id() const;
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _internal_mutable_client_id();
+  public:
+  void unsafe_arena_set_allocated_client_id(
+      ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id);
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* unsafe_arena_release_client_id();
+
+  // uint64 sequence = 2;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // uint32 read_index = 3;
+  void clear_read_index();
+  uint32_t read_index() const;
+  void set_read_index(uint32_t value);
+  private:
+  uint32_t _internal_read_index() const;
+  void _internal_set_read_index(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:read_index.ReadResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_hint_;
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id_;
+    uint64_t sequence_;
+    bool success_;
+    uint32_t read_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fread_5findex_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ReadRequest
+
+// uint64 sequence = 1;
+inline void ReadRequest::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t ReadRequest::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t ReadRequest::sequence() const {
+  // @@protoc_insertion_point(field_get:read_index.ReadRequest.sequence)
+  return _internal_sequence();
+}
+inline void ReadRequest::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void ReadRequest::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:read_index.ReadRequest.sequence)
+}
+
+// .google.protobuf.UInt32Value client_id = 2;
+inline bool ReadRequest::_internal_has_client_id() const {
+  return this != internal_default_instance() && _impl_.client_id_ != nullptr;
+}
+inline bool ReadRequest::has_client_id() const {
+  return _internal_has_client_id();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& ReadRequest::_internal_client_id() const {
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value* p = _impl_.client_id_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::UInt32Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& ReadRequest::client_id() const {
+  // @@protoc_insertion_point(field_get:read_index.ReadRequest.client_id)
+  return _internal_client_id();
+}
+inline void ReadRequest::unsafe_arena_set_allocated_client_id(
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.client_id_);
+  }
+  _impl_.client_id_ = client_id;
+  if (client_id) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:read_index.ReadRequest.client_id)
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadRequest::release_client_id() {
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.client_id_;
+  _impl_.client_id_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadRequest::unsafe_arena_release_client_id() {
+  // @@protoc_insertion_point(field_release:read_index.ReadRequest.client_id)
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.client_id_;
+  _impl_.client_id_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadRequest::_internal_mutable_client_id() {
+  
+  if (_impl_.client_id_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaForAllocation());
+    _impl_.client_id_ = p;
+  }
+  return _impl_.client_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadRequest::mutable_client_id() {
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _msg = _internal_mutable_client_id();
+  // @@protoc_insertion_point(field_mutable:read_index.ReadRequest.client_id)
+  return _msg;
+}
+inline void ReadRequest::set_allocated_client_id(::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.client_id_);
+  }
+  if (client_id) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(client_id));
+    if (message_arena != submessage_arena) {
+      client_id = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, client_id, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.client_id_ = client_id;
+  // @@protoc_insertion_point(field_set_allocated:read_index.ReadRequest.client_id)
+}
+
+// string query = 3;
+inline void ReadRequest::clear_query() {
+  _impl_.query_.ClearToEmpty();
+}
+inline const std::string& ReadRequest::query() const {
+  // @@protoc_insertion_point(field_get:read_index.ReadRequest.query)
+  return _internal_query();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadRequest::set_query(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.query_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:read_index.ReadRequest.query)
+}
+inline std::string* ReadRequest::mutable_query() {
+  std::string* _s = _internal_mutable_query();
+  // @@protoc_insertion_point(field_mutable:read_index.ReadRequest.query)
+  return _s;
+}
+inline const std::string& ReadRequest::_internal_query() const {
+  return _impl_.query_.Get();
+}
+inline void ReadRequest::_internal_set_query(const std::string& value) {
+  
+  _impl_.query_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReadRequest::_internal_mutable_query() {
+  
+  return _impl_.query_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReadRequest::release_query() {
+  // @@protoc_insertion_point(field_release:read_index.ReadRequest.query)
+  return _impl_.query_.Release();
+}
+inline void ReadRequest::set_allocated_query(std::string* query) {
+  if (query != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.query_.SetAllocated(query, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.query_.IsDefault()) {
+    _impl_.query_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:read_index.ReadRequest.query)
+}
+
+// -------------------------------------------------------------------
+
+// ReadResponse
+
+// bool success = 1;
+inline void ReadResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool ReadResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool ReadResponse::success() const {
+  // @@protoc_insertion_point(field_get:read_index.ReadResponse.success)
+  return _internal_success();
+}
+inline void ReadResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void ReadResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:read_index.ReadResponse.success)
+}
+
+// uint64 sequence = 2;
+inline void ReadResponse::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t ReadResponse::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t ReadResponse::sequence() const {
+  // @@protoc_insertion_point(field_get:read_index.ReadResponse.sequence)
+  return _internal_sequence();
+}
+inline void ReadResponse::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void ReadResponse::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:read_index.ReadResponse.sequence)
+}
+
+// uint32 read_index = 3;
+inline void ReadResponse::clear_read_index() {
+  _impl_.read_index_ = 0u;
+}
+inline uint32_t ReadResponse::_internal_read_index() const {
+  return _impl_.read_index_;
+}
+inline uint32_t ReadResponse::read_index() const {
+  // @@protoc_insertion_point(field_get:read_index.ReadResponse.read_index)
+  return _internal_read_index();
+}
+inline void ReadResponse::_internal_set_read_index(uint32_t value) {
+  
+  _impl_.read_index_ = value;
+}
+inline void ReadResponse::set_read_index(uint32_t value) {
+  _internal_set_read_index(value);
+  // @@protoc_insertion_point(field_set:read_index.ReadResponse.read_index)
+}
+
+// string value = 4;
+inline void ReadResponse::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& ReadResponse::value() const {
+  // @@protoc_insertion_point(field_get:read_index.ReadResponse.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:read_index.ReadResponse.value)
+}
+inline std::string* ReadResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:read_index.ReadResponse.value)
+  return _s;
+}
+inline const std::string& ReadResponse::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void ReadResponse::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReadResponse::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReadResponse::release_value() {
+  // @@protoc_insertion_point(field_release:read_index.ReadResponse.value)
+  return _impl_.value_.Release();
+}
+inline void ReadResponse::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:read_index.ReadResponse.value)
+}
+
+// .google.protobuf.UInt32Value leader_hint = 5;
+inline bool ReadResponse::_internal_has_leader_hint() const {
+  return this != internal_default_instance() && _impl_.leader_hint_ != nullptr;
+}
+inline bool ReadResponse::has_leader_hint() const {
+  return _internal_has_leader_hint();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& ReadResponse::_internal_leader_hint() const {
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value* p = _impl_.leader_hint_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::UInt32Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& ReadResponse::leader_hint() const {
+  // @@protoc_insertion_point(field_get:read_index.ReadResponse.leader_hint)
+  return _internal_leader_hint();
+}
+inline void ReadResponse::unsafe_arena_set_allocated_leader_hint(
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_hint) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.leader_hint_);
+  }
+  _impl_.leader_hint_ = leader_hint;
+  if (leader_hint) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:read_index.ReadResponse.leader_hint)
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadResponse::release_leader_hint() {
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.leader_hint_;
+  _impl_.leader_hint_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadResponse::unsafe_arena_release_leader_hint() {
+  // @@protoc_insertion_point(field_release:read_index.ReadResponse.leader_hint)
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.leader_hint_;
+  _impl_.leader_hint_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadResponse::_internal_mutable_leader_hint() {
+  
+  if (_impl_.leader_hint_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaForAllocation());
+    _impl_.leader_hint_ = p;
+  }
+  return _impl_.leader_hint_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadResponse::mutable_leader_hint() {
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _msg = _internal_mutable_leader_hint();
+  // @@protoc_insertion_point(field_mutable:read_index.ReadResponse.leader_hint)
+  return _msg;
+}
+inline void ReadResponse::set_allocated_leader_hint(::PROTOBUF_NAMESPACE_ID::UInt32Value* leader_hint) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.leader_hint_);
+  }
+  if (leader_hint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(leader_hint));
+    if (message_arena != submessage_arena) {
+      leader_hint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, leader_hint, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.leader_hint_ = leader_hint;
+  // @@protoc_insertion_point(field_set_allocated:read_index.ReadResponse.leader_hint)
+}
+
+// .google.protobuf.UInt32Value client_id = 6;
+inline bool ReadResponse::_internal_has_client_id() const {
+  return this != internal_default_instance() && _impl_.client_id_ != nullptr;
+}
+inline bool ReadResponse::has_client_id() const {
+  return _internal_has_client_id();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& ReadResponse::_internal_client_id() const {
+  const ::PROTOBUF_NAMESPACE_ID::UInt32Value* p = _impl_.client_id_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::UInt32Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_UInt32Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::UInt32Value& ReadResponse::client_id() const {
+  // @@protoc_insertion_point(field_get:read_index.ReadResponse.client_id)
+  return _internal_client_id();
+}
+inline void ReadResponse::unsafe_arena_set_allocated_client_id(
+    ::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.client_id_);
+  }
+  _impl_.client_id_ = client_id;
+  if (client_id) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:read_index.ReadResponse.client_id)
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadResponse::release_client_id() {
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.client_id_;
+  _impl_.client_id_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadResponse::unsafe_arena_release_client_id() {
+  // @@protoc_insertion_point(field_release:read_index.ReadResponse.client_id)
+  
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* temp = _impl_.client_id_;
+  _impl_.client_id_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadResponse::_internal_mutable_client_id() {
+  
+  if (_impl_.client_id_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::UInt32Value>(GetArenaForAllocation());
+    _impl_.client_id_ = p;
+  }
+  return _impl_.client_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::UInt32Value* ReadResponse::mutable_client_id() {
+  ::PROTOBUF_NAMESPACE_ID::UInt32Value* _msg = _internal_mutable_client_id();
+  // @@protoc_insertion_point(field_mutable:read_index.ReadResponse.client_id)
+  return _msg;
+}
+inline void ReadResponse::set_allocated_client_id(::PROTOBUF_NAMESPACE_ID::UInt32Value* client_id) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.client_id_);
+  }
+  if (client_id) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(client_id));
+    if (message_arena != submessage_arena) {
+      client_id = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, client_id, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.client_id_ = client_id;
+  // @@protoc_insertion_point(field_set_allocated:read_index.ReadResponse.client_id)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace read_index
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fread_5findex_2eproto
@@ -0,0 +1,247 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/search_leader.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fsearch_5fleader_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fsearch_5fleader_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fsearch_5fleader_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fsearch_5fleader_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fsearch_5fleader_2eproto;
+namespace search_leader {
+class SearchLeaderResponse;
+struct SearchLeaderResponseDefaultTypeInternal;
+extern SearchLeaderResponseDefaultTypeInternal _SearchLeaderResponse_default_instance_;
+}  // namespace search_leader
+PROTOBUF_NAMESPACE_OPEN
+template<> ::search_leader::SearchLeaderResponse* Arena::CreateMaybeMessage<::search_leader::SearchLeaderResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace search_leader {
+
+// ===================================================================
+
+class SearchLeaderResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:search_leader.SearchLeaderResponse) */ {
+ public:
+  inline SearchLeaderResponse() : SearchLeaderResponse(nullptr) {}
+  ~SearchLeaderResponse() override;
+  explicit PROTOBUF_CONSTEXPR SearchLeaderResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SearchLeaderResponse(const SearchLeaderResponse& from);
+  SearchLeaderResponse(SearchLeaderResponse&& from) noexcept
+    : SearchLeaderResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchLeaderResponse& operator=(const SearchLeaderResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchLeaderResponse& operator=(SearchLeaderResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchLeaderResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchLeaderResponse* internal_default_instance() {
+    return reinterpret_cast<const SearchLeaderResponse*>(
+               &_SearchLeaderResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SearchLeaderResponse& a, SearchLeaderResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchLeaderResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchLeaderResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SearchLeaderResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchLeaderResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchLeaderResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchLeaderResponse& from) {
+    SearchLeaderResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchLeaderResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "search_leader.SearchLeaderResponse";
+  }
+  protected:
+  explicit SearchLeaderResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLeaderIdFieldNumber = 1,
+  };
+  // uint32 leader_id = 1;
+  void clear_leader_id();
+  uint32_t leader_id() const;
+  void set_leader_id(uint32_t value);
+  private:
+  uint32_t _internal_leader_id() const;
+  void _internal_set_leader_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:search_leader.SearchLeaderResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t leader_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fsearch_5fleader_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SearchLeaderResponse
+
+// uint32 leader_id = 1;
+inline void SearchLeaderResponse::clear_leader_id() {
+  _impl_.leader_id_ = 0u;
+}
+inline uint32_t SearchLeaderResponse::_internal_leader_id() const {
+  return _impl_.leader_id_;
+}
+inline uint32_t SearchLeaderResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:search_leader.SearchLeaderResponse.leader_id)
+  return _internal_leader_id();
+}
+inline void SearchLeaderResponse::_internal_set_leader_id(uint32_t value) {
+  
+  _impl_.leader_id_ = value;
+}
+inline void SearchLeaderResponse::set_leader_id(uint32_t value) {
+  _internal_set_leader_id(value);
+  // @@protoc_insertion_point(field_set:search_leader.SearchLeaderResponse.leader_id)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace search_leader
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fsearch_5fleader_2eproto
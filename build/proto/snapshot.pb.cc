@@ -0,0 +1,902 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/snapshot.proto
+
+#include "proto/snapshot.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace snapshot {
+PROTOBUF_CONSTEXPR ClientSession::ClientSession(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.applied_sequences_)*/{}
+  , /*decltype(_impl_._applied_sequences_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.first_unacked_sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.client_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClientSessionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClientSessionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClientSessionDefaultTypeInternal() {}
+  union {
+    ClientSession _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientSessionDefaultTypeInternal _ClientSession_default_instance_;
+PROTOBUF_CONSTEXPR Snapshot::Snapshot(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.last_included_index_)*/0u
+  , /*decltype(_impl_.last_included_term_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SnapshotDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SnapshotDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SnapshotDefaultTypeInternal() {}
+  union {
+    Snapshot _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SnapshotDefaultTypeInternal _Snapshot_default_instance_;
+PROTOBUF_CONSTEXPR AppliedState::AppliedState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sessions_)*/{}
+  , /*decltype(_impl_.state_machine_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppliedStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppliedStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppliedStateDefaultTypeInternal() {}
+  union {
+    AppliedState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppliedStateDefaultTypeInternal _AppliedState_default_instance_;
+}  // namespace snapshot
+static ::_pb::Metadata file_level_metadata_proto_2fsnapshot_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_proto_2fsnapshot_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fsnapshot_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fsnapshot_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::snapshot::ClientSession, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::snapshot::ClientSession, _impl_.client_id_),
+  PROTOBUF_FIELD_OFFSET(::snapshot::ClientSession, _impl_.first_unacked_sequence_),
+  PROTOBUF_FIELD_OFFSET(::snapshot::ClientSession, _impl_.applied_sequences_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::snapshot::Snapshot, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::snapshot::Snapshot, _impl_.last_included_index_),
+  PROTOBUF_FIELD_OFFSET(::snapshot::Snapshot, _impl_.last_included_term_),
+  PROTOBUF_FIELD_OFFSET(::snapshot::Snapshot, _impl_.data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::snapshot::AppliedState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::snapshot::AppliedState, _impl_.sessions_),
+  PROTOBUF_FIELD_OFFSET(::snapshot::AppliedState, _impl_.state_machine_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::snapshot::ClientSession)},
+  { 9, -1, -1, sizeof(::snapshot::Snapshot)},
+  { 18, -1, -1, sizeof(::snapshot::AppliedState)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::snapshot::_ClientSession_default_instance_._instance,
+  &::snapshot::_Snapshot_default_instance_._instance,
+  &::snapshot::_AppliedState_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fsnapshot_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024proto/snapshot.proto\022\010snapshot\"c\n\rClie"
+  "ntSession\022\021\n\tclient_id\030\001 \001(\r\022\036\n\026first_un"
+  "acked_sequence\030\003 \001(\004\022\031\n\021applied_sequence"
+  "s\030\004 \003(\004J\004\010\002\020\003\"Q\n\010Snapshot\022\033\n\023last_includ"
+  "ed_index\030\001 \001(\r\022\032\n\022last_included_term\030\002 \001"
+  "(\r\022\014\n\004data\030\003 \001(\014\"V\n\014AppliedState\022)\n\010sess"
+  "ions\030\001 \003(\0132\027.snapshot.ClientSession\022\025\n\rs"
+  "tate_machine\030\003 \001(\014J\004\010\002\020\003b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_proto_2fsnapshot_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fsnapshot_2eproto = {
+    false, false, 312, descriptor_table_protodef_proto_2fsnapshot_2eproto,
+    "proto/snapshot.proto",
+    &descriptor_table_proto_2fsnapshot_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_proto_2fsnapshot_2eproto::offsets,
+    file_level_metadata_proto_2fsnapshot_2eproto, file_level_enum_descriptors_proto_2fsnapshot_2eproto,
+    file_level_service_descriptors_proto_2fsnapshot_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fsnapshot_2eproto_getter() {
+  return &descriptor_table_proto_2fsnapshot_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fsnapshot_2eproto(&descriptor_table_proto_2fsnapshot_2eproto);
+namespace snapshot {
+
+// ===================================================================
+
+class ClientSession::_Internal {
+ public:
+};
+
+ClientSession::ClientSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:snapshot.ClientSession)
+}
+ClientSession::ClientSession(const ClientSession& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClientSession* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applied_sequences_){from._impl_.applied_sequences_}
+    , /*decltype(_impl_._applied_sequences_cached_byte_size_)*/{0}
+    , decltype(_impl_.first_unacked_sequence_){}
+    , decltype(_impl_.client_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.first_unacked_sequence_, &from._impl_.first_unacked_sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.client_id_) -
+    reinterpret_cast<char*>(&_impl_.first_unacked_sequence_)) + sizeof(_impl_.client_id_));
+  // @@protoc_insertion_point(copy_constructor:snapshot.ClientSession)
+}
+
+inline void ClientSession::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applied_sequences_){arena}
+    , /*decltype(_impl_._applied_sequences_cached_byte_size_)*/{0}
+    , decltype(_impl_.first_unacked_sequence_){uint64_t{0u}}
+    , decltype(_impl_.client_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ClientSession::~ClientSession() {
+  // @@protoc_insertion_point(destructor:snapshot.ClientSession)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClientSession::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.applied_sequences_.~RepeatedField();
+}
+
+void ClientSession::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClientSession::Clear() {
+// @@protoc_insertion_point(message_clear_start:snapshot.ClientSession)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.applied_sequences_.Clear();
+  ::memset(&_impl_.first_unacked_sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.client_id_) -
+      reinterpret_cast<char*>(&_impl_.first_unacked_sequence_)) + sizeof(_impl_.client_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClientSession::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 client_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.client_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 first_unacked_sequence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.first_unacked_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 applied_sequences = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_applied_sequences(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_applied_sequences(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClientSession::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:snapshot.ClientSession)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 client_id = 1;
+  if (this->_internal_client_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_client_id(), target);
+  }
+
+  // uint64 first_unacked_sequence = 3;
+  if (this->_internal_first_unacked_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_first_unacked_sequence(), target);
+  }
+
+  // repeated uint64 applied_sequences = 4;
+  {
+    int byte_size = _impl_._applied_sequences_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          4, _internal_applied_sequences(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:snapshot.ClientSession)
+  return target;
+}
+
+size_t ClientSession::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:snapshot.ClientSession)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 applied_sequences = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.applied_sequences_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._applied_sequences_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint64 first_unacked_sequence = 3;
+  if (this->_internal_first_unacked_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_first_unacked_sequence());
+  }
+
+  // uint32 client_id = 1;
+  if (this->_internal_client_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientSession::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClientSession::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientSession::GetClassData() const { return &_class_data_; }
+
+
+void ClientSession::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClientSession*>(&to_msg);
+  auto& from = static_cast<const ClientSession&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:snapshot.ClientSession)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.applied_sequences_.MergeFrom(from._impl_.applied_sequences_);
+  if (from._internal_first_unacked_sequence() != 0) {
+    _this->_internal_set_first_unacked_sequence(from._internal_first_unacked_sequence());
+  }
+  if (from._internal_client_id() != 0) {
+    _this->_internal_set_client_id(from._internal_client_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClientSession::CopyFrom(const ClientSession& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:snapshot.ClientSession)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClientSession::IsInitialized() const {
+  return true;
+}
+
+void ClientSession::InternalSwap(ClientSession* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.applied_sequences_.InternalSwap(&other->_impl_.applied_sequences_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClientSession, _impl_.client_id_)
+      + sizeof(ClientSession::_impl_.client_id_)
+      - PROTOBUF_FIELD_OFFSET(ClientSession, _impl_.first_unacked_sequence_)>(
+          reinterpret_cast<char*>(&_impl_.first_unacked_sequence_),
+          reinterpret_cast<char*>(&other->_impl_.first_unacked_sequence_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClientSession::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fsnapshot_2eproto_getter, &descriptor_table_proto_2fsnapshot_2eproto_once,
+      file_level_metadata_proto_2fsnapshot_2eproto[0]);
+}
+
+// ===================================================================
+
+class Snapshot::_Internal {
+ public:
+};
+
+Snapshot::Snapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:snapshot.Snapshot)
+}
+Snapshot::Snapshot(const Snapshot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Snapshot* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.last_included_index_){}
+    , decltype(_impl_.last_included_term_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.last_included_index_, &from._impl_.last_included_index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_included_term_) -
+    reinterpret_cast<char*>(&_impl_.last_included_index_)) + sizeof(_impl_.last_included_term_));
+  // @@protoc_insertion_point(copy_constructor:snapshot.Snapshot)
+}
+
+inline void Snapshot::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.last_included_index_){0u}
+    , decltype(_impl_.last_included_term_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Snapshot::~Snapshot() {
+  // @@protoc_insertion_point(destructor:snapshot.Snapshot)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Snapshot::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void Snapshot::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Snapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:snapshot.Snapshot)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.last_included_index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.last_included_term_) -
+      reinterpret_cast<char*>(&_impl_.last_included_index_)) + sizeof(_impl_.last_included_term_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Snapshot::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 last_included_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.last_included_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 last_included_term = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.last_included_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Snapshot::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:snapshot.Snapshot)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 last_included_index = 1;
+  if (this->_internal_last_included_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_last_included_index(), target);
+  }
+
+  // uint32 last_included_term = 2;
+  if (this->_internal_last_included_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_last_included_term(), target);
+  }
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:snapshot.Snapshot)
+  return target;
+}
+
+size_t Snapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:snapshot.Snapshot)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // uint32 last_included_index = 1;
+  if (this->_internal_last_included_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_last_included_index());
+  }
+
+  // uint32 last_included_term = 2;
+  if (this->_internal_last_included_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_last_included_term());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Snapshot::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Snapshot::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Snapshot::GetClassData() const { return &_class_data_; }
+
+
+void Snapshot::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Snapshot*>(&to_msg);
+  auto& from = static_cast<const Snapshot&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:snapshot.Snapshot)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_last_included_index() != 0) {
+    _this->_internal_set_last_included_index(from._internal_last_included_index());
+  }
+  if (from._internal_last_included_term() != 0) {
+    _this->_internal_set_last_included_term(from._internal_last_included_term());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Snapshot::CopyFrom(const Snapshot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:snapshot.Snapshot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Snapshot::IsInitialized() const {
+  return true;
+}
+
+void Snapshot::InternalSwap(Snapshot* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Snapshot, _impl_.last_included_term_)
+      + sizeof(Snapshot::_impl_.last_included_term_)
+      - PROTOBUF_FIELD_OFFSET(Snapshot, _impl_.last_included_index_)>(
+          reinterpret_cast<char*>(&_impl_.last_included_index_),
+          reinterpret_cast<char*>(&other->_impl_.last_included_index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Snapshot::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fsnapshot_2eproto_getter, &descriptor_table_proto_2fsnapshot_2eproto_once,
+      file_level_metadata_proto_2fsnapshot_2eproto[1]);
+}
+
+// ===================================================================
+
+class AppliedState::_Internal {
+ public:
+};
+
+AppliedState::AppliedState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:snapshot.AppliedState)
+}
+AppliedState::AppliedState(const AppliedState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppliedState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sessions_){from._impl_.sessions_}
+    , decltype(_impl_.state_machine_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.state_machine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_machine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_state_machine().empty()) {
+    _this->_impl_.state_machine_.Set(from._internal_state_machine(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:snapshot.AppliedState)
+}
+
+inline void AppliedState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sessions_){arena}
+    , decltype(_impl_.state_machine_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.state_machine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_machine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AppliedState::~AppliedState() {
+  // @@protoc_insertion_point(destructor:snapshot.AppliedState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AppliedState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sessions_.~RepeatedPtrField();
+  _impl_.state_machine_.Destroy();
+}
+
+void AppliedState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AppliedState::Clear() {
+// @@protoc_insertion_point(message_clear_start:snapshot.AppliedState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sessions_.Clear();
+  _impl_.state_machine_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppliedState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .snapshot.ClientSession sessions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_sessions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes state_machine = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_state_machine();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AppliedState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:snapshot.AppliedState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .snapshot.ClientSession sessions = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sessions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sessions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes state_machine = 3;
+  if (!this->_internal_state_machine().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_state_machine(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:snapshot.AppliedState)
+  return target;
+}
+
+size_t AppliedState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:snapshot.AppliedState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .snapshot.ClientSession sessions = 1;
+  total_size += 1UL * this->_internal_sessions_size();
+  for (const auto& msg : this->_impl_.sessions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes state_machine = 3;
+  if (!this->_internal_state_machine().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_state_machine());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppliedState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppliedState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppliedState::GetClassData() const { return &_class_data_; }
+
+
+void AppliedState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppliedState*>(&to_msg);
+  auto& from = static_cast<const AppliedState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:snapshot.AppliedState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sessions_.MergeFrom(from._impl_.sessions_);
+  if (!from._internal_state_machine().empty()) {
+    _this->_internal_set_state_machine(from._internal_state_machine());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AppliedState::CopyFrom(const AppliedState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:snapshot.AppliedState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppliedState::IsInitialized() const {
+  return true;
+}
+
+void AppliedState::InternalSwap(AppliedState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.sessions_.InternalSwap(&other->_impl_.sessions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.state_machine_, lhs_arena,
+      &other->_impl_.state_machine_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppliedState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fsnapshot_2eproto_getter, &descriptor_table_proto_2fsnapshot_2eproto_once,
+      file_level_metadata_proto_2fsnapshot_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace snapshot
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::snapshot::ClientSession*
+Arena::CreateMaybeMessage< ::snapshot::ClientSession >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::snapshot::ClientSession >(arena);
+}
+template<> PROTOBUF_NOINLINE ::snapshot::Snapshot*
+Arena::CreateMaybeMessage< ::snapshot::Snapshot >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::snapshot::Snapshot >(arena);
+}
+template<> PROTOBUF_NOINLINE ::snapshot::AppliedState*
+Arena::CreateMaybeMessage< ::snapshot::AppliedState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::snapshot::AppliedState >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
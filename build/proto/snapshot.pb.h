@@ -0,0 +1,898 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/snapshot.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fsnapshot_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fsnapshot_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fsnapshot_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fsnapshot_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fsnapshot_2eproto;
+namespace snapshot {
+class AppliedState;
+struct AppliedStateDefaultTypeInternal;
+extern AppliedStateDefaultTypeInternal _AppliedState_default_instance_;
+class ClientSession;
+struct ClientSessionDefaultTypeInternal;
+extern ClientSessionDefaultTypeInternal _ClientSession_default_instance_;
+class Snapshot;
+struct SnapshotDefaultTypeInternal;
+extern SnapshotDefaultTypeInternal _Snapshot_default_instance_;
+}  // namespace snapshot
+PROTOBUF_NAMESPACE_OPEN
+template<> ::snapshot::AppliedState* Arena::CreateMaybeMessage<::snapshot::AppliedState>(Arena*);
+template<> ::snapshot::ClientSession* Arena::CreateMaybeMessage<::snapshot::ClientSession>(Arena*);
+template<> ::snapshot::Snapshot* Arena::CreateMaybeMessage<::snapshot::Snapshot>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace snapshot {
+
+// ===================================================================
+
+class ClientSession final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:snapshot.ClientSession) */ {
+ public:
+  inline ClientSession() : ClientSession(nullptr) {}
+  ~ClientSession() override;
+  explicit PROTOBUF_CONSTEXPR ClientSession(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClientSession(const ClientSession& from);
+  ClientSession(ClientSession&& from) noexcept
+    : ClientSession() {
+    *this = ::std::move(from);
+  }
+
+  inline ClientSession& operator=(const ClientSession& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClientSession& operator=(ClientSession&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientSession& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClientSession* internal_default_instance() {
+    return reinterpret_cast<const ClientSession*>(
+               &_ClientSession_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ClientSession& a, ClientSession& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClientSession* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientSession* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClientSession* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClientSession>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClientSession& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClientSession& from) {
+    ClientSession::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClientSession* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "snapshot.ClientSession";
+  }
+  protected:
+  explicit ClientSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAppliedSequencesFieldNumber = 4,
+    kFirstUnackedSequenceFieldNumber = 3,
+    kClientIdFieldNumber = 1,
+  };
+  // repeated uint64 applied_sequences = 4;
+  int applied_sequences_size() const;
+  private:
+  int _internal_applied_sequences_size() const;
+  public:
+  void clear_applied_sequences();
+  private:
+  uint64_t _internal_applied_sequences(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_applied_sequences() const;
+  void _internal_add_applied_sequences(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_applied_sequences();
+  public:
+  uint64_t applied_sequences(int index) const;
+  void set_applied_sequences(int index, uint64_t value);
+  void add_applied_sequences(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      applied_sequences() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_applied_sequences();
+
+  // uint64 first_unacked_sequence = 3;
+  void clear_first_unacked_sequence();
+  uint64_t first_unacked_sequence() const;
+  void set_first_unacked_sequence(uint64_t value);
+  private:
+  uint64_t _internal_first_unacked_sequence() const;
+  void _internal_set_first_unacked_sequence(uint64_t value);
+  public:
+
+  // uint32 client_id = 1;
+  void clear_client_id();
+  uint32_t client_id() const;
+  void set_client_id(uint32_t value);
+  private:
+  uint32_t _internal_client_id() const;
+  void _internal_set_client_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:snapshot.ClientSession)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > applied_sequences_;
+    mutable std::atomic<int> _applied_sequences_cached_byte_size_;
+    uint64_t first_unacked_sequence_;
+    uint32_t client_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fsnapshot_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Snapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:snapshot.Snapshot) */ {
+ public:
+  inline Snapshot() : Snapshot(nullptr) {}
+  ~Snapshot() override;
+  explicit PROTOBUF_CONSTEXPR Snapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Snapshot(const Snapshot& from);
+  Snapshot(Snapshot&& from) noexcept
+    : Snapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline Snapshot& operator=(const Snapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Snapshot& operator=(Snapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Snapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Snapshot* internal_default_instance() {
+    return reinterpret_cast<const Snapshot*>(
+               &_Snapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Snapshot& a, Snapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Snapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Snapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Snapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Snapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Snapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Snapshot& from) {
+    Snapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Snapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "snapshot.Snapshot";
+  }
+  protected:
+  explicit Snapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 3,
+    kLastIncludedIndexFieldNumber = 1,
+    kLastIncludedTermFieldNumber = 2,
+  };
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // uint32 last_included_index = 1;
+  void clear_last_included_index();
+  uint32_t last_included_index() const;
+  void set_last_included_index(uint32_t value);
+  private:
+  uint32_t _internal_last_included_index() const;
+  void _internal_set_last_included_index(uint32_t value);
+  public:
+
+  // uint32 last_included_term = 2;
+  void clear_last_included_term();
+  uint32_t last_included_term() const;
+  void set_last_included_term(uint32_t value);
+  private:
+  uint32_t _internal_last_included_term() const;
+  void _internal_set_last_included_term(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:snapshot.Snapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint32_t last_included_index_;
+    uint32_t last_included_term_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fsnapshot_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AppliedState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:snapshot.AppliedState) */ {
+ public:
+  inline AppliedState() : AppliedState(nullptr) {}
+  ~AppliedState() override;
+  explicit PROTOBUF_CONSTEXPR AppliedState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AppliedState(const AppliedState& from);
+  AppliedState(AppliedState&& from) noexcept
+    : AppliedState() {
+    *this = ::std::move(from);
+  }
+
+  inline AppliedState& operator=(const AppliedState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppliedState& operator=(AppliedState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppliedState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AppliedState* internal_default_instance() {
+    return reinterpret_cast<const AppliedState*>(
+               &_AppliedState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(AppliedState& a, AppliedState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppliedState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppliedState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AppliedState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AppliedState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AppliedState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppliedState& from) {
+    AppliedState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppliedState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "snapshot.AppliedState";
+  }
+  protected:
+  explicit AppliedState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionsFieldNumber = 1,
+    kStateMachineFieldNumber = 3,
+  };
+  // repeated .snapshot.ClientSession sessions = 1;
+  int sessions_size() const;
+  private:
+  int _internal_sessions_size() const;
+  public:
+  void clear_sessions();
+  ::snapshot::ClientSession* mutable_sessions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::snapshot::ClientSession >*
+      mutable_sessions();
+  private:
+  const ::snapshot::ClientSession& _internal_sessions(int index) const;
+  ::snapshot::ClientSession* _internal_add_sessions();
+  public:
+  const ::snapshot::ClientSession& sessions(int index) const;
+  ::snapshot::ClientSession* add_sessions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::snapshot::ClientSession >&
+      sessions() const;
+
+  // bytes state_machine = 3;
+  void clear_state_machine();
+  const std::string& state_machine() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_state_machine(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_state_machine();
+  PROTOBUF_NODISCARD std::string* release_state_machine();
+  void set_allocated_state_machine(std::string* state_machine);
+  private:
+  const std::string& _internal_state_machine() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_state_machine(const std::string& value);
+  std::string* _internal_mutable_state_machine();
+  public:
+
+  // @@protoc_insertion_point(class_scope:snapshot.AppliedState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::snapshot::ClientSession > sessions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr state_machine_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fsnapshot_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ClientSession
+
+// uint32 client_id = 1;
+inline void ClientSession::clear_client_id() {
+  _impl_.client_id_ = 0u;
+}
+inline uint32_t ClientSession::_internal_client_id() const {
+  return _impl_.client_id_;
+}
+inline uint32_t ClientSession::client_id() const {
+  // @@protoc_insertion_point(field_get:snapshot.ClientSession.client_id)
+  return _internal_client_id();
+}
+inline void ClientSession::_internal_set_client_id(uint32_t value) {
+  
+  _impl_.client_id_ = value;
+}
+inline void ClientSession::set_client_id(uint32_t value) {
+  _internal_set_client_id(value);
+  // @@protoc_insertion_point(field_set:snapshot.ClientSession.client_id)
+}
+
+// uint64 first_unacked_sequence = 3;
+inline void ClientSession::clear_first_unacked_sequence() {
+  _impl_.first_unacked_sequence_ = uint64_t{0u};
+}
+inline uint64_t ClientSession::_internal_first_unacked_sequence() const {
+  return _impl_.first_unacked_sequence_;
+}
+inline uint64_t ClientSession::first_unacked_sequence() const {
+  // @@protoc_insertion_point(field_get:snapshot.ClientSession.first_unacked_sequence)
+  return _internal_first_unacked_sequence();
+}
+inline void ClientSession::_internal_set_first_unacked_sequence(uint64_t value) {
+  
+  _impl_.first_unacked_sequence_ = value;
+}
+inline void ClientSession::set_first_unacked_sequence(uint64_t value) {
+  _internal_set_first_unacked_sequence(value);
+  // @@protoc_insertion_point(field_set:snapshot.ClientSession.first_unacked_sequence)
+}
+
+// repeated uint64 applied_sequences = 4;
+inline int ClientSession::_internal_applied_sequences_size() const {
+  return _impl_.applied_sequences_.size();
+}
+inline int ClientSession::applied_sequences_size() const {
+  return _internal_applied_sequences_size();
+}
+inline void ClientSession::clear_applied_sequences() {
+  _impl_.applied_sequences_.Clear();
+}
+inline uint64_t ClientSession::_internal_applied_sequences(int index) const {
+  return _impl_.applied_sequences_.Get(index);
+}
+inline uint64_t ClientSession::applied_sequences(int index) const {
+  // @@protoc_insertion_point(field_get:snapshot.ClientSession.applied_sequences)
+  return _internal_applied_sequences(index);
+}
+inline void ClientSession::set_applied_sequences(int index, uint64_t value) {
+  _impl_.applied_sequences_.Set(index, value);
+  // @@protoc_insertion_point(field_set:snapshot.ClientSession.applied_sequences)
+}
+inline void ClientSession::_internal_add_applied_sequences(uint64_t value) {
+  _impl_.applied_sequences_.Add(value);
+}
+inline void ClientSession::add_applied_sequences(uint64_t value) {
+  _internal_add_applied_sequences(value);
+  // @@protoc_insertion_point(field_add:snapshot.ClientSession.applied_sequences)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ClientSession::_internal_applied_sequences() const {
+  return _impl_.applied_sequences_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ClientSession::applied_sequences() const {
+  // @@protoc_insertion_point(field_list:snapshot.ClientSession.applied_sequences)
+  return _internal_applied_sequences();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ClientSession::_internal_mutable_applied_sequences() {
+  return &_impl_.applied_sequences_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ClientSession::mutable_applied_sequences() {
+  // @@protoc_insertion_point(field_mutable_list:snapshot.ClientSession.applied_sequences)
+  return _internal_mutable_applied_sequences();
+}
+
+// -------------------------------------------------------------------
+
+// Snapshot
+
+// uint32 last_included_index = 1;
+inline void Snapshot::clear_last_included_index() {
+  _impl_.last_included_index_ = 0u;
+}
+inline uint32_t Snapshot::_internal_last_included_index() const {
+  return _impl_.last_included_index_;
+}
+inline uint32_t Snapshot::last_included_index() const {
+  // @@protoc_insertion_point(field_get:snapshot.Snapshot.last_included_index)
+  return _internal_last_included_index();
+}
+inline void Snapshot::_internal_set_last_included_index(uint32_t value) {
+  
+  _impl_.last_included_index_ = value;
+}
+inline void Snapshot::set_last_included_index(uint32_t value) {
+  _internal_set_last_included_index(value);
+  // @@protoc_insertion_point(field_set:snapshot.Snapshot.last_included_index)
+}
+
+// uint32 last_included_term = 2;
+inline void Snapshot::clear_last_included_term() {
+  _impl_.last_included_term_ = 0u;
+}
+inline uint32_t Snapshot::_internal_last_included_term() const {
+  return _impl_.last_included_term_;
+}
+inline uint32_t Snapshot::last_included_term() const {
+  // @@protoc_insertion_point(field_get:snapshot.Snapshot.last_included_term)
+  return _internal_last_included_term();
+}
+inline void Snapshot::_internal_set_last_included_term(uint32_t value) {
+  
+  _impl_.last_included_term_ = value;
+}
+inline void Snapshot::set_last_included_term(uint32_t value) {
+  _internal_set_last_included_term(value);
+  // @@protoc_insertion_point(field_set:snapshot.Snapshot.last_included_term)
+}
+
+// bytes data = 3;
+inline void Snapshot::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& Snapshot::data() const {
+  // @@protoc_insertion_point(field_get:snapshot.Snapshot.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Snapshot::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:snapshot.Snapshot.data)
+}
+inline std::string* Snapshot::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:snapshot.Snapshot.data)
+  return _s;
+}
+inline const std::string& Snapshot::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void Snapshot::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Snapshot::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Snapshot::release_data() {
+  // @@protoc_insertion_point(field_release:snapshot.Snapshot.data)
+  return _impl_.data_.Release();
+}
+inline void Snapshot::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:snapshot.Snapshot.data)
+}
+
+// -------------------------------------------------------------------
+
+// AppliedState
+
+// repeated .snapshot.ClientSession sessions = 1;
+inline int AppliedState::_internal_sessions_size() const {
+  return _impl_.sessions_.size();
+}
+inline int AppliedState::sessions_size() const {
+  return _internal_sessions_size();
+}
+inline void AppliedState::clear_sessions() {
+  _impl_.sessions_.Clear();
+}
+inline ::snapshot::ClientSession* AppliedState::mutable_sessions(int index) {
+  // @@protoc_insertion_point(field_mutable:snapshot.AppliedState.sessions)
+  return _impl_.sessions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::snapshot::ClientSession >*
+AppliedState::mutable_sessions() {
+  // @@protoc_insertion_point(field_mutable_list:snapshot.AppliedState.sessions)
+  return &_impl_.sessions_;
+}
+inline const ::snapshot::ClientSession& AppliedState::_internal_sessions(int index) const {
+  return _impl_.sessions_.Get(index);
+}
+inline const ::snapshot::ClientSession& AppliedState::sessions(int index) const {
+  // @@protoc_insertion_point(field_get:snapshot.AppliedState.sessions)
+  return _internal_sessions(index);
+}
+inline ::snapshot::ClientSession* AppliedState::_internal_add_sessions() {
+  return _impl_.sessions_.Add();
+}
+inline ::snapshot::ClientSession* AppliedState::add_sessions() {
+  ::snapshot::ClientSession* _add = _internal_add_sessions();
+  // @@protoc_insertion_point(field_add:snapshot.AppliedState.sessions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::snapshot::ClientSession >&
+AppliedState::sessions() const {
+  // @@protoc_insertion_point(field_list:snapshot.AppliedState.sessions)
+  return _impl_.sessions_;
+}
+
+// bytes state_machine = 3;
+inline void AppliedState::clear_state_machine() {
+  _impl_.state_machine_.ClearToEmpty();
+}
+inline const std::string& AppliedState::state_machine() const {
+  // @@protoc_insertion_point(field_get:snapshot.AppliedState.state_machine)
+  return _internal_state_machine();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AppliedState::set_state_machine(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.state_machine_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:snapshot.AppliedState.state_machine)
+}
+inline std::string* AppliedState::mutable_state_machine() {
+  std::string* _s = _internal_mutable_state_machine();
+  // @@protoc_insertion_point(field_mutable:snapshot.AppliedState.state_machine)
+  return _s;
+}
+inline const std::string& AppliedState::_internal_state_machine() const {
+  return _impl_.state_machine_.Get();
+}
+inline void AppliedState::_internal_set_state_machine(const std::string& value) {
+  
+  _impl_.state_machine_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AppliedState::_internal_mutable_state_machine() {
+  
+  return _impl_.state_machine_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AppliedState::release_state_machine() {
+  // @@protoc_insertion_point(field_release:snapshot.AppliedState.state_machine)
+  return _impl_.state_machine_.Release();
+}
+inline void AppliedState::set_allocated_state_machine(std::string* state_machine) {
+  if (state_machine != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.state_machine_.SetAllocated(state_machine, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.state_machine_.IsDefault()) {
+    _impl_.state_machine_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:snapshot.AppliedState.state_machine)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace snapshot
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fsnapshot_2eproto
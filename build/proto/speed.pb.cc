@@ -0,0 +1,290 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/speed.proto
+
+#include "proto/speed.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace speed {
+PROTOBUF_CONSTEXPR SpeedRequest::SpeedRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.speed_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SpeedRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpeedRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpeedRequestDefaultTypeInternal() {}
+  union {
+    SpeedRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpeedRequestDefaultTypeInternal _SpeedRequest_default_instance_;
+}  // namespace speed
+static ::_pb::Metadata file_level_metadata_proto_2fspeed_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_proto_2fspeed_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fspeed_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fspeed_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::speed::SpeedRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::speed::SpeedRequest, _impl_.speed_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::speed::SpeedRequest)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::speed::_SpeedRequest_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fspeed_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021proto/speed.proto\022\005speed\"+\n\014SpeedReque"
+  "st\022\033\n\005speed\030\001 \001(\0162\014.speed.Speed*=\n\005Speed"
+  "\022\013\n\007UNKNOWN\020\000\022\007\n\003LOW\020\001\022\n\n\006MEDIUM\020\002\022\010\n\004HI"
+  "GH\020\003\022\010\n\004NONE\020\004b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_proto_2fspeed_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fspeed_2eproto = {
+    false, false, 142, descriptor_table_protodef_proto_2fspeed_2eproto,
+    "proto/speed.proto",
+    &descriptor_table_proto_2fspeed_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_proto_2fspeed_2eproto::offsets,
+    file_level_metadata_proto_2fspeed_2eproto, file_level_enum_descriptors_proto_2fspeed_2eproto,
+    file_level_service_descriptors_proto_2fspeed_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fspeed_2eproto_getter() {
+  return &descriptor_table_proto_2fspeed_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fspeed_2eproto(&descriptor_table_proto_2fspeed_2eproto);
+namespace speed {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Speed_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_proto_2fspeed_2eproto);
+  return file_level_enum_descriptors_proto_2fspeed_2eproto[0];
+}
+bool Speed_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class SpeedRequest::_Internal {
+ public:
+};
+
+SpeedRequest::SpeedRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:speed.SpeedRequest)
+}
+SpeedRequest::SpeedRequest(const SpeedRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpeedRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.speed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.speed_ = from._impl_.speed_;
+  // @@protoc_insertion_point(copy_constructor:speed.SpeedRequest)
+}
+
+inline void SpeedRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.speed_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SpeedRequest::~SpeedRequest() {
+  // @@protoc_insertion_point(destructor:speed.SpeedRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SpeedRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SpeedRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SpeedRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:speed.SpeedRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.speed_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SpeedRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .speed.Speed speed = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_speed(static_cast<::speed::Speed>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SpeedRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:speed.SpeedRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .speed.Speed speed = 1;
+  if (this->_internal_speed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_speed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:speed.SpeedRequest)
+  return target;
+}
+
+size_t SpeedRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:speed.SpeedRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .speed.Speed speed = 1;
+  if (this->_internal_speed() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_speed());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpeedRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpeedRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpeedRequest::GetClassData() const { return &_class_data_; }
+
+
+void SpeedRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpeedRequest*>(&to_msg);
+  auto& from = static_cast<const SpeedRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:speed.SpeedRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_speed() != 0) {
+    _this->_internal_set_speed(from._internal_speed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SpeedRequest::CopyFrom(const SpeedRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:speed.SpeedRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SpeedRequest::IsInitialized() const {
+  return true;
+}
+
+void SpeedRequest::InternalSwap(SpeedRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.speed_, other->_impl_.speed_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SpeedRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fspeed_2eproto_getter, &descriptor_table_proto_2fspeed_2eproto_once,
+      file_level_metadata_proto_2fspeed_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace speed
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::speed::SpeedRequest*
+Arena::CreateMaybeMessage< ::speed::SpeedRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::speed::SpeedRequest >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
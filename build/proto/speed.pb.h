@@ -0,0 +1,286 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/speed.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fspeed_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fspeed_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fspeed_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fspeed_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fspeed_2eproto;
+namespace speed {
+class SpeedRequest;
+struct SpeedRequestDefaultTypeInternal;
+extern SpeedRequestDefaultTypeInternal _SpeedRequest_default_instance_;
+}  // namespace speed
+PROTOBUF_NAMESPACE_OPEN
+template<> ::speed::SpeedRequest* Arena::CreateMaybeMessage<::speed::SpeedRequest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace speed {
+
+enum Speed : int {
+  UNKNOWN = 0,
+  LOW = 1,
+  MEDIUM = 2,
+  HIGH = 3,
+  NONE = 4,
+  Speed_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Speed_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Speed_IsValid(int value);
+constexpr Speed Speed_MIN = UNKNOWN;
+constexpr Speed Speed_MAX = NONE;
+constexpr int Speed_ARRAYSIZE = Speed_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Speed_descriptor();
+template<typename T>
+inline const std::string& Speed_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Speed>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Speed_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Speed_descriptor(), enum_t_value);
+}
+inline bool Speed_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Speed* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Speed>(
+    Speed_descriptor(), name, value);
+}
+// ===================================================================
+
+class SpeedRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:speed.SpeedRequest) */ {
+ public:
+  inline SpeedRequest() : SpeedRequest(nullptr) {}
+  ~SpeedRequest() override;
+  explicit PROTOBUF_CONSTEXPR SpeedRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SpeedRequest(const SpeedRequest& from);
+  SpeedRequest(SpeedRequest&& from) noexcept
+    : SpeedRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SpeedRequest& operator=(const SpeedRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SpeedRequest& operator=(SpeedRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpeedRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpeedRequest* internal_default_instance() {
+    return reinterpret_cast<const SpeedRequest*>(
+               &_SpeedRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SpeedRequest& a, SpeedRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpeedRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpeedRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SpeedRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpeedRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SpeedRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpeedRequest& from) {
+    SpeedRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SpeedRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "speed.SpeedRequest";
+  }
+  protected:
+  explicit SpeedRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSpeedFieldNumber = 1,
+  };
+  // .speed.Speed speed = 1;
+  void clear_speed();
+  ::speed::Speed speed() const;
+  void set_speed(::speed::Speed value);
+  private:
+  ::speed::Speed _internal_speed() const;
+  void _internal_set_speed(::speed::Speed value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:speed.SpeedRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int speed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fspeed_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SpeedRequest
+
+// .speed.Speed speed = 1;
+inline void SpeedRequest::clear_speed() {
+  _impl_.speed_ = 0;
+}
+inline ::speed::Speed SpeedRequest::_internal_speed() const {
+  return static_cast< ::speed::Speed >(_impl_.speed_);
+}
+inline ::speed::Speed SpeedRequest::speed() const {
+  // @@protoc_insertion_point(field_get:speed.SpeedRequest.speed)
+  return _internal_speed();
+}
+inline void SpeedRequest::_internal_set_speed(::speed::Speed value) {
+  
+  _impl_.speed_ = value;
+}
+inline void SpeedRequest::set_speed(::speed::Speed value) {
+  _internal_set_speed(value);
+  // @@protoc_insertion_point(field_set:speed.SpeedRequest.speed)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace speed
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::speed::Speed> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::speed::Speed>() {
+  return ::speed::Speed_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fspeed_2eproto
@@ -0,0 +1,562 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/vote.proto
+
+#include "proto/vote.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace vote {
+PROTOBUF_CONSTEXPR VoteRequest::VoteRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.candidate_id_)*/0u
+  , /*decltype(_impl_.last_log_size_)*/0u
+  , /*decltype(_impl_.last_log_term_)*/0u
+  , /*decltype(_impl_.leadership_transfer_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VoteRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VoteRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VoteRequestDefaultTypeInternal() {}
+  union {
+    VoteRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VoteRequestDefaultTypeInternal _VoteRequest_default_instance_;
+PROTOBUF_CONSTEXPR VoteResponse::VoteResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.vote_granted_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VoteResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VoteResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VoteResponseDefaultTypeInternal() {}
+  union {
+    VoteResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VoteResponseDefaultTypeInternal _VoteResponse_default_instance_;
+}  // namespace vote
+static ::_pb::Metadata file_level_metadata_proto_2fvote_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_proto_2fvote_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_proto_2fvote_2eproto = nullptr;
+
+const uint32_t TableStruct_proto_2fvote_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vote::VoteRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vote::VoteRequest, _impl_.candidate_id_),
+  PROTOBUF_FIELD_OFFSET(::vote::VoteRequest, _impl_.last_log_size_),
+  PROTOBUF_FIELD_OFFSET(::vote::VoteRequest, _impl_.last_log_term_),
+  PROTOBUF_FIELD_OFFSET(::vote::VoteRequest, _impl_.leadership_transfer_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vote::VoteResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vote::VoteResponse, _impl_.vote_granted_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::vote::VoteRequest)},
+  { 10, -1, -1, sizeof(::vote::VoteResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::vote::_VoteRequest_default_instance_._instance,
+  &::vote::_VoteResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_proto_2fvote_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020proto/vote.proto\022\004vote\"n\n\013VoteRequest\022"
+  "\024\n\014candidate_id\030\001 \001(\r\022\025\n\rlast_log_size\030\002"
+  " \001(\r\022\025\n\rlast_log_term\030\003 \001(\r\022\033\n\023leadershi"
+  "p_transfer\030\004 \001(\010\"$\n\014VoteResponse\022\024\n\014vote"
+  "_granted\030\001 \001(\010b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_proto_2fvote_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_proto_2fvote_2eproto = {
+    false, false, 182, descriptor_table_protodef_proto_2fvote_2eproto,
+    "proto/vote.proto",
+    &descriptor_table_proto_2fvote_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_proto_2fvote_2eproto::offsets,
+    file_level_metadata_proto_2fvote_2eproto, file_level_enum_descriptors_proto_2fvote_2eproto,
+    file_level_service_descriptors_proto_2fvote_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_proto_2fvote_2eproto_getter() {
+  return &descriptor_table_proto_2fvote_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_proto_2fvote_2eproto(&descriptor_table_proto_2fvote_2eproto);
+namespace vote {
+
+// ===================================================================
+
+class VoteRequest::_Internal {
+ public:
+};
+
+VoteRequest::VoteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:vote.VoteRequest)
+}
+VoteRequest::VoteRequest(const VoteRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VoteRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.candidate_id_){}
+    , decltype(_impl_.last_log_size_){}
+    , decltype(_impl_.last_log_term_){}
+    , decltype(_impl_.leadership_transfer_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.candidate_id_, &from._impl_.candidate_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.leadership_transfer_) -
+    reinterpret_cast<char*>(&_impl_.candidate_id_)) + sizeof(_impl_.leadership_transfer_));
+  // @@protoc_insertion_point(copy_constructor:vote.VoteRequest)
+}
+
+inline void VoteRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.candidate_id_){0u}
+    , decltype(_impl_.last_log_size_){0u}
+    , decltype(_impl_.last_log_term_){0u}
+    , decltype(_impl_.leadership_transfer_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+VoteRequest::~VoteRequest() {
+  // @@protoc_insertion_point(destructor:vote.VoteRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VoteRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void VoteRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VoteRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:vote.VoteRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.candidate_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.leadership_transfer_) -
+      reinterpret_cast<char*>(&_impl_.candidate_id_)) + sizeof(_impl_.leadership_transfer_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VoteRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 candidate_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.candidate_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 last_log_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.last_log_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 last_log_term = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.last_log_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool leadership_transfer = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.leadership_transfer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VoteRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:vote.VoteRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 candidate_id = 1;
+  if (this->_internal_candidate_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_candidate_id(), target);
+  }
+
+  // uint32 last_log_size = 2;
+  if (this->_internal_last_log_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_last_log_size(), target);
+  }
+
+  // uint32 last_log_term = 3;
+  if (this->_internal_last_log_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_last_log_term(), target);
+  }
+
+  // bool leadership_transfer = 4;
+  if (this->_internal_leadership_transfer() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_leadership_transfer(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:vote.VoteRequest)
+  return target;
+}
+
+size_t VoteRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vote.VoteRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 candidate_id = 1;
+  if (this->_internal_candidate_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_candidate_id());
+  }
+
+  // uint32 last_log_size = 2;
+  if (this->_internal_last_log_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_last_log_size());
+  }
+
+  // uint32 last_log_term = 3;
+  if (this->_internal_last_log_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_last_log_term());
+  }
+
+  // bool leadership_transfer = 4;
+  if (this->_internal_leadership_transfer() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VoteRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VoteRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VoteRequest::GetClassData() const { return &_class_data_; }
+
+
+void VoteRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VoteRequest*>(&to_msg);
+  auto& from = static_cast<const VoteRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vote.VoteRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_candidate_id() != 0) {
+    _this->_internal_set_candidate_id(from._internal_candidate_id());
+  }
+  if (from._internal_last_log_size() != 0) {
+    _this->_internal_set_last_log_size(from._internal_last_log_size());
+  }
+  if (from._internal_last_log_term() != 0) {
+    _this->_internal_set_last_log_term(from._internal_last_log_term());
+  }
+  if (from._internal_leadership_transfer() != 0) {
+    _this->_internal_set_leadership_transfer(from._internal_leadership_transfer());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VoteRequest::CopyFrom(const VoteRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vote.VoteRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VoteRequest::IsInitialized() const {
+  return true;
+}
+
+void VoteRequest::InternalSwap(VoteRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VoteRequest, _impl_.leadership_transfer_)
+      + sizeof(VoteRequest::_impl_.leadership_transfer_)
+      - PROTOBUF_FIELD_OFFSET(VoteRequest, _impl_.candidate_id_)>(
+          reinterpret_cast<char*>(&_impl_.candidate_id_),
+          reinterpret_cast<char*>(&other->_impl_.candidate_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VoteRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fvote_2eproto_getter, &descriptor_table_proto_2fvote_2eproto_once,
+      file_level_metadata_proto_2fvote_2eproto[0]);
+}
+
+// ===================================================================
+
+class VoteResponse::_Internal {
+ public:
+};
+
+VoteResponse::VoteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:vote.VoteResponse)
+}
+VoteResponse::VoteResponse(const VoteResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VoteResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vote_granted_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.vote_granted_ = from._impl_.vote_granted_;
+  // @@protoc_insertion_point(copy_constructor:vote.VoteResponse)
+}
+
+inline void VoteResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vote_granted_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+VoteResponse::~VoteResponse() {
+  // @@protoc_insertion_point(destructor:vote.VoteResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VoteResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void VoteResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VoteResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:vote.VoteResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.vote_granted_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VoteResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool vote_granted = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.vote_granted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VoteResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:vote.VoteResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool vote_granted = 1;
+  if (this->_internal_vote_granted() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_vote_granted(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:vote.VoteResponse)
+  return target;
+}
+
+size_t VoteResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vote.VoteResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool vote_granted = 1;
+  if (this->_internal_vote_granted() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VoteResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VoteResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VoteResponse::GetClassData() const { return &_class_data_; }
+
+
+void VoteResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VoteResponse*>(&to_msg);
+  auto& from = static_cast<const VoteResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vote.VoteResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_vote_granted() != 0) {
+    _this->_internal_set_vote_granted(from._internal_vote_granted());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VoteResponse::CopyFrom(const VoteResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vote.VoteResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VoteResponse::IsInitialized() const {
+  return true;
+}
+
+void VoteResponse::InternalSwap(VoteResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.vote_granted_, other->_impl_.vote_granted_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VoteResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_proto_2fvote_2eproto_getter, &descriptor_table_proto_2fvote_2eproto_once,
+      file_level_metadata_proto_2fvote_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace vote
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::vote::VoteRequest*
+Arena::CreateMaybeMessage< ::vote::VoteRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vote::VoteRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::vote::VoteResponse*
+Arena::CreateMaybeMessage< ::vote::VoteResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vote::VoteResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,518 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: proto/vote.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fvote_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_proto_2fvote_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_proto_2fvote_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_proto_2fvote_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fvote_2eproto;
+namespace vote {
+class VoteRequest;
+struct VoteRequestDefaultTypeInternal;
+extern VoteRequestDefaultTypeInternal _VoteRequest_default_instance_;
+class VoteResponse;
+struct VoteResponseDefaultTypeInternal;
+extern VoteResponseDefaultTypeInternal _VoteResponse_default_instance_;
+}  // namespace vote
+PROTOBUF_NAMESPACE_OPEN
+template<> ::vote::VoteRequest* Arena::CreateMaybeMessage<::vote::VoteRequest>(Arena*);
+template<> ::vote::VoteResponse* Arena::CreateMaybeMessage<::vote::VoteResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace vote {
+
+// ===================================================================
+
+class VoteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vote.VoteRequest) */ {
+ public:
+  inline VoteRequest() : VoteRequest(nullptr) {}
+  ~VoteRequest() override;
+  explicit PROTOBUF_CONSTEXPR VoteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VoteRequest(const VoteRequest& from);
+  VoteRequest(VoteRequest&& from) noexcept
+    : VoteRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline VoteRequest& operator=(const VoteRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VoteRequest& operator=(VoteRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VoteRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VoteRequest* internal_default_instance() {
+    return reinterpret_cast<const VoteRequest*>(
+               &_VoteRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(VoteRequest& a, VoteRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VoteRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VoteRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VoteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VoteRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VoteRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VoteRequest& from) {
+    VoteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VoteRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vote.VoteRequest";
+  }
+  protected:
+  explicit VoteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCandidateIdFieldNumber = 1,
+    kLastLogSizeFieldNumber = 2,
+    kLastLogTermFieldNumber = 3,
+    kLeadershipTransferFieldNumber = 4,
+  };
+  // uint32 candidate_id = 1;
+  void clear_candidate_id();
+  uint32_t candidate_id() const;
+  void set_candidate_id(uint32_t value);
+  private:
+  uint32_t _internal_candidate_id() const;
+  void _internal_set_candidate_id(uint32_t value);
+  public:
+
+  // uint32 last_log_size = 2;
+  void clear_last_log_size();
+  uint32_t last_log_size() const;
+  void set_last_log_size(uint32_t value);
+  private:
+  uint32_t _internal_last_log_size() const;
+  void _internal_set_last_log_size(uint32_t value);
+  public:
+
+  // uint32 last_log_term = 3;
+  void clear_last_log_term();
+  uint32_t last_log_term() const;
+  void set_last_log_term(uint32_t value);
+  private:
+  uint32_t _internal_last_log_term() const;
+  void _internal_set_last_log_term(uint32_t value);
+  public:
+
+  // bool leadership_transfer = 4;
+  void clear_leadership_transfer();
+  bool leadership_transfer() const;
+  void set_leadership_transfer(bool value);
+  private:
+  bool _internal_leadership_transfer() const;
+  void _internal_set_leadership_transfer(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:vote.VoteRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t candidate_id_;
+    uint32_t last_log_size_;
+    uint32_t last_log_term_;
+    bool leadership_transfer_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fvote_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VoteResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vote.VoteResponse) */ {
+ public:
+  inline VoteResponse() : VoteResponse(nullptr) {}
+  ~VoteResponse() override;
+  explicit PROTOBUF_CONSTEXPR VoteResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VoteResponse(const VoteResponse& from);
+  VoteResponse(VoteResponse&& from) noexcept
+    : VoteResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline VoteResponse& operator=(const VoteResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VoteResponse& operator=(VoteResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VoteResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VoteResponse* internal_default_instance() {
+    return reinterpret_cast<const VoteResponse*>(
+               &_VoteResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(VoteResponse& a, VoteResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VoteResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VoteResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VoteResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VoteResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VoteResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VoteResponse& from) {
+    VoteResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VoteResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vote.VoteResponse";
+  }
+  protected:
+  explicit VoteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVoteGrantedFieldNumber = 1,
+  };
+  // bool vote_granted = 1;
+  void clear_vote_granted();
+  bool vote_granted() const;
+  void set_vote_granted(bool value);
+  private:
+  bool _internal_vote_granted() const;
+  void _internal_set_vote_granted(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:vote.VoteResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool vote_granted_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_proto_2fvote_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// VoteRequest
+
+// uint32 candidate_id = 1;
+inline void VoteRequest::clear_candidate_id() {
+  _impl_.candidate_id_ = 0u;
+}
+inline uint32_t VoteRequest::_internal_candidate_id() const {
+  return _impl_.candidate_id_;
+}
+inline uint32_t VoteRequest::candidate_id() const {
+  // @@protoc_insertion_point(field_get:vote.VoteRequest.candidate_id)
+  return _internal_candidate_id();
+}
+inline void VoteRequest::_internal_set_candidate_id(uint32_t value) {
+  
+  _impl_.candidate_id_ = value;
+}
+inline void VoteRequest::set_candidate_id(uint32_t value) {
+  _internal_set_candidate_id(value);
+  // @@protoc_insertion_point(field_set:vote.VoteRequest.candidate_id)
+}
+
+// uint32 last_log_size = 2;
+inline void VoteRequest::clear_last_log_size() {
+  _impl_.last_log_size_ = 0u;
+}
+inline uint32_t VoteRequest::_internal_last_log_size() const {
+  return _impl_.last_log_size_;
+}
+inline uint32_t VoteRequest::last_log_size() const {
+  // @@protoc_insertion_point(field_get:vote.VoteRequest.last_log_size)
+  return _internal_last_log_size();
+}
+inline void VoteRequest::_internal_set_last_log_size(uint32_t value) {
+  
+  _impl_.last_log_size_ = value;
+}
+inline void VoteRequest::set_last_log_size(uint32_t value) {
+  _internal_set_last_log_size(value);
+  // @@protoc_insertion_point(field_set:vote.VoteRequest.last_log_size)
+}
+
+// uint32 last_log_term = 3;
+inline void VoteRequest::clear_last_log_term() {
+  _impl_.last_log_term_ = 0u;
+}
+inline uint32_t VoteRequest::_internal_last_log_term() const {
+  return _impl_.last_log_term_;
+}
+inline uint32_t VoteRequest::last_log_term() const {
+  // @@protoc_insertion_point(field_get:vote.VoteRequest.last_log_term)
+  return _internal_last_log_term();
+}
+inline void VoteRequest::_internal_set_last_log_term(uint32_t value) {
+  
+  _impl_.last_log_term_ = value;
+}
+inline void VoteRequest::set_last_log_term(uint32_t value) {
+  _internal_set_last_log_term(value);
+  // @@protoc_insertion_point(field_set:vote.VoteRequest.last_log_term)
+}
+
+// bool leadership_transfer = 4;
+inline void VoteRequest::clear_leadership_transfer() {
+  _impl_.leadership_transfer_ = false;
+}
+inline bool VoteRequest::_internal_leadership_transfer() const {
+  return _impl_.leadership_transfer_;
+}
+inline bool VoteRequest::leadership_transfer() const {
+  // @@protoc_insertion_point(field_get:vote.VoteRequest.leadership_transfer)
+  return _internal_leadership_transfer();
+}
+inline void VoteRequest::_internal_set_leadership_transfer(bool value) {
+  
+  _impl_.leadership_transfer_ = value;
+}
+inline void VoteRequest::set_leadership_transfer(bool value) {
+  _internal_set_leadership_transfer(value);
+  // @@protoc_insertion_point(field_set:vote.VoteRequest.leadership_transfer)
+}
+
+// -------------------------------------------------------------------
+
+// VoteResponse
+
+// bool vote_granted = 1;
+inline void VoteResponse::clear_vote_granted() {
+  _impl_.vote_granted_ = false;
+}
+inline bool VoteResponse::_internal_vote_granted() const {
+  return _impl_.vote_granted_;
+}
+inline bool VoteResponse::vote_granted() const {
+  // @@protoc_insertion_point(field_get:vote.VoteResponse.vote_granted)
+  return _internal_vote_granted();
+}
+inline void VoteResponse::_internal_set_vote_granted(bool value) {
+  
+  _impl_.vote_granted_ = value;
+}
+inline void VoteResponse::set_vote_granted(bool value) {
+  _internal_set_vote_granted(value);
+  // @@protoc_insertion_point(field_set:vote.VoteResponse.vote_granted)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace vote
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fvote_2eproto
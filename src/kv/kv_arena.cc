@@ -0,0 +1,46 @@
+#include "kv_arena.hh"
+
+namespace kv
+{
+    Arena::Arena(uint64 block_size):
+        block_size_(block_size),
+        blocks_(),
+        current_(nullptr),
+        remaining_(0),
+        allocated_(0)
+    {}
+
+    char* Arena::allocate(uint64 size)
+    {
+        // Its own block: the rest of the current block stays in use
+        if (size > block_size_)
+        {
+            blocks_.emplace_back(new char[size]);
+            allocated_ += size;
+            return blocks_.back().get();
+        }
+
+        if (size > remaining_)
+        {
+            // Not value-initialized: the engine overwrites every byte it allocates
+            blocks_.emplace_back(new char[block_size_]);
+            current_ = blocks_.back().get();
+            remaining_ = block_size_;
+        }
+
+        char* data = current_;
+        current_ += size;
+        remaining_ -= size;
+        allocated_ += size;
+
+        return data;
+    }
+
+    void Arena::clear()
+    {
+        blocks_.clear();
+        current_ = nullptr;
+        remaining_ = 0;
+        allocated_ = 0;
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vector> // std::vector
+#include <memory> // std::unique_ptr
+
+#include "types.hh"
+
+namespace kv
+{
+    // Bump allocator for the keys and values of the engine
+    // Memory is only given back all at once (clear), the engine rebuilds its arena to drop the garbage
+    class Arena
+    {
+        public:
+            Arena(uint64 block_size);
+
+            // Uninitialized memory, valid until clear()
+            char* allocate(uint64 size);
+            void clear();
+
+            // Bytes handed out by allocate
+            uint64 allocated() const { return allocated_; }
+        private:
+            // Size of a block, a bigger allocation gets its own block
+            uint64 block_size_;
+            std::vector<std::unique_ptr<char[]>> blocks_;
+            // Free space of the current block
+            char* current_;
+            uint64 remaining_;
+            uint64 allocated_;
+    };
+}
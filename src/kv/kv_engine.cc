@@ -0,0 +1,203 @@
+#include "kv_engine.hh"
+
+namespace kv
+{
+    // Initial number of slots (always a power of two)
+    static const uint64 min_capacity = 64;
+    // Size of an arena block
+    static const uint64 arena_block_size = 1024 * 1024;
+    // The table is rebuilt when the FULL and DELETED slots reach this fraction of the slots
+    static const double max_load_factor = 0.7;
+    // The arena is rebuilt when its garbage reaches this size and exceeds the live bytes
+    static const uint64 min_garbage_bytes = 4 * 1024 * 1024;
+
+    Engine::Engine():
+        slots_(min_capacity),
+        arena_(arena_block_size),
+        size_(0),
+        deleted_(0),
+        live_bytes_(0)
+    {}
+
+    std::optional<std::string_view> Engine::get(std::string_view key) const
+    {
+        std::optional<uint64> position = find(key, hash(key));
+
+        if (!position)
+            return std::nullopt;
+
+        return std::make_optional(slots_.at(position.value()).value());
+    }
+
+    void Engine::put(std::string_view key, std::string_view value)
+    {
+        uint64 key_hash = hash(key);
+        std::optional<uint64> position = find(key, key_hash);
+
+        if (position)
+            set_value(slots_.at(position.value()), value);
+        else
+        {
+            insert(key, value, key_hash);
+            maybe_rebuild();
+        }
+    }
+
+    bool Engine::erase(std::string_view key)
+    {
+        std::optional<uint64> position = find(key, hash(key));
+
+        if (!position)
+            return false;
+
+        Slot& slot = slots_.at(position.value());
+        slot.state = SlotState::DELETED;
+        live_bytes_ -= slot.key_size + slot.value_capacity;
+
+        --size_;
+        ++deleted_;
+
+        maybe_rebuild();
+
+        return true;
+    }
+
+    bool Engine::compare_and_swap(std::string_view key, std::string_view expected, std::string_view desired)
+    {
+        std::optional<uint64> position = find(key, hash(key));
+
+        if (!position || slots_.at(position.value()).value() != expected)
+            return false;
+
+        set_value(slots_.at(position.value()), desired);
+        return true;
+    }
+
+    void Engine::for_each(const std::function<void(std::string_view key, std::string_view value)>& callback) const
+    {
+        for (const auto& slot: slots_)
+        {
+            if (slot.state == SlotState::FULL)
+                callback(slot.key(), slot.value());
+        }
+    }
+
+    void Engine::clear()
+    {
+        slots_.assign(min_capacity, Slot {});
+        arena_.clear();
+        size_ = 0;
+        deleted_ = 0;
+        live_bytes_ = 0;
+    }
+
+    uint64 Engine::hash(std::string_view key)
+    {
+        return std::hash<std::string_view>{}(key);
+    }
+
+    std::optional<uint64> Engine::find(std::string_view key, uint64 hash) const
+    {
+        uint64 mask = slots_.size() - 1;
+
+        // The load factor guarantees an EMPTY slot ends the probing
+        for (uint64 position = hash & mask; ; position = (position + 1) & mask)
+        {
+            const Slot& slot = slots_.at(position);
+
+            if (slot.state == SlotState::EMPTY)
+                return std::nullopt;
+
+            if (slot.state == SlotState::FULL && slot.hash == hash && slot.key() == key)
+                return std::make_optional(position);
+        }
+    }
+
+    void Engine::set_value(Slot& slot, std::string_view value)
+    {
+        // The new value does not fit: move the entry to a new place of the arena
+        if (value.size() > slot.value_capacity)
+        {
+            char* data = arena_.allocate(slot.key_size + value.size());
+            std::memcpy(data, slot.data, slot.key_size);
+
+            live_bytes_ += value.size() - slot.value_capacity;
+            slot.data = data;
+            slot.value_capacity = value.size();
+        }
+
+        std::memcpy(slot.data + slot.key_size, value.data(), value.size());
+        slot.value_size = value.size();
+
+        maybe_rebuild();
+    }
+
+    void Engine::insert(std::string_view key, std::string_view value, uint64 hash)
+    {
+        uint64 mask = slots_.size() - 1;
+        uint64 position = hash & mask;
+
+        // The first EMPTY or DELETED slot of the probe sequence
+        while (slots_.at(position).state == SlotState::FULL)
+            position = (position + 1) & mask;
+
+        Slot& slot = slots_.at(position);
+
+        if (slot.state == SlotState::DELETED)
+            --deleted_;
+
+        slot.hash = hash;
+        slot.data = arena_.allocate(key.size() + value.size());
+        slot.key_size = key.size();
+        slot.value_size = value.size();
+        slot.value_capacity = value.size();
+        slot.state = SlotState::FULL;
+
+        std::memcpy(slot.data, key.data(), key.size());
+        std::memcpy(slot.data + key.size(), value.data(), value.size());
+
+        live_bytes_ += key.size() + value.size();
+        ++size_;
+    }
+
+    void Engine::maybe_rebuild()
+    {
+        uint64 garbage_bytes = arena_.allocated() - live_bytes_;
+
+        // Double the table if the keys fill more than half of the allowed load, only drop the tombstones otherwise
+        if (size_ + deleted_ + 1 > slots_.size() * max_load_factor)
+            rebuild(size_ * 2 > slots_.size() * max_load_factor ? slots_.size() * 2 : slots_.size());
+        else if (garbage_bytes >= min_garbage_bytes && garbage_bytes > live_bytes_)
+            rebuild(slots_.size());
+    }
+
+    // Copy the live entries into a new table and a new arena, in a single pass
+    void Engine::rebuild(uint64 capacity)
+    {
+        std::vector<Slot> slots(capacity);
+        Arena arena(arena_block_size);
+        uint64 mask = capacity - 1;
+
+        for (const auto& slot: slots_)
+        {
+            if (slot.state != SlotState::FULL)
+                continue;
+
+            uint64 position = slot.hash & mask;
+            while (slots.at(position).state == SlotState::FULL)
+                position = (position + 1) & mask;
+
+            Slot& new_slot = slots.at(position);
+            new_slot = slot;
+            new_slot.data = arena.allocate(slot.key_size + slot.value_size);
+            new_slot.value_capacity = slot.value_size;
+            std::memcpy(new_slot.data, slot.data, slot.key_size + slot.value_size);
+        }
+
+        slots_.swap(slots);
+        std::swap(arena_, arena);
+
+        deleted_ = 0;
+        live_bytes_ = arena_.allocated();
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string_view> // std::string_view
+#include <optional> // std::optional
+#include <vector> // std::vector
+#include <functional> // std::hash std::function
+#include <cstring> // std::memcpy
+
+#include "kv_arena.hh"
+#include "types.hh"
+
+namespace kv
+{
+    // In-memory key-value engine: open addressing hash table (linear probing) whose keys and values live in an arena
+    // A lookup touches a single contiguous array of slots, and the entries never need one allocation each
+    class Engine
+    {
+        public:
+            Engine();
+
+            // The view is valid until the next modification
+            std::optional<std::string_view> get(std::string_view key) const;
+            void put(std::string_view key, std::string_view value);
+            // False if the key does not exist
+            bool erase(std::string_view key);
+            // Replace the value only if it is the expected one (false if the key does not exist)
+            bool compare_and_swap(std::string_view key, std::string_view expected, std::string_view desired);
+
+            void for_each(const std::function<void(std::string_view key, std::string_view value)>& callback) const;
+            void clear();
+
+            uint64 size() const { return size_; }
+            // Bytes taken in the arena by the entries and the garbage
+            uint64 arena_bytes() const { return arena_.allocated(); }
+        private:
+            enum class SlotState : uint8 { EMPTY, FULL, DELETED };
+
+            struct Slot
+            {
+                uint64 hash;
+                // Key then value, contiguous in the arena
+                char* data;
+                uint32 key_size;
+                uint32 value_size;
+                // Space reserved for the value (kept when it shrinks, reused when it grows back)
+                uint32 value_capacity;
+                SlotState state;
+
+                std::string_view key() const { return std::string_view(data, key_size); }
+                std::string_view value() const { return std::string_view(data + key_size, value_size); }
+            };
+
+            static uint64 hash(std::string_view key);
+            // Slot of the key, none if absent
+            std::optional<uint64> find(std::string_view key, uint64 hash) const;
+            void set_value(Slot& slot, std::string_view value);
+            void insert(std::string_view key, std::string_view value, uint64 hash);
+            // Grow the table, or rebuild it (and its arena) when the deleted slots or the garbage take too much room
+            void maybe_rebuild();
+            void rebuild(uint64 capacity);
+
+            std::vector<Slot> slots_;
+            Arena arena_;
+            // Number of keys
+            uint64 size_;
+            // Number of DELETED slots (tombstones)
+            uint64 deleted_;
+            // Arena bytes still referenced by a slot
+            uint64 live_bytes_;
+    };
+}
@@ -2,10 +2,56 @@
 
 namespace mpi
 {
-    int handle_mpi_process(int argc, char **argv, int nb_servers, int nb_clients)
+    // Run the server or client of the rank until it stops
+    static void run_node(int rank, int nb_servers, const std::vector<raft::node_id_t>& server_ids, const std::vector<raft::node_id_t>& node_ids, const raft::Config& config, rpc::RPC* rpc)
+    {
+        // Run Server (or one server per group)
+        if (rank <= nb_servers && config.groups > 1)
+        {
+            auto server = raft::MultiServer(rank, 0, server_ids, node_ids, config);
+            server.set_rpc(rpc);
+            server.run();
+        }
+        else if (rank <= nb_servers)
+        {
+            auto server = raft::Server(rank, 0, 0, server_ids, node_ids, config);
+            server.set_rpc(rpc);
+            server.run();
+        }
+        // Run Client (or one client per group)
+        else if (config.groups > 1)
+        {
+            auto client = raft::MultiClient(rank, 0, server_ids, config);
+            client.set_rpc(rpc);
+            client.run();
+        }
+        else
+        {
+            auto client = raft::Client(rank, 0, server_ids, config);
+            client.set_rpc(rpc);
+            client.run();
+        }
+    }
+
+    int handle_mpi_process(int argc, char **argv, int nb_servers, int nb_clients, const raft::Config& config)
     {
         int rank, size;
-        MPI_Init(&argc, &argv);
+
+        // Staged nodes: only the main thread (I/O stage) makes MPI calls
+        if (config.io_thread)
+        {
+            int provided;
+            MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+
+            if (provided < MPI_THREAD_FUNNELED)
+            {
+                std::cerr << "MPI does not support MPI_THREAD_FUNNELED" << std::endl;
+                MPI_Finalize();
+                return EXIT_FAILURE;
+            }
+        }
+        else
+            MPI_Init(&argc, &argv);
 
         MPI_Comm_rank(MPI_COMM_WORLD, &rank);
         MPI_Comm_size(MPI_COMM_WORLD, &size);
@@ -40,23 +86,24 @@ namespace mpi
             controller.set_rpc(&rpc);
             controller.run();
         }
-        else
+        else if (config.io_thread)
         {
-            // Run Server
-            if (rank <= nb_servers)
-            {
-                auto server = raft::Server(rank, 0, server_ids, node_ids);
-                server.set_rpc(&rpc);
-                server.run();
-            }
-            // Run Client
-            else
-            {
-                auto client = raft::Client(rank, 0, server_ids);
-                client.set_rpc(&rpc);
-                client.run();
-            }
+            // The node loop (consensus stage) runs on its own thread, this one is the I/O stage
+            mpi::StagedRPC staged_rpc(rpc);
+
+            std::thread node_thread([&]() {
+                run_node(rank, nb_servers, server_ids, node_ids, config, &staged_rpc);
+                staged_rpc.close();
+            });
+
+            staged_rpc.run_io();
+            node_thread.join();
         }
+        else
+            run_node(rank, nb_servers, server_ids, node_ids, config, &rpc);
+
+        // The send buffers must outlive their requests
+        rpc.wait_pending_sends(1000);
 
         MPI_Finalize();
 
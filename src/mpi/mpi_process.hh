@@ -2,16 +2,21 @@
 
 #include <iostream>
 #include <string>
+#include <thread> // std::thread
 #include <mpi.h>
 
 #include "types.hh"
 #include "raft_types.hh"
+#include "raft_config.hh"
 #include "mpi_rpc.hh"
+#include "mpi_staged_rpc.hh"
 #include "raft_controller.hh"
 #include "raft_server.hh"
 #include "raft_client.hh"
+#include "raft_multi_server.hh"
+#include "raft_multi_client.hh"
 
 namespace mpi
 {
-    int handle_mpi_process(int argc, char **argv, int nb_servers, int nb_clients);
+    int handle_mpi_process(int argc, char **argv, int nb_servers, int nb_clients, const raft::Config& config);
 }
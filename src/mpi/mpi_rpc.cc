@@ -1,45 +1,229 @@
 #include "mpi_rpc.hh"
 
+#include <chrono> // std::chrono
+
 namespace mpi
 {
+    // Maximum number of buffers kept in the pool
+    static const uint32 max_pooled_buffers = 256;
+    // Buffers bigger than this are freed instead of being pooled
+    static const uint64 max_pooled_buffer_size = 1024 * 1024;
+
+    // Tag of a single message
+    static const int message_tag = 0;
+    // Tag of a MessageBatch
+    static const int batch_tag = 1;
+
+    RPC::RPC():
+        batching_(false),
+        outbound_batches_(),
+        free_buffers_(),
+        send_requests_(),
+        send_buffers_(),
+        completed_indexes_(),
+        receive_buffer_()
+    {}
+
     void RPC::send_message(const message::Message& message)
     {
-        std::string serialized_message = utils::serialize_message(message);
+        if (batching_)
+        {
+            *outbound_batches_[message.dest_id()].add_messages() = message;
+            return;
+        }
+
+        std::vector<char> buffer = take_buffer();
+        utils::serialize_message(message, buffer);
+        send_buffer(std::move(buffer), message.dest_id(), message_tag);
+    }
+
+    void RPC::begin_batch()
+    {
+        batching_ = true;
+    }
+
+    void RPC::flush_batch()
+    {
+        batching_ = false;
+
+        for (auto& [dest_id, batch]: outbound_batches_)
+        {
+            if (batch.messages_size() == 0)
+                continue;
+
+            std::vector<char> buffer = take_buffer();
+
+            // No envelope needed for a single message
+            if (batch.messages_size() == 1)
+            {
+                utils::serialize_message(batch.messages(0), buffer);
+                send_buffer(std::move(buffer), dest_id, message_tag);
+            }
+            else
+            {
+                buffer.resize(batch.ByteSizeLong());
+                batch.SerializeToArray(buffer.data(), buffer.size());
+                send_buffer(std::move(buffer), dest_id, batch_tag);
+            }
+
+            // Keeps the allocated messages for the next batch
+            batch.Clear();
+        }
+    }
+
+    std::vector<char> RPC::take_buffer()
+    {
+        reap_completed_sends();
+
+        std::vector<char> buffer;
+        if (!free_buffers_.empty())
+        {
+            buffer = std::move(free_buffers_.back());
+            free_buffers_.pop_back();
+        }
 
+        return buffer;
+    }
+
+    void RPC::send_buffer(std::vector<char>&& buffer, raft::node_id_t dest_id, int tag)
+    {
         MPI_Request request;
         MPI_Isend(
-            serialized_message.c_str(),
-            serialized_message.size(),
+            buffer.data(),
+            buffer.size(),
             MPI_CHAR,
-            message.dest_id(),
-            0,
+            dest_id,
+            tag,
             MPI_COMM_WORLD,
             &request
         );
 
-        MPI_Request_free(&request);
+        // Moving the vector keeps its storage (and the address given to MPI) unchanged
+        send_requests_.push_back(request);
+        send_buffers_.push_back(std::move(buffer));
     }
 
-    std::optional<message::Message> RPC::receive_message(raft::node_id_t id)
+    std::vector<message::Message> RPC::receive_messages()
     {
-        MPI_Status mpi_status;
+        reap_completed_sends();
+
+        std::vector<message::Message> messages;
+
+        // A single matched probe on any source: the cost only depends on the number of pending messages
+        while (true)
+        {
+            MPI_Message mpi_message;
+            MPI_Status mpi_status;
+            int flag;
+            MPI_Improbe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &flag, &mpi_message, &mpi_status);
+
+            if (!flag)
+                break;
+
+            int buffer_size = 0;
+            MPI_Get_count(&mpi_status, MPI_CHAR, &buffer_size);
+
+            // The matched message can only be received here, no other probe can steal it
+            receive_buffer_.resize(buffer_size);
+            MPI_Mrecv(receive_buffer_.data(), buffer_size, MPI_CHAR, &mpi_message, MPI_STATUS_IGNORE);
+
+            // Unpack the batches transparently
+            if (mpi_status.MPI_TAG == batch_tag)
+            {
+                message_batch::MessageBatch batch;
+                if (!batch.ParseFromArray(receive_buffer_.data(), buffer_size))
+                    continue;
+
+                for (auto& message: *batch.mutable_messages())
+                {
+                    message.set_source_id(mpi_status.MPI_SOURCE);
+                    messages.push_back(std::move(message));
+                }
+
+                continue;
+            }
+
+            std::optional<message::Message> message = utils::deserialize_message(receive_buffer_.data(), buffer_size);
+
+            if (message)
+            {
+                message.value().set_source_id(mpi_status.MPI_SOURCE);
+                messages.push_back(std::move(message.value()));
+            }
+        }
+
+        return messages;
+    }
+
+    bool RPC::has_message()
+    {
+        // Also makes the pending sends progress
+        reap_completed_sends();
+
         int flag;
-        MPI_Iprobe(id, 0, MPI_COMM_WORLD, &flag, &mpi_status);
+        MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &flag, MPI_STATUS_IGNORE);
 
-        if (!flag)
-            return std::nullopt;
+        return flag;
+    }
 
-        int buffer_size = 0;
-        MPI_Get_count(&mpi_status, MPI_CHAR, &buffer_size);
+    void RPC::wait_pending_sends(time_t timeout)
+    {
+        auto start = std::chrono::steady_clock::now();
 
-        std::vector<char> buffer(buffer_size);
+        while (!send_requests_.empty())
+        {
+            reap_completed_sends();
 
-        MPI_Request request;
-        MPI_Irecv(buffer.data(), buffer_size, MPI_CHAR, id, 0, MPI_COMM_WORLD, &request);
-        MPI_Request_free(&request);
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            if (elapsed.count() >= timeout)
+                break;
+        }
+
+        // The destination stopped receiving: stop tracking these sends (MPI_Cancel is deprecated for sends)
+        // MPI_Finalize completes or drops them, their buffers are only freed with the RPC, after it
+        for (auto& request: send_requests_)
+            MPI_Request_free(&request);
+
+        send_requests_.clear();
+    }
+
+    void RPC::reap_completed_sends()
+    {
+        if (send_requests_.empty())
+            return;
+
+        int nb_completed = 0;
+        completed_indexes_.resize(send_requests_.size());
+        MPI_Testsome(send_requests_.size(), send_requests_.data(), &nb_completed, completed_indexes_.data(), MPI_STATUSES_IGNORE);
+
+        if (nb_completed == MPI_UNDEFINED || nb_completed == 0)
+            return;
+
+        for (int i = 0; i < nb_completed; ++i)
+        {
+            std::vector<char>& buffer = send_buffers_.at(completed_indexes_.at(i));
+
+            if (free_buffers_.size() < max_pooled_buffers && buffer.capacity() <= max_pooled_buffer_size)
+                free_buffers_.push_back(std::move(buffer));
+        }
+
+        // Completed requests are set to MPI_REQUEST_NULL: keep only the pending ones, in order
+        uint64 nb_pending = 0;
+        for (uint64 i = 0; i < send_requests_.size(); ++i)
+        {
+            if (send_requests_.at(i) == MPI_REQUEST_NULL)
+                continue;
+
+            if (i != nb_pending)
+            {
+                send_requests_.at(nb_pending) = send_requests_.at(i);
+                send_buffers_.at(nb_pending) = std::move(send_buffers_.at(i));
+            }
 
-        std::string serialized_message(buffer.begin(), buffer.end());
+            ++nb_pending;
+        }
 
-        return utils::deserialize_message(serialized_message);
+        send_requests_.resize(nb_pending);
+        send_buffers_.resize(nb_pending);
     }
 }
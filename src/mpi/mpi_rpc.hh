@@ -1,6 +1,8 @@
 #pragma once
 
 #include <mpi.h>
+#include <vector> // std::vector
+#include <map> // std::map
 
 #include "rpc.hh"
 
@@ -8,13 +10,44 @@
 #include "raft_types.hh"
 #include "serialization.hh"
 
+#include "proto/message_batch.pb.h"
+
 namespace mpi
 {
     class RPC: public rpc::RPC
     {
         public:
+            RPC();
+
             // Overriden methods
             void send_message(const message::Message& message) override;
-            std::optional<message::Message> receive_message(raft::node_id_t id) override;
+            std::vector<message::Message> receive_messages() override;
+            bool has_message() override;
+            void begin_batch() override;
+            void flush_batch() override;
+
+            // Wait for the pending sends (at most timeout ms), then leave the remaining ones to MPI_Finalize
+            // Must be called before MPI_Finalize, the RPC must outlive it (the buffers of the remaining sends)
+            void wait_pending_sends(time_t timeout);
+        private:
+            // Send a serialized message or batch
+            void send_buffer(std::vector<char>&& buffer, raft::node_id_t dest_id, int tag);
+            std::vector<char> take_buffer();
+            // Return the buffers of the completed sends to the pool
+            void reap_completed_sends();
+
+            // True between begin_batch and flush_batch
+            bool batching_;
+            // Messages waiting for flush_batch by destination
+            std::map<raft::node_id_t, message_batch::MessageBatch> outbound_batches_;
+            // Buffers ready to be reused for the next sends
+            std::vector<std::vector<char>> free_buffers_;
+            // Pending sends and their buffers (same index), a buffer must live until its send completes
+            std::vector<MPI_Request> send_requests_;
+            std::vector<std::vector<char>> send_buffers_;
+            // Indexes of the completed sends (MPI_Testsome output)
+            std::vector<int> completed_indexes_;
+            // Buffer reused for every received message
+            std::vector<char> receive_buffer_;
     };
 }
@@ -0,0 +1,162 @@
+#include "mpi_staged_rpc.hh"
+
+namespace mpi
+{
+    // Number of message batches each ring holds
+    static const uint64 ring_capacity = 1024;
+    // Time the I/O stage polls for work before sleeping
+    static const std::chrono::microseconds spin_duration(100);
+    // First and maximum sleep of the idle I/O stage
+    static const std::chrono::microseconds min_park_duration(50);
+    static const std::chrono::microseconds max_park_duration(1000);
+
+    StagedRPC::StagedRPC(rpc::RPC& rpc):
+        rpc_(rpc),
+        batching_(false),
+        outbound_batch_(),
+        outbound_batches_(ring_capacity),
+        inbound_batches_(ring_capacity),
+        outbound_backlog_(),
+        inbound_backlog_(),
+        closed_(false)
+    {}
+
+    void StagedRPC::send_message(const message::Message& message)
+    {
+        outbound_batch_.push_back(message);
+
+        if (!batching_)
+            flush_batch();
+    }
+
+    void StagedRPC::begin_batch()
+    {
+        batching_ = true;
+    }
+
+    void StagedRPC::flush_batch()
+    {
+        batching_ = false;
+
+        flush_outbound_backlog();
+
+        if (outbound_batch_.empty())
+            return;
+
+        if (!outbound_backlog_.empty() || !outbound_batches_.push(std::move(outbound_batch_)))
+            outbound_backlog_.push_back(std::move(outbound_batch_));
+
+        outbound_batch_.clear();
+    }
+
+    std::vector<message::Message> StagedRPC::receive_messages()
+    {
+        flush_outbound_backlog();
+
+        std::vector<message::Message> messages;
+        std::vector<message::Message> batch;
+
+        while (inbound_batches_.pop(batch))
+        {
+            if (messages.empty())
+                messages.swap(batch);
+            else
+                std::move(batch.begin(), batch.end(), std::back_inserter(messages));
+        }
+
+        return messages;
+    }
+
+    bool StagedRPC::has_message()
+    {
+        // Also retries the batches the I/O stage had no room for (called while the node loop waits)
+        flush_outbound_backlog();
+
+        return !inbound_batches_.empty();
+    }
+
+    void StagedRPC::close()
+    {
+        while (!outbound_backlog_.empty())
+        {
+            std::this_thread::sleep_for(min_park_duration);
+            flush_outbound_backlog();
+        }
+
+        closed_.store(true, std::memory_order_release);
+    }
+
+    void StagedRPC::run_io()
+    {
+        auto idle_start = std::chrono::steady_clock::now();
+        auto park_duration = min_park_duration;
+
+        while (true)
+        {
+            // Read the flag first: the batches pushed before close() are sent below
+            bool is_closed = closed_.load(std::memory_order_acquire);
+
+            bool is_busy = send_outbound_batches();
+
+            if (is_closed)
+                break;
+
+            flush_inbound_backlog();
+
+            std::vector<message::Message> messages = rpc_.receive_messages();
+
+            if (!messages.empty())
+            {
+                is_busy = true;
+
+                if (!inbound_backlog_.empty() || !inbound_batches_.push(std::move(messages)))
+                    inbound_backlog_.push_back(std::move(messages));
+            }
+
+            if (is_busy)
+            {
+                idle_start = std::chrono::steady_clock::now();
+                park_duration = min_park_duration;
+                continue;
+            }
+
+            // Spin first, then sleep with a growing delay
+            if (std::chrono::steady_clock::now() - idle_start < spin_duration)
+                continue;
+
+            std::this_thread::sleep_for(park_duration);
+            park_duration = std::min(park_duration * 2, max_park_duration);
+        }
+    }
+
+    bool StagedRPC::send_outbound_batches()
+    {
+        std::vector<message::Message> batch;
+        bool has_sent = false;
+
+        // Every batch of the consensus stage is packed by destination as it would have been on a single thread
+        while (outbound_batches_.pop(batch))
+        {
+            rpc_.begin_batch();
+            for (const auto& message: batch)
+                rpc_.send_message(message);
+            rpc_.flush_batch();
+
+            has_sent = true;
+        }
+
+        return has_sent;
+    }
+
+    void StagedRPC::flush_outbound_backlog()
+    {
+        while (!outbound_backlog_.empty() && outbound_batches_.push(std::move(outbound_backlog_.front())))
+            outbound_backlog_.pop_front();
+    }
+
+    void StagedRPC::flush_inbound_backlog()
+    {
+        while (!inbound_backlog_.empty() && inbound_batches_.push(std::move(inbound_backlog_.front())))
+            inbound_backlog_.pop_front();
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector> // std::vector
+#include <deque> // std::deque
+#include <atomic> // std::atomic
+#include <thread> // std::this_thread::sleep_for
+#include <chrono> // std::chrono
+#include <algorithm> // std::min
+#include <iterator> // std::back_inserter
+
+#include "rpc.hh"
+#include "spsc_ring.hh"
+
+#include "types.hh"
+
+namespace mpi
+{
+    // RPC of a node loop running on its own thread (consensus stage), the MPI calls are all made by the I/O stage
+    // The I/O stage receives and deserializes the messages, the consensus stage serializes nothing and never
+    // waits for the network: the message batches go both ways over lock-free SPSC rings
+    // Only the thread that called MPI_Init makes MPI calls (MPI_THREAD_FUNNELED)
+    class StagedRPC: public rpc::RPC
+    {
+        public:
+            StagedRPC(rpc::RPC& rpc);
+
+            // Overriden methods (consensus stage)
+            void send_message(const message::Message& message) override;
+            std::vector<message::Message> receive_messages() override;
+            bool has_message() override;
+            void begin_batch() override;
+            void flush_batch() override;
+
+            // Consensus stage: called once the node loop returned, the I/O stage stops after sending its last messages
+            void close();
+
+            // I/O stage: receive and send the messages until close() is called
+            void run_io();
+        private:
+            // Push the batches waiting for room in the ring (consensus stage)
+            void flush_outbound_backlog();
+            // Push the batches waiting for room in the ring (I/O stage)
+            void flush_inbound_backlog();
+            // Send the batches of the consensus stage, false if there was none
+            bool send_outbound_batches();
+
+            // Implementation used by the I/O stage (mpi::RPC)
+            rpc::RPC& rpc_;
+            // True between begin_batch and flush_batch
+            bool batching_;
+            // Messages waiting for flush_batch (consensus stage)
+            std::vector<message::Message> outbound_batch_;
+            // Consensus stage => I/O stage, each batch is sent packed by destination
+            utils::SPSCRing<std::vector<message::Message>> outbound_batches_;
+            // I/O stage => consensus stage, the messages received by each probe loop
+            utils::SPSCRing<std::vector<message::Message>> inbound_batches_;
+            // Batches produced while their ring was full (each one only touched by its producer)
+            std::deque<std::vector<message::Message>> outbound_backlog_;
+            std::deque<std::vector<message::Message>> inbound_backlog_;
+            // Set by close()
+            std::atomic<bool> closed_;
+    };
+}
@@ -0,0 +1,128 @@
+#include "raft_applier.hh"
+
+namespace raft
+{
+    // Number of tasks each ring holds
+    static const uint64 ring_capacity = 1024;
+    // Time the apply thread polls for the next task before sleeping
+    static const std::chrono::microseconds spin_duration(100);
+    // First and maximum sleep of the idle apply thread
+    static const std::chrono::microseconds min_park_duration(50);
+    static const std::chrono::microseconds max_park_duration(1000);
+
+    Applier::Applier(StateMachineType type, bool is_threaded):
+        state_machine_(make_state_machine(type)),
+        is_threaded_(is_threaded),
+        tasks_(is_threaded ? ring_capacity : 1),
+        completed_tasks_(ring_capacity),
+        backlog_(),
+        commands_(),
+        stopping_(false),
+        apply_thread_()
+    {
+        if (is_threaded_)
+            apply_thread_ = std::thread(&Applier::run_apply_thread, this);
+    }
+
+    Applier::~Applier()
+    {
+        stopping_.store(true, std::memory_order_release);
+
+        if (apply_thread_.joinable())
+            apply_thread_.join();
+    }
+
+    void Applier::submit(ApplyTask&& task)
+    {
+        if (!is_threaded_)
+        {
+            run(task);
+
+            // Inline: the ring is only read by the same thread
+            if (!backlog_.empty() || !completed_tasks_.push(std::move(task)))
+                backlog_.push_back(std::move(task));
+            return;
+        }
+
+        flush_backlog();
+
+        if (!backlog_.empty() || !tasks_.push(std::move(task)))
+            backlog_.push_back(std::move(task));
+    }
+
+    bool Applier::poll(ApplyTask& task)
+    {
+        bool is_completed = completed_tasks_.pop(task);
+
+        flush_backlog();
+
+        return is_completed;
+    }
+
+    bool Applier::has_completed_task()
+    {
+        return !completed_tasks_.empty();
+    }
+
+    void Applier::run_apply_thread()
+    {
+        ApplyTask task;
+
+        auto idle_start = std::chrono::steady_clock::now();
+        auto park_duration = min_park_duration;
+
+        while (!stopping_.load(std::memory_order_acquire))
+        {
+            if (tasks_.pop(task))
+            {
+                run(task);
+
+                // The consensus loop is late: wait for room
+                while (!completed_tasks_.push(std::move(task)) && !stopping_.load(std::memory_order_acquire))
+                    std::this_thread::sleep_for(min_park_duration);
+
+                idle_start = std::chrono::steady_clock::now();
+                park_duration = min_park_duration;
+                continue;
+            }
+
+            // Spin first, then sleep with a growing delay
+            if (std::chrono::steady_clock::now() - idle_start < spin_duration)
+                continue;
+
+            std::this_thread::sleep_for(park_duration);
+            park_duration = std::min(park_duration * 2, max_park_duration);
+        }
+    }
+
+    void Applier::run(ApplyTask& task)
+    {
+        task.results.clear();
+
+        switch (task.type)
+        {
+            case ApplyTaskType::APPLY:
+                commands_.assign(task.inputs.begin(), task.inputs.end());
+                state_machine_->apply(commands_, task.results);
+                break;
+            case ApplyTaskType::QUERY:
+                for (const auto& query: task.inputs)
+                    task.results.push_back(state_machine_->query(query));
+                break;
+            case ApplyTaskType::SAVE:
+                task.results.push_back(state_machine_->save());
+                break;
+            case ApplyTaskType::RESTORE:
+                state_machine_->restore(task.inputs.front());
+                break;
+        }
+    }
+
+    void Applier::flush_backlog()
+    {
+        utils::SPSCRing<ApplyTask>& ring = is_threaded_ ? tasks_ : completed_tasks_;
+
+        while (!backlog_.empty() && ring.push(std::move(backlog_.front())))
+            backlog_.pop_front();
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string> // std::string
+#include <string_view> // std::string_view
+#include <vector> // std::vector
+#include <deque> // std::deque
+#include <memory> // std::unique_ptr
+#include <thread> // std::thread
+#include <atomic> // std::atomic
+#include <chrono> // std::chrono
+
+#include "raft_state_machine.hh"
+#include "raft_types.hh"
+#include "spsc_ring.hh"
+#include "types.hh"
+
+namespace raft
+{
+    // APPLY: apply a batch of committed commands
+    // QUERY: answer the queries of reads once every previous batch is applied
+    // SAVE: save the state for a snapshot
+    // RESTORE: replace the state by the one of a snapshot
+    enum class ApplyTaskType { APPLY, QUERY, SAVE, RESTORE };
+
+    struct ApplyTask
+    {
+        ApplyTaskType type;
+        // APPLY: last log index of the batch (skipped entries included), QUERY: read index, SAVE: snapshot index
+        index_t index;
+        // APPLY: log index of each command
+        std::vector<index_t> indexes;
+        // APPLY: commands, QUERY: queries, RESTORE: state to restore (single element)
+        std::vector<std::string> inputs;
+        // Filled by the applier: the result of each command or query, SAVE: the saved state (single element)
+        std::vector<std::string> results;
+    };
+
+    // Owns the state machine and runs its tasks in submission order, the completed tasks come back in the same order
+    // Threaded: the tasks go to an apply thread and come back over lock-free SPSC rings, so a slow state machine
+    // never delays the consensus loop (heartbeats and elections)
+    // Inline: the tasks are run by submit() itself
+    class Applier
+    {
+        public:
+            Applier(StateMachineType type, bool is_threaded);
+            ~Applier();
+
+            void submit(ApplyTask&& task);
+            // Next completed task, false if there is none yet
+            bool poll(ApplyTask& task);
+            bool has_completed_task();
+        private:
+            void run_apply_thread();
+            void run(ApplyTask& task);
+            // Push the tasks waiting for room in the ring
+            void flush_backlog();
+
+            std::unique_ptr<StateMachine> state_machine_;
+            bool is_threaded_;
+            // Consensus loop => apply thread
+            utils::SPSCRing<ApplyTask> tasks_;
+            // Apply thread => consensus loop (inline: the completed tasks)
+            utils::SPSCRing<ApplyTask> completed_tasks_;
+            // Tasks submitted while the ring was full (consensus loop only)
+            std::deque<ApplyTask> backlog_;
+            // Views on the inputs of the task being applied (reused)
+            std::vector<std::string_view> commands_;
+            std::atomic<bool> stopping_;
+            std::thread apply_thread_;
+    };
+}
@@ -7,7 +7,8 @@ namespace raft
     Client::Client(
         node_id_t id,
         node_id_t controller_id,
-        const std::vector<node_id_t> server_ids
+        const std::vector<node_id_t> server_ids,
+        const Config& config
     ):
         id_(id),
         controller_id_(controller_id),
@@ -17,9 +18,16 @@ namespace raft
         leader_clock_(),
         command_clock_(),
         leader_id_(std::nullopt),
+        forward_commands_(config.forward_commands),
+        server_index_(id % server_ids.size()),
         commands_to_send_(),
-        next_command_sent_(true),
-        running_(true)
+        inflight_commands_(),
+        next_sequence_(1),
+        max_inflight_commands_(config.client_max_inflight),
+        inflight_reads_(),
+        next_read_sequence_(1),
+        running_(true),
+        waiter_(config.wait_mode)
     {}
 
     void Client::run()
@@ -30,19 +38,10 @@ namespace raft
 
         while (running_)
         {
-            receive_controller_messages();
+            step();
 
-            if (state_ != ClientState::DEAD)
-            {
-                receive_servers_messages();
-
-                if (leader_id_ == std::nullopt)
-                    search_leader();
-                else if (next_command_sent_)
-                    send_next_command();
-                else if (!next_command_sent_)
-                    check_command_timeout();
-            }
+            // Sleep until the next message or timer
+            waiter_.wait(rpc_, next_timeout(), []() { return false; });
         }
 
         #ifdef DEBUG
@@ -52,6 +51,22 @@ namespace raft
         sleep(1);
     }
 
+    void Client::step()
+    {
+        receive_all_messages();
+
+        if (state_ != ClientState::DEAD)
+        {
+            if (leader_id_ == std::nullopt)
+                search_leader();
+            else
+            {
+                send_next_commands();
+                check_command_timeout();
+            }
+        }
+    }
+
     // MARK - Private
 
     void Client::start()
@@ -76,29 +91,28 @@ namespace raft
         while(!commands_to_send_.empty())
             commands_to_send_.pop();
 
-        // Ready to send new commands
-        next_command_sent_ = true;
+        inflight_commands_.clear();
+        inflight_reads_.clear();
     }
 
-    // Listen to messages from servers
-    void Client::receive_servers_messages()
+    // Listen to messages from the controller and servers
+    void Client::receive_all_messages()
     {
-        for (const auto& id: server_ids_)
+        for (const auto& message: rpc_->receive_messages())
         {
-            while (running_)
-            {
-                std::optional<message::Message> message = rpc_->receive_message(id);
-
-                if (message.has_value())
-                    handle_server_message(message.value());
-                else
-                    break;
-            }
+            if (message.source_id() == controller_id_)
+                handle_controller_message(message);
+            else if (state_ != ClientState::DEAD) // A crashed client loses the messages sent to it
+                handle_server_message(message);
         }
     }
 
     void Client::handle_search_leader_response(const message::Message& message)
     {
+        // Every server knowing the leader answers, the first answer is enough
+        if (leader_id_)
+            return;
+
         search_leader::SearchLeaderResponse response;
         message.payload().UnpackTo(&response);
 
@@ -115,11 +129,60 @@ namespace raft
         message.payload().UnpackTo(&response);
 
         if (response.command_committed())
-            commands_to_send_.pop();
-        else
+        {
+            // Completions can arrive in any order, the already acknowledged ones are ignored
+            for (int i = 0; i < response.sequences_size(); ++i)
+            {
+                auto command = inflight_commands_.find(response.sequences(i));
+
+                if (command == inflight_commands_.end())
+                    continue;
+
+                // Result given by the state machine, if any
+                if (i < response.results_size() && !response.results(i).empty())
+                    std::cout << "Client " << id_ << " applied '" << command->second.command << "': " << response.results(i) << std::endl;
+
+                inflight_commands_.erase(command);
+            }
+
+            command_clock_.reset();
+        }
+        else if (leader_id_ == std::make_optional(message.source_id()))
+        {
+            // Not (or no longer) the leader: retry with its hint right away, or look for the new leader
             reset_leader();
 
-        next_command_sent_ = true;
+            // The server forwarding the commands is retried after a timeout, once it knows the new leader
+            if (response.has_leader_hint() && !forward_commands_)
+            {
+                leader_id_ = std::make_optional(response.leader_hint().value());
+
+                #ifdef DEBUG
+                std::cout << "Client " << id_ << " redirected to leader " << leader_id_.value() << std::endl;
+                #endif
+            }
+        }
+    }
+
+    void Client::handle_read_response(const message::Message& message)
+    {
+        read_index::ReadResponse response;
+        message.payload().UnpackTo(&response);
+
+        if (response.success())
+        {
+            if (inflight_reads_.erase(response.sequence()) > 0)
+                std::cout << "Client " << id_ << " read '" << response.value() << "' at index " << response.read_index() << std::endl;
+
+            command_clock_.reset();
+        }
+        else if (leader_id_ == std::make_optional(message.source_id()))
+        {
+            reset_leader();
+
+            if (response.has_leader_hint() && !forward_commands_)
+                leader_id_ = std::make_optional(response.leader_hint().value());
+        }
     }
 
     // Handle server message depending the message type
@@ -132,21 +195,11 @@ namespace raft
                 break;
             case message::MessageType::COMMAND_ENTRY_RESPONSE:
                 handle_command_entry_response(message);
-            default:
                 break;
-        }
-    }
-
-    // Listen to messages from the controller
-    void Client::receive_controller_messages()
-    {
-        while (running_)
-        {
-            std::optional<message::Message> message = rpc_->receive_message(controller_id_);
-
-            if (message.has_value())
-                handle_controller_message(message.value());
-            else
+            case message::MessageType::READ_RESPONSE:
+                handle_read_response(message);
+                break;
+            default:
                 break;
         }
     }
@@ -190,6 +243,17 @@ namespace raft
         }
     }
 
+    void Client::handle_read_request(const message::Message& message)
+    {
+        if (state_ == ClientState::ALIVE)
+        {
+            read_index::ReadRequest request;
+            message.payload().UnpackTo(&request);
+
+            inflight_reads_.emplace(next_read_sequence_++, InflightRead { request.query(), false });
+        }
+    }
+
     void Client::handle_controller_message(const message::Message& message)
     {
         switch (message.type())
@@ -203,6 +267,9 @@ namespace raft
             case message::MessageType::COMMAND_ENTRY_REQUEST:
                 handle_command_entry_request(message);
                 break;
+            case message::MessageType::READ_REQUEST:
+                handle_read_request(message);
+                break;
             case message::MessageType::EXIT:
                 running_ = false;
                 break;
@@ -217,6 +284,13 @@ namespace raft
         {
             leader_clock_.reset();
 
+            // No search: the server forwards the commands to the leader it knows
+            if (forward_commands_)
+            {
+                leader_id_ = std::make_optional(server_ids_.at(server_index_));
+                return;
+            }
+
             // Send search leader request to all servers
             message::Message message;
             message.set_source_id(id_);
@@ -238,36 +312,120 @@ namespace raft
             leader_id_ = std::nullopt;
             leader_clock_.reset();
         }
+
+        // The unacknowledged commands will be sent again to the next leader
+        for (auto& [sequence, command]: inflight_commands_)
+            command.is_sent = false;
+        for (auto& [sequence, read]: inflight_reads_)
+            read.is_sent = false;
     }
 
-    void Client::send_next_command()
+    // Fill the window of commands in flight, the unacknowledged commands first
+    void Client::send_next_commands()
     {
-        if (!commands_to_send_.empty() && leader_id_.has_value())
+        if (!leader_id_.has_value())
+            return;
+
+        bool is_sent = false;
+
+        for (auto& [sequence, command]: inflight_commands_)
         {
-            std::string command = commands_to_send_.front();
+            if (!command.is_sent)
+            {
+                send_command(sequence, command.command);
+                command.is_sent = true;
+                is_sent = true;
+            }
+        }
 
-            // Send the command to the leader
+        for (auto& [sequence, read]: inflight_reads_)
+        {
+            if (!read.is_sent)
+            {
+                send_read(sequence, read.query);
+                read.is_sent = true;
+                is_sent = true;
+            }
+        }
 
-            command_entry::CommandEntryRequest request;
-            request.set_command(command);
+        while (!commands_to_send_.empty() && inflight_commands_.size() < max_inflight_commands_)
+        {
+            uint64 sequence = next_sequence_++;
 
-            message::Message message;
-            message.set_source_id(id_);
-            message.set_dest_id(leader_id_.value());
-            message.set_type(message::MessageType::COMMAND_ENTRY_REQUEST);
-            message.mutable_payload()->PackFrom(request);
-            rpc_->send_message(message);
+            send_command(sequence, commands_to_send_.front());
+            inflight_commands_.emplace(sequence, InflightCommand { commands_to_send_.front(), true });
+            commands_to_send_.pop();
+            is_sent = true;
+        }
 
-            next_command_sent_ = false;
+        // Timeout from the last command sent or acknowledged
+        if (is_sent)
             command_clock_.reset();
-        }
     }
 
+    void Client::send_command(uint64 sequence, const std::string& command)
+    {
+        command_entry::CommandEntryRequest request;
+        request.set_command(command);
+        request.set_sequence(sequence);
+        // Every command before the first one in flight was committed: the sessions can forget them
+        request.set_first_unacked_sequence(inflight_commands_.empty() ? sequence : std::min(sequence, inflight_commands_.begin()->first));
+
+        message::Message message;
+        message.set_source_id(id_);
+        message.set_dest_id(leader_id_.value());
+        message.set_type(message::MessageType::COMMAND_ENTRY_REQUEST);
+        message.mutable_payload()->PackFrom(request);
+        rpc_->send_message(message);
+    }
+
+    void Client::send_read(uint64 sequence, const std::string& query)
+    {
+        read_index::ReadRequest request;
+        request.set_sequence(sequence);
+        request.set_query(query);
+
+        message::Message message;
+        message.set_source_id(id_);
+        message.set_dest_id(leader_id_.value());
+        message.set_type(message::MessageType::READ_REQUEST);
+        message.mutable_payload()->PackFrom(request);
+        rpc_->send_message(message);
+    }
+
+    // Time (ms) until the next timer of the client loop, none if only a message can wake it up
+    std::optional<time_t> Client::next_timeout()
+    {
+        if (!running_)
+            return std::make_optional(0);
+
+        if (state_ == ClientState::DEAD)
+            return std::nullopt;
+
+        // Leader search
+        if (!leader_id_)
+            return std::make_optional(timeout_ - leader_clock_.get_time());
+
+        // Next command ready to be sent
+        if (!commands_to_send_.empty() && inflight_commands_.size() < max_inflight_commands_)
+            return std::make_optional(0);
+
+        // Command or read timeout
+        if (!inflight_commands_.empty() || !inflight_reads_.empty())
+            return std::make_optional(timeout_ - command_clock_.get_time());
+
+        return std::nullopt;
+    }
+
+    // No command was acknowledged for a timeout: the leader is probably gone
     void Client::check_command_timeout()
     {
-        if (!commands_to_send_.empty() && leader_clock_.get_time() >= timeout_)
+        if ((!inflight_commands_.empty() || !inflight_reads_.empty()) && command_clock_.get_time() >= timeout_)
         {
-            next_command_sent_ = true;
+            // The server forwarding the commands may be gone as well: try the next one
+            if (forward_commands_)
+                server_index_ = (server_index_ + 1) % server_ids_.size();
+
             reset_leader();
         }
     }
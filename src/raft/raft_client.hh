@@ -2,10 +2,14 @@
 
 #include <iostream> // std::cout
 #include <queue> // std::queue
+#include <map> // std::map
+#include <algorithm> // std::min
 #include <fstream> // std::ifstream std::getline
 #include <unistd.h> // sleep
 
 #include "raft_clock.hh"
+#include "raft_config.hh"
+#include "raft_waiter.hh"
 #include "rpc.hh"
 #include "raft_types.hh"
 #include "serialization.hh"
@@ -15,6 +19,7 @@
 #include "proto/message.pb.h"
 #include "proto/command_entry.pb.h"
 #include "proto/search_leader.pb.h"
+#include "proto/read_index.pb.h"
 
 namespace raft
 {
@@ -23,9 +28,16 @@ namespace raft
     class Client
     {
         public:
-            Client(node_id_t id, node_id_t controller_id, const std::vector<node_id_t> server_ids);
+            Client(node_id_t id, node_id_t controller_id, const std::vector<node_id_t> server_ids, const Config& config);
             void set_rpc(class rpc::RPC* rpc) { rpc_ = rpc; }
             void run();
+
+            // MARK: - Multi-Raft (a client per group share the loop of a rank)
+
+            // One iteration of the client loop, without waiting
+            void step();
+            std::optional<time_t> next_timeout();
+            bool is_running() const { return running_; }
         private:
             void start();
             void crash();
@@ -33,19 +45,19 @@ namespace raft
 
             // MARK: - Server messages
 
-            void receive_servers_messages();
+            void receive_all_messages();
 
             void handle_search_leader_response(const message::Message& message);
             void handle_command_entry_response(const message::Message& message);
+            void handle_read_response(const message::Message& message);
             void handle_server_message(const message::Message& message);
 
             // MARK: - Controller messages
 
-            void receive_controller_messages();
-
             void handle_crash_request();
             void handle_start_request();
             void handle_command_entry_request(const message::Message& message);
+            void handle_read_request(const message::Message& message);
             void handle_controller_message(const message::Message& message);
 
             // MARK: - Leader methods
@@ -55,7 +67,9 @@ namespace raft
 
             // MARK: - Command methods
 
-            void send_next_command();
+            void send_next_commands();
+            void send_command(uint64 sequence, const std::string& command);
+            void send_read(uint64 sequence, const std::string& query);
             void check_command_timeout();
 
             // Id of the client
@@ -72,14 +86,43 @@ namespace raft
             Clock leader_clock_;
             // Clock used for command timeout
             Clock command_clock_;
-            // Leader Id
+            // Leader Id (or the server forwarding the commands to the leader)
             std::optional<node_id_t> leader_id_;
+            // The commands are sent to a single server that forwards them to the leader
+            bool forward_commands_;
+            // Index of the server the commands are sent to, when they are forwarded
+            uint32 server_index_;
+            struct InflightCommand
+            {
+                std::string command;
+                // False when the command must be sent (again) to the leader
+                bool is_sent;
+            };
+
             // Queue of commands to send to the leader
             std::queue<std::string> commands_to_send_;
-            // False when the next command in the queue is not committed on the leader
-            bool next_command_sent_;
+            // Commands sent and not committed yet, by sequence number
+            std::map<uint64, InflightCommand> inflight_commands_;
+            // Sequence number of the next command
+            uint64 next_sequence_;
+            // Maximum number of commands in flight
+            uint32 max_inflight_commands_;
+            struct InflightRead
+            {
+                // Query passed to the state machine
+                std::string query;
+                // False when the read must be sent (again) to the leader
+                bool is_sent;
+            };
+
+            // Reads not answered yet by sequence number
+            std::map<uint64, InflightRead> inflight_reads_;
+            // Sequence number of the next read
+            uint64 next_read_sequence_;
             // Is running
             bool running_;
+            // Waits for the next message or timer between two iterations
+            Waiter waiter_;
         protected:
             rpc::RPC* rpc_ = nullptr;
     };
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "raft_types.hh"
+#include "raft_waiter.hh"
+#include "raft_state_machine.hh"
+
+namespace raft
+{
+    // Tunables of the raft nodes (set from the command line)
+    struct Config
+    {
+        // Time window (ms) during which log writes are gathered before a single fdatasync (0 = as soon as possible)
+        time_t sync_window = 0;
+        // Number of applied log entries after which the log is compacted in a snapshot (0 = never)
+        index_t snapshot_threshold = 10000;
+        // Maximum size (bytes) of a snapshot chunk sent to a follower
+        uint64 snapshot_chunk_size = 64 * 1024;
+        // Maximum number of AppendEntries requests in flight per follower
+        uint32 max_inflight = 16;
+        // Maximum size (bytes) of the log entries in flight per follower
+        uint64 max_inflight_bytes = 1024 * 1024;
+        // Leader batching window: the commands received during this time (ms) are appended and replicated together
+        time_t command_batch_window = 0;
+        // The batching window is closed early after this number of commands...
+        uint32 command_batch_size = 256;
+        // ... or this size (bytes) of commands
+        uint64 command_batch_bytes = 256 * 1024;
+        // Followers forward the client commands to the leader, the clients stick to a single server
+        bool forward_commands = false;
+        // Maximum number of commands a client keeps in flight
+        uint32 client_max_inflight = 16;
+        // Maximum number of client sessions kept for duplicate suppression (least recently used evicted first)
+        uint32 max_sessions = 1024;
+        // Maximum number of messages handled per loop iteration
+        uint32 message_budget = 64;
+        // Election timeouts start with a pre-vote, the term is only increased if a majority would grant the vote
+        bool pre_vote = false;
+        // The leader steps down when it did not hear from a majority during an election timeout
+        bool check_quorum = false;
+        // The leader periodically hands the leadership over to a server that handles the messages faster
+        bool auto_balance = false;
+        // The leader serves the reads locally while a majority acknowledged it within the minimum election timeout
+        bool lease_reads = false;
+        // Margin (ms) taken off the lease for the clock drift between the servers
+        time_t lease_drift = 10;
+        // State machine the committed commands are applied to
+        StateMachineType state_machine = StateMachineType::LAST_COMMAND;
+        // The state machine runs on a dedicated thread, fed by the server loop over a lock-free ring
+        bool apply_thread = false;
+        // The MPI calls run on an I/O thread, the node loop on its own thread: they exchange the messages over lock-free rings
+        bool io_thread = false;
+        // Number of independent Raft groups hosted by each rank (Multi-Raft)
+        uint32 groups = 1;
+        // How the server and client loops wait for the next message or timer
+        WaitMode wait_mode = WaitMode::ADAPTIVE;
+    };
+}
@@ -27,6 +27,19 @@ namespace raft
         rpc_->send_message(message);
     }
 
+    void Controller::send_read_request(node_id_t id, const std::string& query)
+    {
+        read_index::ReadRequest request;
+        request.set_query(query);
+
+        message::Message message;
+        message.set_source_id(id_);
+        message.set_type(message::MessageType::READ_REQUEST);
+        message.set_dest_id(id);
+        message.mutable_payload()->PackFrom(request);
+        rpc_->send_message(message);
+    }
+
     void Controller::send_crash_request(node_id_t id)
     {
         message::Message message;
@@ -80,6 +93,23 @@ namespace raft
         rpc_->send_message(message);
     }
 
+    // Sent to every server, only the leader handles it
+    void Controller::send_transfer_leader_request(node_id_t target_id)
+    {
+        transfer_leader::TransferLeaderRequest request;
+        request.set_target_id(target_id);
+
+        for (const auto& id: server_ids_)
+        {
+            message::Message message;
+            message.set_source_id(id_);
+            message.set_type(message::MessageType::TRANSFER_LEADER_REQUEST);
+            message.set_dest_id(id);
+            message.mutable_payload()->PackFrom(request);
+            rpc_->send_message(message);
+        }
+    }
+
     speed::Speed Controller::string_to_speed(const std::string& str)
     {
         speed::Speed speed = speed::Speed::UNKNOWN;
@@ -153,6 +183,26 @@ namespace raft
 
                             continue;
                         }
+                        else if (command == "READ")
+                        {
+                            send_read_request(node_id, result.size() >= 3 ? result[2] : "");
+
+                            #ifdef DEBUG
+                            std::cout << "Sending a read request to node " << node_id << "..." << std::endl;
+                            #endif
+
+                            continue;
+                        }
+                        else if (command == "TRANSFER_LEADER")
+                        {
+                            send_transfer_leader_request(node_id);
+
+                            #ifdef DEBUG
+                            std::cout << "Sending a leadership transfer request to node " << node_id << "..." << std::endl;
+                            #endif
+
+                            continue;
+                        }
                         else if (command == "START" || command == "RECOVER")
                         {
                             send_start_request(node_id);
@@ -164,21 +214,23 @@ namespace raft
                             continue;
                         }
 
-                        if (result.size() == 3)
+                        if (command == "SEND_COMMAND" && result.size() >= 3)
                         {
-                            if (command == "SEND_COMMAND")
-                            {
-                                std::string str = result[2];
+                            // The command is the rest of the line (e.g. PUT [KEY] [VALUE])
+                            std::string str = boost::algorithm::join(std::vector<std::string>(result.begin() + 2, result.end()), " ");
 
-                                send_command_request(node_id, str);
+                            send_command_request(node_id, str);
 
-                                #ifdef DEBUG
-                                std::cout << "Sending a command request to node " << node_id << "..." << std::endl;
-                                #endif
+                            #ifdef DEBUG
+                            std::cout << "Sending a command request to node " << node_id << "..." << std::endl;
+                            #endif
 
-                                continue;
-                            }
-                            else if (command == "SET_ELECTION_TIMEOUT")
+                            continue;
+                        }
+
+                        if (result.size() == 3)
+                        {
+                            if (command == "SET_ELECTION_TIMEOUT")
                             {
                                 uint32 timeout = std::stoi(result[2]);
 
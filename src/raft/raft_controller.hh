@@ -15,6 +15,8 @@
 #include "proto/command_entry.pb.h"
 #include "proto/election_timeout.pb.h"
 #include "proto/speed.pb.h"
+#include "proto/transfer_leader.pb.h"
+#include "proto/read_index.pb.h"
 
 namespace raft
 {
@@ -26,11 +28,13 @@ namespace raft
             void run();
         private:
             void send_command_request(node_id_t id, const std::string& str);
+            void send_read_request(node_id_t id, const std::string& query);
             void send_crash_request(node_id_t id);
             void send_start_request(node_id_t id);
             void send_exit_request(node_id_t id);
             void send_election_timeout_request(node_id_t id, time_t timeout);
             void send_speed_request(node_id_t id, speed::Speed speed);
+            void send_transfer_leader_request(node_id_t target_id);
 
             speed::Speed string_to_speed(const std::string& str);
 
@@ -0,0 +1,90 @@
+#include "raft_kv_state_machine.hh"
+
+namespace raft
+{
+    // Next space separated word of the command, the rest of the command is left in command
+    static std::string_view next_word(std::string_view& command)
+    {
+        std::string_view::size_type end = command.find(' ');
+        std::string_view word = command.substr(0, end);
+
+        command = end == std::string_view::npos ? std::string_view() : command.substr(end + 1);
+
+        return word;
+    }
+
+    void KVStateMachine::apply(const std::vector<std::string_view>& commands, std::vector<std::string>& results)
+    {
+        for (const auto& command: commands)
+            results.push_back(apply_command(command));
+    }
+
+    std::string KVStateMachine::query(const std::string& query) const
+    {
+        return get(query);
+    }
+
+    std::string KVStateMachine::save() const
+    {
+        kv_state::State state;
+
+        engine_.for_each([&state](std::string_view key, std::string_view value) {
+            kv_state::Entry* entry = state.add_entries();
+            entry->set_key(key.data(), key.size());
+            entry->set_value(value.data(), value.size());
+        });
+
+        return state.SerializeAsString();
+    }
+
+    void KVStateMachine::restore(const std::string& data)
+    {
+        kv_state::State state;
+        state.ParseFromString(data);
+
+        engine_.clear();
+        for (const auto& entry: state.entries())
+            engine_.put(entry.key(), entry.value());
+    }
+
+    std::string KVStateMachine::apply_command(std::string_view command)
+    {
+        std::string_view operation = next_word(command);
+        std::string_view key = next_word(command);
+
+        if (key.empty())
+            return "INVALID";
+
+        if (operation == "PUT")
+        {
+            engine_.put(key, command);
+            return "OK";
+        }
+
+        if (operation == "GET" && command.empty())
+            return get(key);
+
+        if (operation == "DEL" && command.empty())
+            return engine_.erase(key) ? "OK" : "NOT_FOUND";
+
+        if (operation == "CAS")
+        {
+            std::string_view expected = next_word(command);
+            std::string_view desired = next_word(command);
+
+            if (!command.empty())
+                return "INVALID";
+
+            return engine_.compare_and_swap(key, expected, desired) ? "OK" : "FAILED";
+        }
+
+        return "INVALID";
+    }
+
+    std::string KVStateMachine::get(std::string_view key) const
+    {
+        std::optional<std::string_view> value = engine_.get(key);
+
+        return value ? std::string(value.value()) : "NOT_FOUND";
+    }
+}
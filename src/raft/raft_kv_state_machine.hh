@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string> // std::string
+#include <string_view> // std::string_view
+#include <vector> // std::vector
+
+#include "raft_state_machine.hh"
+#include "kv_engine.hh"
+#include "types.hh"
+
+// Proto includes
+#include "proto/kv_state.pb.h"
+
+namespace raft
+{
+    // Key-value state machine, the commands are:
+    // PUT [KEY] [VALUE...] => OK
+    // GET [KEY] => the value, NOT_FOUND
+    // DEL [KEY] => OK, NOT_FOUND
+    // CAS [KEY] [EXPECTED] [DESIRED] => OK, FAILED (the key must exist with the expected value)
+    // anything else => INVALID
+    // A query (read) is a key and returns what GET returns
+    class KVStateMachine: public StateMachine
+    {
+        public:
+            // Overriden methods
+            void apply(const std::vector<std::string_view>& commands, std::vector<std::string>& results) override;
+            std::string query(const std::string& query) const override;
+            std::string save() const override;
+            void restore(const std::string& data) override;
+        private:
+            std::string apply_command(std::string_view command);
+            std::string get(std::string_view key) const;
+
+            kv::Engine engine_;
+    };
+}
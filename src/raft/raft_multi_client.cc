@@ -0,0 +1,113 @@
+#include "raft_multi_client.hh"
+
+namespace raft
+{
+    // MARK: - Public
+
+    MultiClient::MultiClient(
+        node_id_t id,
+        node_id_t controller_id,
+        const std::vector<node_id_t> server_ids,
+        const Config& config
+    ):
+        id_(id),
+        controller_id_(controller_id),
+        group_rpcs_(),
+        clients_(),
+        waiter_(config.wait_mode)
+    {
+        for (group_id_t group_id = 0; group_id < config.groups; ++group_id)
+        {
+            group_rpcs_.push_back(std::make_unique<rpc::GroupRPC>(group_id));
+            clients_.push_back(std::make_unique<Client>(id, controller_id, server_ids, config));
+            clients_.back()->set_rpc(group_rpcs_.back().get());
+        }
+    }
+
+    void MultiClient::set_rpc(class rpc::RPC* rpc)
+    {
+        rpc_ = rpc;
+
+        for (auto& group_rpc: group_rpcs_)
+            group_rpc->set_transport(rpc);
+    }
+
+    void MultiClient::run()
+    {
+        #ifdef DEBUG
+        std::cout << "Client " << id_ << " running " << clients_.size() << " groups..." << std::endl;
+        #endif
+
+        while (clients_.front()->is_running())
+        {
+            // The messages of every group are packed by destination
+            rpc_->begin_batch();
+
+            receive_all_messages();
+
+            for (auto& client: clients_)
+                client->step();
+
+            rpc_->flush_batch();
+
+            // Sleep until the next message or timer of any group
+            waiter_.wait(rpc_, next_timeout(), []() { return false; });
+        }
+
+        #ifdef DEBUG
+        std::cout << "Client " << id_ << " is stopping..." << std::endl;
+        #endif
+
+        sleep(1);
+    }
+
+    // MARK: - Private
+
+    void MultiClient::receive_all_messages()
+    {
+        for (auto& message: rpc_->receive_messages())
+        {
+            if (message.source_id() == controller_id_)
+            {
+                if (message.type() == message::MessageType::COMMAND_ENTRY_REQUEST)
+                {
+                    command_entry::CommandEntryRequest request;
+                    message.payload().UnpackTo(&request);
+
+                    group_rpcs_.at(rpc::key_group(rpc::command_key(request.command()), group_rpcs_.size()))->deliver(std::move(message));
+                }
+                else
+                {
+                    read_index::ReadRequest request;
+                    if (message.type() == message::MessageType::READ_REQUEST)
+                        message.payload().UnpackTo(&request);
+
+                    if (!request.query().empty())
+                        group_rpcs_.at(rpc::key_group(request.query(), group_rpcs_.size()))->deliver(std::move(message));
+                    else // Crash, start, read without key or exit: every group handles it
+                    {
+                        for (auto& group_rpc: group_rpcs_)
+                            group_rpc->deliver(message::Message(message));
+                    }
+                }
+            }
+            else if (message.group_id() < group_rpcs_.size())
+                group_rpcs_.at(message.group_id())->deliver(std::move(message));
+        }
+    }
+
+    std::optional<time_t> MultiClient::next_timeout()
+    {
+        std::optional<time_t> timeout = std::nullopt;
+
+        for (auto& client: clients_)
+        {
+            std::optional<time_t> client_timeout = client->next_timeout();
+
+            if (client_timeout)
+                timeout = std::make_optional(timeout ? std::min(timeout.value(), client_timeout.value()) : client_timeout.value());
+        }
+
+        return timeout;
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <iostream> // std::cout
+#include <vector> // std::vector
+#include <memory> // std::unique_ptr
+#include <string> // std::string
+#include <unistd.h> // sleep
+
+#include "raft_client.hh"
+#include "raft_config.hh"
+#include "raft_waiter.hh"
+#include "group_rpc.hh"
+#include "rpc.hh"
+#include "raft_types.hh"
+#include "types.hh"
+
+// Proto includes
+#include "proto/message.pb.h"
+#include "proto/command_entry.pb.h"
+#include "proto/read_index.pb.h"
+
+namespace raft
+{
+    // Multi-Raft: a client rank runs one client per Raft group and routes each command to the group of its key
+    class MultiClient
+    {
+        public:
+            MultiClient(node_id_t id, node_id_t controller_id, const std::vector<node_id_t> server_ids, const Config& config);
+            void set_rpc(class rpc::RPC* rpc);
+            void run();
+        private:
+            // Dispatch the server messages to their group, the commands and reads of the controller to the group of their key
+            void receive_all_messages();
+            std::optional<time_t> next_timeout();
+
+            // Id of the client
+            node_id_t id_;
+            // Id of the controller that rules them all
+            node_id_t controller_id_;
+            // RPC of each group, index = group id
+            std::vector<std::unique_ptr<rpc::GroupRPC>> group_rpcs_;
+            // Client of each group, index = group id
+            std::vector<std::unique_ptr<Client>> clients_;
+            // Waits for the next message or timer between two iterations
+            Waiter waiter_;
+        protected:
+            rpc::RPC* rpc_ = nullptr;
+    };
+}
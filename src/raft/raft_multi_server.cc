@@ -0,0 +1,138 @@
+#include "raft_multi_server.hh"
+
+namespace raft
+{
+    // Interval (ms) between two heartbeat ticks shared by the groups (the heartbeat timeout)
+    static const time_t heartbeat_interval = 50;
+
+    // MARK: - Public
+
+    MultiServer::MultiServer(
+        node_id_t id,
+        node_id_t controller_id,
+        const std::vector<node_id_t> server_ids,
+        const std::vector<node_id_t> node_ids,
+        const Config& config
+    ):
+        id_(id),
+        controller_id_(controller_id),
+        group_rpcs_(),
+        servers_(),
+        heartbeat_clock_(),
+        waiter_(config.wait_mode)
+    {
+        for (group_id_t group_id = 0; group_id < config.groups; ++group_id)
+        {
+            group_rpcs_.push_back(std::make_unique<rpc::GroupRPC>(group_id));
+            servers_.push_back(std::make_unique<Server>(id, group_id, controller_id, server_ids, node_ids, config));
+            servers_.back()->set_rpc(group_rpcs_.back().get());
+        }
+    }
+
+    void MultiServer::set_rpc(class rpc::RPC* rpc)
+    {
+        rpc_ = rpc;
+
+        for (auto& group_rpc: group_rpcs_)
+            group_rpc->set_transport(rpc);
+    }
+
+    void MultiServer::run()
+    {
+        #ifdef DEBUG
+        std::cout << "Server " << id_ << " running " << servers_.size() << " groups..." << std::endl;
+        #endif
+
+        std::vector<uint64> durable_sequences(servers_.size());
+
+        while (is_running())
+        {
+            for (uint32 i = 0; i < servers_.size(); ++i)
+                durable_sequences.at(i) = servers_.at(i)->durable_sequence();
+
+            step();
+
+            // Sleep until the next message, timer, durable write or applied task of any group
+            waiter_.wait(rpc_, next_timeout(), [this, &durable_sequences]() {
+                for (uint32 i = 0; i < servers_.size(); ++i)
+                {
+                    if (servers_.at(i)->durable_sequence() != durable_sequences.at(i) || servers_.at(i)->has_applied_task())
+                        return true;
+                }
+
+                return false;
+            });
+        }
+
+        #ifdef DEBUG
+        std::cout << "Server " << id_ << " is stopping..." << std::endl;
+        #endif
+
+        sleep(1);
+    }
+
+    // One iteration of the loop for every group
+    void MultiServer::step()
+    {
+        // The messages of every group are packed by destination
+        rpc_->begin_batch();
+
+        receive_all_messages();
+
+        bool is_heartbeat_tick = heartbeat_clock_.get_time() >= heartbeat_interval;
+        if (is_heartbeat_tick)
+            heartbeat_clock_.reset();
+
+        for (auto& server: servers_)
+        {
+            if (is_heartbeat_tick)
+                server->coalesce_heartbeats();
+
+            server->step();
+        }
+
+        rpc_->flush_batch();
+    }
+
+    // MARK: - Private
+
+    void MultiServer::receive_all_messages()
+    {
+        for (auto& message: rpc_->receive_messages())
+        {
+            if (message.source_id() == controller_id_)
+            {
+                // A command is appended by the group of its key only, so the controller gets a single response
+                if (message.type() == message::MessageType::COMMAND_ENTRY_REQUEST)
+                {
+                    command_entry::CommandEntryRequest request;
+                    message.payload().UnpackTo(&request);
+
+                    group_rpcs_.at(rpc::key_group(rpc::command_key(request.command()), group_rpcs_.size()))->deliver(std::move(message));
+                }
+                else // The other requests target the rank (crash, start, speed...): every group handles them, none answers
+                {
+                    for (auto& group_rpc: group_rpcs_)
+                        group_rpc->deliver(message::Message(message));
+                }
+            }
+            else if (message.group_id() < group_rpcs_.size())
+                group_rpcs_.at(message.group_id())->deliver(std::move(message));
+        }
+    }
+
+    std::optional<time_t> MultiServer::next_timeout()
+    {
+        std::optional<time_t> timeout = std::make_optional(heartbeat_interval - heartbeat_clock_.get_time());
+
+        for (auto& server: servers_)
+        {
+            std::optional<time_t> server_timeout = server->next_timeout();
+
+            if (server_timeout)
+                timeout = std::make_optional(std::min(timeout.value(), server_timeout.value()));
+        }
+
+        return timeout;
+    }
+}
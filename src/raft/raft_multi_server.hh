@@ -0,0 +1,54 @@
+#pragma once
+
+#include <iostream> // std::cout
+#include <vector> // std::vector
+#include <memory> // std::unique_ptr
+#include <unistd.h> // sleep
+
+#include "raft_server.hh"
+#include "raft_clock.hh"
+#include "raft_config.hh"
+#include "raft_waiter.hh"
+#include "group_rpc.hh"
+#include "rpc.hh"
+#include "raft_types.hh"
+#include "types.hh"
+
+// Proto includes
+#include "proto/message.pb.h"
+#include "proto/command_entry.pb.h"
+
+namespace raft
+{
+    // Multi-Raft: a rank hosts one server per Raft group, the groups share the loop and the transport
+    // Every iteration, the messages of all the groups sent to the same rank travel in a single batch
+    class MultiServer
+    {
+        public:
+            MultiServer(node_id_t id, node_id_t controller_id, const std::vector<node_id_t> server_ids, const std::vector<node_id_t> node_ids, const Config& config);
+            void set_rpc(class rpc::RPC* rpc);
+            void run();
+            void step();
+            bool is_running() const { return servers_.front()->is_running(); }
+        private:
+            // Dispatch the received messages to their group, the controller commands to the group of their key
+            // and the other controller requests to every group
+            void receive_all_messages();
+            std::optional<time_t> next_timeout();
+
+            // Id of the servers
+            node_id_t id_;
+            // Id of the controller that rules them all
+            node_id_t controller_id_;
+            // RPC of each group, index = group id
+            std::vector<std::unique_ptr<rpc::GroupRPC>> group_rpcs_;
+            // Server of each group, index = group id
+            std::vector<std::unique_ptr<Server>> servers_;
+            // The leaders of the rank send their heartbeats on the same ticks
+            Clock heartbeat_clock_;
+            // Waits for the next message or timer between two iterations
+            Waiter waiter_;
+        protected:
+            rpc::RPC* rpc_ = nullptr;
+    };
+}
@@ -0,0 +1,106 @@
+#include "raft_progress.hh"
+
+namespace raft
+{
+    Progress::Progress():
+        state(ProgressState::PROBE),
+        next_index(0),
+        match_index(std::nullopt),
+        probe_sent(false),
+        snapshot_offset(0),
+        recent_active(false),
+        read_round(0),
+        lease_start(std::nullopt),
+        processing_latency(std::nullopt),
+        inflights_(),
+        inflight_bytes_(0)
+    {}
+
+    // Leader just elected: nothing is known about the follower
+    void Progress::reset(index_t next_index)
+    {
+        become_probe(next_index);
+        match_index = std::nullopt;
+        recent_active = false;
+        read_round = 0;
+        lease_start = std::nullopt;
+        processing_latency = std::nullopt;
+    }
+
+    void Progress::become_probe(index_t next_index)
+    {
+        state = ProgressState::PROBE;
+        this->next_index = next_index;
+        probe_sent = false;
+        inflights_.clear();
+        inflight_bytes_ = 0;
+    }
+
+    void Progress::become_replicate()
+    {
+        state = ProgressState::REPLICATE;
+        next_index = std::max(next_index, match_index ? match_index.value() + 1 : 0);
+        inflights_.clear();
+        inflight_bytes_ = 0;
+    }
+
+    void Progress::become_snapshot()
+    {
+        state = ProgressState::SNAPSHOT;
+        snapshot_offset = 0;
+        inflights_.clear();
+        inflight_bytes_ = 0;
+    }
+
+    bool Progress::is_paused(uint32 max_inflight, uint64 max_inflight_bytes) const
+    {
+        switch (state)
+        {
+            case ProgressState::PROBE:
+                return probe_sent;
+            case ProgressState::REPLICATE:
+                return inflights_.size() >= max_inflight || inflight_bytes_ >= max_inflight_bytes;
+            default:
+                return true;
+        }
+    }
+
+    uint64 Progress::available_bytes(uint64 max_inflight_bytes) const
+    {
+        return inflight_bytes_ >= max_inflight_bytes ? 0 : max_inflight_bytes - inflight_bytes_;
+    }
+
+    void Progress::on_sent(index_t end_index, uint64 bytes)
+    {
+        if (state == ProgressState::PROBE)
+            probe_sent = true;
+        else if (state == ProgressState::REPLICATE)
+        {
+            // Optimistically assume the entries will be accepted
+            next_index = end_index;
+            inflights_.push_back(Inflight { end_index, bytes });
+            inflight_bytes_ += bytes;
+        }
+    }
+
+    // Returns true if the match index moved forward
+    bool Progress::on_acknowledged(index_t log_size)
+    {
+        // Free the in-flight messages covered by the acknowledgement
+        while (!inflights_.empty() && inflights_.front().end_index <= log_size)
+        {
+            inflight_bytes_ -= inflights_.front().bytes;
+            inflights_.pop_front();
+        }
+
+        probe_sent = false;
+
+        if (log_size == 0 || (match_index && match_index.value() >= log_size - 1))
+            return false;
+
+        match_index = std::make_optional(log_size - 1);
+        next_index = std::max(next_index, log_size);
+
+        return true;
+    }
+}
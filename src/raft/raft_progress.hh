@@ -0,0 +1,68 @@
+#pragma once
+
+#include <deque> // std::deque
+#include <algorithm> // std::max
+#include <optional> // std::optional
+
+#include "raft_types.hh"
+#include "types.hh"
+
+namespace raft
+{
+    // PROBE: one AppendEntries at a time until the follower's log matches
+    // REPLICATE: entries are sent optimistically, up to the in-flight window
+    // SNAPSHOT: the follower is receiving the snapshot
+    enum class ProgressState { PROBE, REPLICATE, SNAPSHOT };
+
+    // Replication progress of a follower, tracked by the leader
+    class Progress
+    {
+        public:
+            Progress();
+
+            void reset(index_t next_index);
+            void become_probe(index_t next_index);
+            void become_replicate();
+            void become_snapshot();
+
+            // True when no more entries can be sent before an acknowledgement
+            bool is_paused(uint32 max_inflight, uint64 max_inflight_bytes) const;
+            // Remaining bytes in the in-flight window
+            uint64 available_bytes(uint64 max_inflight_bytes) const;
+            // Entries up to end_index (excluded) were sent
+            void on_sent(index_t end_index, uint64 bytes);
+            // The follower's log matches the leader's one up to log_size (excluded)
+            bool on_acknowledged(index_t log_size);
+
+            ProgressState state;
+            // Index of the next log entry to send
+            index_t next_index;
+            // Index of the highest log entry known to be replicated
+            std::optional<index_t> match_index;
+            // PROBE: true when a probe was sent since the last heartbeat or response
+            bool probe_sent;
+            // SNAPSHOT: offset of the next snapshot chunk to send
+            uint64 snapshot_offset;
+            // True when the follower responded since the last quorum check (CheckQuorum)
+            bool recent_active;
+            // Highest leadership confirmation round acknowledged by the follower
+            uint64 read_round;
+            // Start time of the latest round acknowledged by the follower (lease reads)
+            std::optional<time_t> lease_start;
+            // Average message processing latency (ms) reported by the follower (leadership balancer)
+            std::optional<time_t> processing_latency;
+        private:
+            struct Inflight
+            {
+                // Index following the last entry of the message
+                index_t end_index;
+                // Size of the entries of the message
+                uint64 bytes;
+            };
+
+            // AppendEntries sent and not acknowledged yet (REPLICATE only)
+            std::deque<Inflight> inflights_;
+            // Sum of the in-flight bytes
+            uint64 inflight_bytes_;
+    };
+}
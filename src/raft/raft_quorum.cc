@@ -0,0 +1,34 @@
+#include "raft_quorum.hh"
+
+namespace raft
+{
+    QuorumTracker::QuorumTracker(uint32 nb_servers):
+        match_sizes_(nb_servers, 0),
+        selection_(nb_servers, 0)
+    {}
+
+    void QuorumTracker::reset()
+    {
+        std::fill(match_sizes_.begin(), match_sizes_.end(), 0);
+    }
+
+    void QuorumTracker::update(index_t server_index, std::optional<index_t> match_index)
+    {
+        match_sizes_.at(server_index) = match_index ? match_index.value() + 1 : 0;
+    }
+
+    std::optional<index_t> QuorumTracker::quorum_match_index()
+    {
+        if (match_sizes_.empty())
+            return std::nullopt;
+
+        // The majority is the k-th largest match size
+        uint64 k = match_sizes_.size() / 2;
+
+        selection_ = match_sizes_;
+        std::nth_element(selection_.begin(), selection_.begin() + k, selection_.end(), std::greater<index_t>());
+
+        index_t quorum_size = selection_.at(k);
+        return quorum_size == 0 ? std::nullopt : std::make_optional(quorum_size - 1);
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <vector> // std::vector
+#include <optional> // std::optional
+#include <algorithm> // std::nth_element
+#include <functional> // std::greater
+
+#include "raft_types.hh"
+#include "types.hh"
+
+namespace raft
+{
+    // Match index of every server in a flat array, to find the highest log entry replicated on a majority
+    class QuorumTracker
+    {
+        public:
+            QuorumTracker(uint32 nb_servers);
+
+            // Forget every match index (new leader)
+            void reset();
+            void update(index_t server_index, std::optional<index_t> match_index);
+            // Highest index replicated on a majority of servers (the k-th largest match index), O(servers)
+            std::optional<index_t> quorum_match_index();
+        private:
+            // Match index + 1 of each server (0 = nothing replicated)
+            std::vector<index_t> match_sizes_;
+            // Reused buffer for the selection
+            std::vector<index_t> selection_;
+    };
+}
@@ -2,15 +2,25 @@
 
 namespace raft
 {
+    // Minimum election timeout (ms), also the duration of the leader lease
+    static const time_t min_election_timeout = 150;
+    // Interval (ms) between two decisions of the leadership balancer
+    static const time_t balance_interval = 1000;
+    // Processing latency (ms) a follower must save to take the leadership over
+    static const time_t balance_margin = 5;
+
     // MARK: - Public
 
     Server::Server(
         node_id_t id,
+        group_id_t group_id,
         node_id_t controller_id,
         const std::vector<node_id_t> server_ids,
-        const std::vector<node_id_t> node_ids
+        const std::vector<node_id_t> node_ids,
+        const Config& config
     ):
         id_(id),
+        group_id_(group_id),
         controller_id_(controller_id),
         server_ids_(server_ids),
         node_ids_(node_ids),
@@ -20,15 +30,60 @@ namespace raft
         heartbeat_timeout_(50),
         voted_for_(std::nullopt),
         votes_count_(0),
+        pre_vote_(config.pre_vote),
         log_entries_(),
-        storage_(id),
+        storage_(id, group_id, config.sync_window),
+        persisted_term_(0),
+        persisted_voted_for_(std::nullopt),
+        persisted_log_size_(0),
+        snapshot_(std::nullopt),
+        pending_snapshot_(),
+        snapshot_threshold_(config.snapshot_threshold),
+        snapshot_chunk_size_(config.snapshot_chunk_size),
         speed_(speed::Speed::NONE),
         delay_clock_(),
         running_(true),
+        waiter_(config.wait_mode),
+        message_budget_(config.message_budget),
+        processing_latency_(0),
+        message_wait_clock_(),
+        forward_commands_(config.forward_commands),
         commit_index_(std::nullopt),
         last_applied_commit_index_(std::nullopt),
-        next_index_(server_ids.size(), 0),
-        match_index_(server_ids.size(), std::nullopt)
+        leader_id_(std::nullopt),
+        progress_(server_ids.size()),
+        max_inflight_(config.max_inflight),
+        max_inflight_bytes_(config.max_inflight_bytes),
+        match_index_changed_(false),
+        quorum_(server_ids.size()),
+        check_quorum_(config.check_quorum),
+        check_quorum_clock_(),
+        transfer_target_(std::nullopt),
+        transfer_clock_(),
+        auto_balance_(config.auto_balance),
+        balance_clock_(),
+        preferred_leader_(config.groups > 1 ? std::make_optional(server_ids.at(group_id % server_ids.size())) : std::nullopt),
+        pending_commands_(),
+        pending_commands_bytes_(0),
+        command_batch_clock_(),
+        command_batch_window_(config.command_batch_window),
+        command_batch_size_(config.command_batch_size),
+        command_batch_bytes_(config.command_batch_bytes),
+        reads_to_confirm_(),
+        read_round_(0),
+        confirming_reads_(),
+        confirming_read_round_(0),
+        confirming_read_index_(0),
+        confirmed_reads_(),
+        lease_reads_(config.lease_reads),
+        lease_drift_(config.lease_drift),
+        read_round_times_(),
+        lease_clock_(),
+        sessions_(config.max_sessions),
+        applier_(config.state_machine, config.apply_thread),
+        querying_reads_(),
+        saving_snapshot_(std::nullopt),
+        saving_state_()
     {
         for (index_t i = 0; i < server_ids_.size(); ++i)
             server_indexes_dic_[server_ids_.at(i)] = i;
@@ -48,22 +103,14 @@ namespace raft
 
         while (running_)
         {
-            receive_controller_messages();
-            handle_controller_messages();
-
-            if (state_ != ServerState::DEAD)
-            {
-                receive_all_messages();
+            uint64 durable_sequence = storage_.durable_sequence();
 
-                if (delay_clock_.get_time() >= speed_to_delay())
-                {
-                    delay_clock_.reset();
-                    handle_messages();
-                }
+            step();
 
-                check_new_commit_to_apply();
-                handle_state();
-            }
+            // Sleep until the next message, timer, durable write or applied task
+            waiter_.wait(rpc_, next_timeout(), [this, durable_sequence]() {
+                return storage_.durable_sequence() != durable_sequence || applier_.has_completed_task();
+            });
         }
 
         #ifdef DEBUG
@@ -73,11 +120,66 @@ namespace raft
         sleep(1);
     }
 
+    void Server::step()
+    {
+        // The messages of this iteration are packed by destination
+        rpc_->begin_batch();
+
+        receive_all_messages();
+        handle_controller_messages();
+
+        if (state_ != ServerState::DEAD)
+        {
+            if (delay_clock_.get_time() >= speed_to_delay())
+            {
+                delay_clock_.reset();
+                handle_messages();
+            }
+
+            check_new_commit_to_apply();
+            handle_state();
+        }
+
+        // All the writes of this iteration share the same flush
+        persist_state();
+
+        if (should_take_snapshot())
+            take_snapshot();
+
+        // Also while crashed: the tasks in flight still complete
+        handle_applied_tasks();
+
+        uint64 sequence = storage_.flush();
+
+        for (const auto& message: unsynced_messages_)
+            durable_messages_.emplace(sequence, message);
+        unsynced_messages_.clear();
+
+        send_durable_messages();
+
+        rpc_->flush_batch();
+    }
+
+    void Server::coalesce_heartbeats()
+    {
+        if (state_ == ServerState::LEADER && clock_.get_time() >= heartbeat_timeout_ / 2)
+            leader_send_heartbeats();
+    }
+
     // MARK: - Private
 
     void Server::restore_state()
     {
         persistent_state::PersistentState state = storage_.get();
+        snapshot_ = storage_.get_snapshot();
+
+        // The log entries of the snapshot are committed and applied
+        if (snapshot_)
+        {
+            commit_index_ = std::make_optional(snapshot_.value().last_included_index());
+            last_applied_commit_index_ = commit_index_;
+            restore_applied_state(snapshot_.value());
+        }
 
         current_term_ = state.current_term();
         voted_for_ = state.has_voted_for() ? std::make_optional(state.voted_for().value()) : std::nullopt;
@@ -90,47 +192,188 @@ namespace raft
         }
         log_entries_ = log_entries;
 
+        persisted_term_ = current_term_;
+        persisted_voted_for_ = voted_for_;
+        persisted_log_size_ = log_size();
+
         #ifdef DEBUG
         std::cout << "Restore state from server " << id_ << '\n'
                   << "- Current term: " << current_term_ << '\n'
                   << "- Voted for: " << (voted_for_.has_value() ? (int) voted_for_.value() : -1) << '\n'
-                  << "- Number of logs: " << log_entries_.size() << std::endl;
+                  << "- Number of logs: " << log_entries_.size() << '\n'
+                  << "- Snapshot last included index: " << (snapshot_ ? (int) snapshot_.value().last_included_index() : -1) << std::endl;
         #endif
     }
 
     void Server::persist_state()
     {
-        persistent_state::PersistentState state;
-        state.set_current_term(current_term_);
-        if (voted_for_.has_value())
+        // The hard state only changes with a new term or a vote
+        if (current_term_ != persisted_term_ || voted_for_ != persisted_voted_for_)
         {
-            google::protobuf::UInt32Value* voted_for = google::protobuf::UInt32Value().New();
-            voted_for->set_value(voted_for_.value());
-            state.set_allocated_voted_for(voted_for);
+            persistent_state::PersistentState state;
+            state.set_current_term(current_term_);
+            if (voted_for_.has_value())
+                state.mutable_voted_for()->set_value(voted_for_.value());
+
+            storage_.save(state);
+
+            persisted_term_ = current_term_;
+            persisted_voted_for_ = voted_for_;
         }
 
-        // TODO: @sebmenozzi instead of saving the all log entries that is inefficient,
-        // we would create a log compaction mechanism (section 7)
-        for (auto entry = log_entries_.begin(); entry != log_entries_.end(); ++entry)
+        // Only append the log entries that are not in the write-ahead log yet
+        for (index_t i = persisted_log_size_; i < log_size(); ++i)
+            storage_.append(log_entry_at(i));
+
+        persisted_log_size_ = log_size();
+    }
+
+    // MARK: - Log compaction
+
+    index_t Server::log_offset()
+    {
+        return snapshot_ ? snapshot_.value().last_included_index() + 1 : 0;
+    }
+
+    index_t Server::log_size()
+    {
+        return log_offset() + log_entries_.size();
+    }
+
+    const log_entry::LogEntry& Server::log_entry_at(index_t index)
+    {
+        return log_entries_.at(index - log_offset());
+    }
+
+    // Term of the entry at index, unknown if the entry was compacted before the last snapshot entry
+    std::optional<term_t> Server::log_term_at(index_t index)
+    {
+        if (snapshot_ && index == snapshot_.value().last_included_index())
+            return std::make_optional(snapshot_.value().last_included_term());
+
+        if (index < log_offset() || index >= log_size())
+            return std::nullopt;
+
+        return std::make_optional(log_entry_at(index).term());
+    }
+
+    bool Server::should_take_snapshot()
+    {
+        if (snapshot_threshold_ == 0 || !last_applied_commit_index_ || saving_snapshot_)
+            return false;
+
+        return last_applied_commit_index_.value() + 1 >= log_offset() + snapshot_threshold_;
+    }
+
+    // Compact the log up to the last applied entry (section 7)
+    // The state machine saves its state once it applied this entry, the log is compacted then
+    void Server::take_snapshot()
+    {
+        index_t index = last_applied_commit_index_.value();
+
+        snapshot::Snapshot snapshot;
+        snapshot.set_last_included_index(index);
+        snapshot.set_last_included_term(log_term_at(index).value());
+        saving_snapshot_ = std::make_optional(snapshot);
+
+        saving_state_.Clear();
+        sessions_.save(saving_state_);
+
+        ApplyTask task;
+        task.type = ApplyTaskType::SAVE;
+        task.index = index;
+        applier_.submit(std::move(task));
+    }
+
+    void Server::finish_snapshot(const std::string& state_machine)
+    {
+        snapshot::Snapshot snapshot = saving_snapshot_.value();
+        index_t index = snapshot.last_included_index();
+        saving_snapshot_ = std::nullopt;
+
+        // A snapshot of the leader was installed meanwhile
+        if (snapshot_ && snapshot_.value().last_included_index() >= index)
+            return;
+
+        saving_state_.set_state_machine(state_machine);
+        snapshot.set_data(saving_state_.SerializeAsString());
+
+        log_entries_.erase(log_entries_.begin(), log_entries_.begin() + (index + 1 - log_offset()));
+        snapshot_ = std::make_optional(snapshot);
+
+        storage_.save_snapshot(snapshot);
+        storage_.compact(index + 1);
+
+        #ifdef DEBUG
+        std::cout << "Server " << id_ << " took a snapshot up to index " << index << std::endl;
+        #endif
+    }
+
+    // Replace the log by the snapshot received from the leader
+    void Server::install_snapshot(const snapshot::Snapshot& snapshot)
+    {
+        index_t index = snapshot.last_included_index();
+
+        // Already covered by our own snapshot
+        if (snapshot_ && snapshot_.value().last_included_index() >= index)
+            return;
+
+        std::optional<term_t> term = log_term_at(index);
+
+        // Keep the log entries following the snapshot if our log contains its last entry
+        if (term && term.value() == snapshot.last_included_term())
+        {
+            log_entries_.erase(log_entries_.begin(), log_entries_.begin() + (index + 1 - log_offset()));
+            snapshot_ = std::make_optional(snapshot);
+
+            storage_.save_snapshot(snapshot);
+            storage_.compact(index + 1);
+        }
+        else
+        {
+            log_entries_.clear();
+            snapshot_ = std::make_optional(snapshot);
+
+            storage_.save_snapshot(snapshot);
+            storage_.reset(index + 1);
+            persisted_log_size_ = index + 1;
+        }
+
+        if (!commit_index_ || commit_index_.value() < index)
+            commit_index_ = std::make_optional(index);
+        if (!last_applied_commit_index_ || last_applied_commit_index_.value() < index)
         {
-            log_entry::LogEntry* new_entry = state.add_log_entries();
-            new_entry->set_client_id(entry->client_id());
-            new_entry->set_leader_id(entry->leader_id());
-            new_entry->set_index(entry->index());
-            new_entry->set_command(entry->command());
-            new_entry->set_term(entry->term());
+            last_applied_commit_index_ = std::make_optional(index);
+            restore_applied_state(snapshot);
         }
 
-        storage_.save(state);
+        #ifdef DEBUG
+        std::cout << "Server " << id_ << " installed a snapshot up to index " << index << std::endl;
+        #endif
+    }
+
+    void Server::restore_applied_state(const snapshot::Snapshot& snapshot)
+    {
+        snapshot::AppliedState state;
+        state.ParseFromString(snapshot.data());
+
+        sessions_.restore(state);
+
+        ApplyTask task;
+        task.type = ApplyTaskType::RESTORE;
+        task.index = snapshot.last_included_index();
+        task.inputs.push_back(state.state_machine());
+        applier_.submit(std::move(task));
     }
 
     void Server::set_election_timeout()
     {
-        uint16 min = 150;
+        uint16 min = min_election_timeout;
         uint16 max = 300;
 
         // Define a unique seed for each process
-        std::srand(std::time(nullptr) + getpid() + id_);
+        // (and each group, the groups of a rank would elect their leaders at the same time otherwise)
+        std::srand(std::time(nullptr) + getpid() + id_ + group_id_ * 7919);
         // Random delay between 150ms and 300ms
         election_timeout_ = std::rand() % (max - min + 1) + min;
     }
@@ -150,6 +393,29 @@ namespace raft
         }
     }
 
+    // Time (ms) until the next timer of the server loop, none if only a message can wake it up
+    std::optional<time_t> Server::next_timeout()
+    {
+        if (!running_ || !messages_controller_.empty())
+            return std::make_optional(0);
+
+        if (state_ == ServerState::DEAD)
+            return std::nullopt;
+
+        // The heartbeat timer for leaders, the election timer otherwise (strict comparison)
+        time_t timeout = state_ == ServerState::LEADER
+            ? heartbeat_timeout_ - clock_.get_time()
+            : election_timeout_ + 1 - clock_.get_time();
+
+        if (state_ == ServerState::LEADER && !pending_commands_.empty())
+            timeout = std::min(timeout, command_batch_window_ - command_batch_clock_.get_time());
+
+        if (!messages_.empty())
+            timeout = std::min(timeout, speed_to_delay() - delay_clock_.get_time());
+
+        return std::make_optional(timeout);
+    }
+
     // Run Server loop
     void Server::start()
     {
@@ -170,12 +436,26 @@ namespace raft
         while(!messages_.empty())
             messages_.pop();
 
-        // Clear log entries to commit queue
-        while (!log_entries_to_commit_.empty())
-            log_entries_to_commit_.pop();
+        // The clients will retry after a timeout
+        pending_completions_.clear();
+
+        reads_to_confirm_.clear();
+        confirming_reads_.clear();
+        while (!confirmed_reads_.empty())
+            confirmed_reads_.pop();
+
+        pending_commands_.clear();
+        pending_commands_bytes_ = 0;
+
+        // Clear the messages waiting for the disk
+        unsynced_messages_.clear();
+        while (!durable_messages_.empty())
+            durable_messages_.pop();
 
         // Reset server
         state_ = ServerState::DEAD;
+        leader_id_ = std::nullopt;
+        transfer_target_ = std::nullopt;
     }
 
     // Handle state of the server
@@ -186,6 +466,7 @@ namespace raft
             case ServerState::FOLLOWER:
                 handle_follower();
                 break;
+            case ServerState::PRE_CANDIDATE:
             case ServerState::CANDIDATE:
                 handle_candidate();
                 break;
@@ -201,7 +482,7 @@ namespace raft
     void Server::handle_follower()
     {
         if (clock_.get_time() > election_timeout_)
-            become_candidate();
+            start_election();
     }
 
     // If the Server is a candidate
@@ -209,212 +490,831 @@ namespace raft
     {
         // If the server didn't receive the majority of vote to become a leader after the election delay, restart the election
         if (clock_.get_time() > election_timeout_)
-            become_candidate();
+            start_election();
     }
 
-    // Leader: Send a Append Entries request to followers
-    void Server::leader_send_heartbeats()
+    // Leader: Step down when a majority did not respond during an election timeout (CheckQuorum, section 6.2)
+    void Server::leader_check_quorum()
     {
-        message::Message message;
-        message.set_source_id(id_);
-        message.set_type(message::MessageType::APPEND_ENTRIES_REQUEST);
-        message.set_term(current_term_);
+        if (check_quorum_clock_.get_time() < election_timeout_)
+            return;
 
+        check_quorum_clock_.reset();
+
+        uint32 nb_active = 0;
         for (const auto& id: server_ids_)
         {
-            if (id != id_) // Exclude self
-            {
-                append_entry::AppendEntriesRequest request;
-
-                index_t idx = server_indexes_dic_[id];
-                index_t next_index = next_index_.at(idx);
-
-                // Only send logs from the next index
-                if (next_index < log_entries_.size())
-                {
-                    for (auto entry = log_entries_.begin() + next_index; entry != log_entries_.end(); ++entry)
-                    {
-                        log_entry::LogEntry* new_entry = request.add_log_entries();
-                        new_entry->set_client_id(entry->client_id());
-                        new_entry->set_leader_id(entry->leader_id());
-                        new_entry->set_index(entry->index());
-                        new_entry->set_command(entry->command());
-                        new_entry->set_term(entry->term());
-                    }
-                }
-
-                request.set_term(current_term_);
-                request.set_leader_id(id_);
+            Progress& progress = progress_.at(server_indexes_dic_[id]);
 
-                // If a previous log exist, then add metadata in proto
-                std::optional<index_t> prev_log_index = next_index == 0 ? std::nullopt : std::make_optional(next_index - 1);
-
-                if (prev_log_index && prev_log_index.value() >= 0 && prev_log_index.value() < log_entries_.size())
-                {
-                    index_t index = prev_log_index.value();
+            if (id == id_ || progress.recent_active)
+                ++nb_active;
 
-                    append_entry::PrevLogMetadata* prev_log_metadata = append_entry::PrevLogMetadata().New();
-                    prev_log_metadata->set_prev_log_index(index);
-                    prev_log_metadata->set_prev_log_term(log_entries_.at(index).term());
-                    request.set_allocated_prev_log_metadata(prev_log_metadata);
-                }
+            progress.recent_active = false;
+        }
 
-                if (commit_index_)
-                {
-                    google::protobuf::UInt32Value* leader_commit_index = google::protobuf::UInt32Value().New();
-                    leader_commit_index->set_value(commit_index_.value());
-                    request.set_allocated_leader_commit_index(leader_commit_index);
-                }
+        if (nb_active <= server_ids_.size() / 2)
+        {
+            #ifdef DEBUG
+            std::cout << "Server " << id_ << " lost contact with the majority" << std::endl;
+            #endif
 
-                message.set_source_id(id_);
-                message.set_dest_id(id);
-                message.mutable_payload()->PackFrom(request);
-                rpc_->send_message(message);
-            }
+            become_follower(current_term_);
         }
-
-        clock_.reset();
     }
 
-    void Server::handle_leader()
+    // Leader: Hand the leadership over to another server (section 3.10)
+    // The target is caught up first, then told to start an election right away with TimeoutNow
+    void Server::leader_transfer_leadership(node_id_t target_id)
     {
-        // Send a Append Entry request every heartbeat timeout to prevent election timeouts to followers
-        if (clock_.get_time() >= heartbeat_timeout_)
-            leader_send_heartbeats();
-    }
+        if (target_id == id_ || server_indexes_dic_.count(target_id) == 0 || transfer_target_)
+            return;
 
-    // Change server state to follower
-    void Server::become_follower(term_t term)
-    {
         #ifdef DEBUG
-        std::cout << "Server " << id_ << " becomes follower" << std::endl;
+        std::cout << "Server " << id_ << " transfers the leadership to " << target_id << std::endl;
         #endif
 
-        state_ = ServerState::FOLLOWER;
-        current_term_ = term;
-        votes_count_ = 0;
-        voted_for_ = std::nullopt;
+        // The commands received during the transfer stay pending until it ends
+        leader_append_pending_commands();
 
-        clock_.reset();
+        transfer_target_ = std::make_optional(target_id);
+        transfer_clock_.reset();
+
+        leader_check_transfer();
     }
 
-    // Change server state to candidate
-    void Server::become_candidate()
+    // Leader: Send TimeoutNow once the target's log matches ours, or what it is still missing
+    void Server::leader_check_transfer()
     {
-        #ifdef DEBUG
-        std::cout << "Server " << id_ << " becomes candidate" << std::endl;
-        #endif
+        node_id_t target_id = transfer_target_.value();
+        const Progress& progress = progress_.at(server_indexes_dic_[target_id]);
 
-        state_ = ServerState::CANDIDATE;
-        voted_for_ = std::make_optional(id_); // Vote for self
-        votes_count_ = 1; // Increment vote count
-        current_term_ += 1; // Increment current term
+        if (log_size() == 0 || progress.match_index == std::make_optional(log_size() - 1))
+        {
+            message::Message message;
+            message.set_source_id(id_);
+            message.set_dest_id(target_id);
+            message.set_type(message::MessageType::TIMEOUT_NOW);
+            message.set_term(current_term_);
+            rpc_->send_message(message);
+        }
+        else
+            leader_send_append_entries(target_id, false);
+    }
 
-        #ifdef DEBUG
-        std::cout << "Current Term: " << current_term_ << std::endl;
-        #endif
+    // Leader: Move the leadership to a follower that handles the messages faster (auto-balancer)
+    void Server::leader_balance_leadership()
+    {
+        if (balance_clock_.get_time() < balance_interval)
+            return;
 
-        // Reset election timer
-        clock_.reset();
-        // For the next term, reset the timeout
-        set_election_timeout();
+        balance_clock_.reset();
 
-        // Send vote request to all other servers
-        vote::VoteRequest request;
-        request.set_candidate_id(id_);
+        std::optional<node_id_t> target_id = std::nullopt;
+        time_t target_latency = std::lround(processing_latency_) - balance_margin;
 
-        message::Message message;
-        message.set_source_id(id_);
-        message.set_type(message::MessageType::VOTE_REQUEST);
-        message.mutable_payload()->PackFrom(request);
-        message.set_term(current_term_);
+        // Multi-Raft: the group goes back to its preferred leader, if it answered since the last decision
+        if (preferred_leader_)
+        {
+            node_id_t id = preferred_leader_.value();
 
-        // Ask every servers to vote for us
-        for (const auto& id: server_ids_)
+            if (id != id_ && progress_.at(server_indexes_dic_[id]).processing_latency)
+                target_id = preferred_leader_;
+        }
+        else
         {
-            if (id != id_) // Exclude self
+            for (const auto& id: server_ids_)
             {
-                message.set_dest_id(id);
-                rpc_->send_message(message);
+                const Progress& progress = progress_.at(server_indexes_dic_[id]);
+
+                if (id != id_ && progress.processing_latency && progress.processing_latency.value() < target_latency)
+                {
+                    target_id = std::make_optional(id);
+                    target_latency = progress.processing_latency.value();
+                }
             }
+
+            #ifdef DEBUG
+            if (target_id)
+                std::cout << "Server " << id_ << " has a latency of " << std::lround(processing_latency_) << " ms, server " << target_id.value() << " of " << target_latency << " ms" << std::endl;
+            #endif
         }
+
+        // The next decision only trusts the latencies reported meanwhile (a crashed server stops reporting)
+        for (auto& progress: progress_)
+            progress.processing_latency = std::nullopt;
+
+        if (target_id)
+            leader_transfer_leadership(target_id.value());
     }
 
-    // Change server state to leader
-    void Server::become_leader()
+    // Leader: Send a Append Entries request to followers
+    void Server::leader_send_heartbeats()
     {
-        #ifdef DEBUG
-        std::cout << "Server " << id_ << " becomes leader" << std::endl;
-        #endif
-
-        state_ = ServerState::LEADER;
+        // Every heartbeat renews the leadership confirmation
+        leader_start_read_round();
 
         for (const auto& id: server_ids_)
         {
-            // Retrieve index for the server
-            index_t server_index = server_indexes_dic_[id];
-
-            next_index_.at(server_index) = log_entries_.size();
-            match_index_.at(server_index) = std::nullopt;
+            if (id != id_) // Exclude self
+                leader_send_append_entries(id, true);
         }
 
-        // Send initial AppendEntries request to each follower
-        leader_send_heartbeats();
+        clock_.reset();
     }
 
-    void Server::handle_messages()
+    // Leader: Send the new log entries to followers (without waiting for the next heartbeat)
+    void Server::leader_replicate()
     {
-        if (!messages_.empty())
+        for (const auto& id: server_ids_)
         {
-            message::Message message = messages_.front();
-            handle_message(message);
-            messages_.pop();
+            if (id != id_) // Exclude self
+                leader_send_append_entries(id, false);
         }
     }
 
-    // Server receives a vote request
-    void Server::handle_vote_request(const message::Message& message)
+    // Leader: Send the log entries a follower is missing, within its in-flight window
+    void Server::leader_send_append_entries(node_id_t id, bool is_heartbeat)
     {
-        // Outdated term
-        if (message.term() > current_term_)
-            become_follower(message.term());
+        Progress& progress = progress_.at(server_indexes_dic_[id]);
 
-        vote::VoteRequest request;
-        message.payload().UnpackTo(&request);
-
-        // Send Vote Response
-        vote::VoteResponse response;
-
-        // If votedFor is null or candidatedId, and candidate's log is at least as up-to-date as receiver's log, grant vote
-        if (
-            message.term() == current_term_ &&
-            (voted_for_ == std::nullopt || voted_for_.value() == request.candidate_id())
-        )
+        // The next log entries were compacted: the follower needs the snapshot
+        if (progress.state != ProgressState::SNAPSHOT && progress.next_index < log_offset())
         {
-            response.set_vote_granted(true);
-            voted_for_ = std::make_optional(request.candidate_id());
+            progress.become_snapshot();
+            leader_send_snapshot(id);
+            return;
+        }
 
-            clock_.reset();
+        if (progress.state == ProgressState::SNAPSHOT)
+        {
+            // The next chunk is sent on acknowledgement, resend the current one in case it was lost
+            if (is_heartbeat)
+                leader_send_snapshot(id);
+            return;
         }
-        else // Reply false if term < currentTerm
-            response.set_vote_granted(false);
 
-        message::Message response_message;
-        response_message.set_source_id(id_);
-        response_message.set_dest_id(request.candidate_id());
-        response_message.set_type(message::MessageType::VOTE_RESPONSE);
-        response_message.mutable_payload()->PackFrom(response);
-        response_message.set_term(current_term_);
+        // Resend the probe in case it was lost
+        if (progress.state == ProgressState::PROBE && is_heartbeat)
+            progress.probe_sent = false;
 
-        rpc_->send_message(response_message);
+        bool is_sent = false;
 
-        persist_state();
+        while (!progress.is_paused(max_inflight_, max_inflight_bytes_))
+        {
+            // Only the entries that were not sent yet
+            if (progress.state == ProgressState::REPLICATE && progress.next_index >= log_size())
+                break;
+
+            auto [end_index, bytes] = send_append_entries_request(id, progress.next_index, progress.available_bytes(max_inflight_bytes_));
+            progress.on_sent(end_index, bytes);
+            is_sent = true;
+        }
+
+        // Empty heartbeat to prevent election timeouts and to share the commit index
+        if (is_heartbeat && !is_sent)
+            send_append_entries_request(id, progress.next_index, 0);
+    }
+
+    // Send the log entries from next_index (at least one if max_bytes is not 0)
+    // Returns the index following the last sent entry and the size of the sent entries
+    std::pair<index_t, uint64> Server::send_append_entries_request(node_id_t id, index_t next_index, uint64 max_bytes)
+    {
+        append_entry::AppendEntriesRequest request;
+
+        index_t end_index = next_index;
+        uint64 bytes = 0;
+
+        // Only send logs from the next index
+        while (end_index < log_size() && max_bytes > 0)
+        {
+            const log_entry::LogEntry& entry = log_entry_at(end_index);
+            uint64 size = entry.ByteSizeLong();
+
+            if (end_index != next_index && bytes + size > max_bytes)
+                break;
+
+            *request.add_log_entries() = entry;
+            bytes += size;
+            ++end_index;
+        }
+
+        request.set_term(current_term_);
+        request.set_leader_id(id_);
+        request.set_read_round(read_round_);
+
+        // If a previous log exist, then add metadata in proto
+        std::optional<index_t> prev_log_index = next_index == 0 ? std::nullopt : std::make_optional(next_index - 1);
+
+        if (prev_log_index && prev_log_index.value() < log_size())
+        {
+            index_t index = prev_log_index.value();
+
+            append_entry::PrevLogMetadata* prev_log_metadata = append_entry::PrevLogMetadata().New();
+            prev_log_metadata->set_prev_log_index(index);
+            prev_log_metadata->set_prev_log_term(log_term_at(index).value());
+            request.set_allocated_prev_log_metadata(prev_log_metadata);
+        }
+
+        if (commit_index_)
+        {
+            google::protobuf::UInt32Value* leader_commit_index = google::protobuf::UInt32Value().New();
+            leader_commit_index->set_value(commit_index_.value());
+            request.set_allocated_leader_commit_index(leader_commit_index);
+        }
+
+        message::Message message;
+        message.set_source_id(id_);
+        message.set_dest_id(id);
+        message.set_type(message::MessageType::APPEND_ENTRIES_REQUEST);
+        message.set_term(current_term_);
+        message.mutable_payload()->PackFrom(request);
+        rpc_->send_message(message);
+
+        return std::make_pair(end_index, bytes);
+    }
+
+    // Leader: Next index to probe after a rejection, using the follower's conflict hints
+    index_t Server::leader_next_index_after_conflict(const append_entry::AppendEntriesResponse& response)
+    {
+        if (!response.has_conflict_term())
+            return response.conflict_index();
+
+        term_t conflict_term = response.conflict_term().value();
+
+        // Terms only grow along the log: look for the last entry of the conflict term from the rejected index
+        index_t index = std::min((index_t) response.prev_log_size(), log_size());
+        while (index > log_offset())
+        {
+            term_t term = log_term_at(index - 1).value();
+
+            // The leader has the conflict term: the logs match up to its last entry
+            if (term == conflict_term)
+                return index;
+            if (term < conflict_term)
+                break;
+
+            --index;
+        }
+
+        // The leader does not have the conflict term: skip it entirely
+        return response.conflict_index();
+    }
+
+    // Leader: Send the next snapshot chunk to a follower
+    void Server::leader_send_snapshot(node_id_t id)
+    {
+        Progress& progress = progress_.at(server_indexes_dic_[id]);
+
+        const snapshot::Snapshot& snapshot = snapshot_.value();
+        uint64 offset = std::min(progress.snapshot_offset, (uint64) snapshot.data().size());
+        uint64 size = std::min(snapshot_chunk_size_, (uint64) snapshot.data().size() - offset);
+
+        install_snapshot::InstallSnapshotRequest request;
+        request.set_leader_id(id_);
+        request.set_last_included_index(snapshot.last_included_index());
+        request.set_last_included_term(snapshot.last_included_term());
+        request.set_offset(offset);
+        request.set_data(snapshot.data().substr(offset, size));
+        request.set_done(offset + size == snapshot.data().size());
+
+        message::Message message;
+        message.set_source_id(id_);
+        message.set_dest_id(id);
+        message.set_type(message::MessageType::INSTALL_SNAPSHOT_REQUEST);
+        message.set_term(current_term_);
+        message.mutable_payload()->PackFrom(request);
+        rpc_->send_message(message);
+    }
+
+    void Server::handle_leader()
+    {
+        if (check_quorum_)
+        {
+            leader_check_quorum();
+
+            if (state_ != ServerState::LEADER)
+                return;
+        }
+
+        // The target did not take the leadership over in time: keep it
+        if (transfer_target_ && transfer_clock_.get_time() >= election_timeout_)
+        {
+            #ifdef DEBUG
+            std::cout << "Server " << id_ << " aborts the leadership transfer to " << transfer_target_.value() << std::endl;
+            #endif
+
+            transfer_target_ = std::nullopt;
+
+            // A new lease is needed: the target may have been elected
+            for (auto& progress: progress_)
+                progress.lease_start = std::nullopt;
+        }
+
+        if ((auto_balance_ || preferred_leader_) && !transfer_target_)
+            leader_balance_leadership();
+
+        // End of the batching window
+        if (!pending_commands_.empty() && command_batch_clock_.get_time() >= command_batch_window_)
+            leader_append_pending_commands();
+
+        // The leader only counts its own log entries once they are durable
+        index_t durable_log_size = std::min(log_size(), storage_.durable_log_size());
+        std::optional<index_t> match_index = durable_log_size == 0 ? std::nullopt : std::make_optional(durable_log_size - 1);
+
+        Progress& progress = progress_.at(server_indexes_dic_[id_]);
+        if (progress.match_index != match_index)
+        {
+            progress.match_index = match_index;
+            quorum_.update(server_indexes_dic_[id_], match_index);
+            leader_update_commit_index();
+        }
+
+        leader_confirm_reads();
+
+        // Send a Append Entry request every heartbeat timeout to prevent election timeouts to followers
+        if (clock_.get_time() >= heartbeat_timeout_)
+            leader_send_heartbeats();
+    }
+
+    // Commit the log entries of the current term replicated on the majority of servers
+    void Server::leader_update_commit_index()
+    {
+        // Used to log if new log entries have to be committed
+        std::optional<index_t> last_commit_index = commit_index_;
+
+        std::optional<index_t> quorum_match_index = quorum_.quorum_match_index();
+
+        // Only the log entries of the current term are committed by counting replicas (§5.4.2),
+        // the previous ones are committed with them
+        if (
+            quorum_match_index &&
+            (!commit_index_ || quorum_match_index.value() > commit_index_.value()) &&
+            log_term_at(quorum_match_index.value()) == std::make_optional(current_term_)
+        )
+            commit_index_ = quorum_match_index;
+
+        if (
+            (!last_commit_index && commit_index_) ||
+            (commit_index_ && commit_index_.value() != last_commit_index.value())
+        )
+        {
+            #ifdef DEBUG
+            std::cout << "Leader commit index changed to " << commit_index_.value() << std::endl;
+            #endif
+        }
+    }
+
+    // Leader: Serve the reads without writing to the log (ReadIndex, section 6.4)
+    // All the reads received before a confirmation round share it, a single round is in flight at once
+    void Server::leader_confirm_reads()
+    {
+        // The round in flight was acknowledged by a quorum: the leader was still the leader when it started
+        if (!confirming_reads_.empty())
+        {
+            uint32 nb_acknowledged = 0;
+            for (const auto& id: server_ids_)
+            {
+                if (id == id_ || progress_.at(server_indexes_dic_[id]).read_round >= confirming_read_round_)
+                    ++nb_acknowledged;
+            }
+
+            if (nb_acknowledged <= server_ids_.size() / 2)
+                return;
+
+            for (const auto& read: confirming_reads_)
+                confirmed_reads_.emplace(confirming_read_index_, read);
+
+            confirming_reads_.clear();
+
+            leader_answer_reads();
+        }
+
+        if (reads_to_confirm_.empty())
+            return;
+
+        // The commit index is only up to date once an entry of the current term is committed
+        if (!leader_committed_in_term())
+        {
+            if (log_size() == 0 || log_term_at(log_size() - 1).value() != current_term_)
+                leader_append_no_op();
+            return;
+        }
+
+        // Start the next round with a heartbeat to every follower
+        leader_send_heartbeats();
+
+        confirming_read_round_ = read_round_;
+        confirming_read_index_ = commit_index_.value();
+        std::swap(confirming_reads_, reads_to_confirm_);
+    }
+
+    // Leader: New leadership confirmation round, sent with the next AppendEntries requests
+    void Server::leader_start_read_round()
+    {
+        ++read_round_;
+
+        if (!lease_reads_)
+            return;
+
+        time_t now = lease_clock_.get_time();
+
+        // The rounds older than the lease cannot extend it anymore
+        while (!read_round_times_.empty() && read_round_times_.front().second + min_election_timeout <= now)
+            read_round_times_.pop_front();
+
+        read_round_times_.emplace_back(read_round_, now);
+    }
+
+    // Leader: Start time of a recent round
+    std::optional<time_t> Server::read_round_time(uint64 round)
+    {
+        for (auto it = read_round_times_.rbegin(); it != read_round_times_.rend(); ++it)
+        {
+            if (it->first == round)
+                return std::make_optional(it->second);
+            if (it->first < round)
+                break;
+        }
+
+        return std::nullopt;
+    }
+
+    bool Server::leader_committed_in_term()
+    {
+        return commit_index_ && log_term_at(commit_index_.value()) == std::make_optional(current_term_);
+    }
+
+    // Leader: True while a majority acknowledged a round started less than the lease ago (minus the drift margin)
+    // The followers ignore the vote requests during the same time after hearing from the leader (section 6.4.1)
+    bool Server::leader_has_lease()
+    {
+        // The target of a transfer may be elected before the lease expires
+        if (transfer_target_)
+            return false;
+
+        // The leader is part of the majority
+        uint32 nb_needed = server_ids_.size() / 2;
+
+        if (nb_needed == 0)
+            return true;
+
+        std::vector<time_t> lease_starts;
+        for (const auto& id: server_ids_)
+        {
+            const Progress& progress = progress_.at(server_indexes_dic_[id]);
+
+            if (id != id_ && progress.lease_start)
+                lease_starts.push_back(progress.lease_start.value());
+        }
+
+        if (lease_starts.size() < nb_needed)
+            return false;
+
+        std::nth_element(lease_starts.begin(), lease_starts.begin() + nb_needed - 1, lease_starts.end(), std::greater<time_t>());
+
+        return lease_clock_.get_time() < lease_starts.at(nb_needed - 1) + min_election_timeout - lease_drift_;
+    }
+
+    // Leader: Query the state machine for the confirmed reads once their read index is handed to it
+    void Server::leader_answer_reads()
+    {
+        ApplyTask task;
+        task.type = ApplyTaskType::QUERY;
+
+        while (
+            !confirmed_reads_.empty() &&
+            last_applied_commit_index_ &&
+            confirmed_reads_.front().first <= last_applied_commit_index_.value()
+        )
+        {
+            task.inputs.push_back(confirmed_reads_.front().second.query);
+            querying_reads_.push_back(std::move(confirmed_reads_.front().second));
+            confirmed_reads_.pop();
+        }
+
+        if (!task.inputs.empty())
+        {
+            task.index = last_applied_commit_index_.value();
+            applier_.submit(std::move(task));
+        }
+    }
+
+    // Answer the reads with the results of their queries (a crashed server drops them)
+    void Server::answer_queried_reads(const ApplyTask& task)
+    {
+        for (const auto& value: task.results)
+        {
+            const PendingRead& read = querying_reads_.front();
+
+            if (state_ != ServerState::DEAD)
+            {
+                read_index::ReadResponse response;
+                response.set_success(true);
+                response.set_sequence(read.sequence);
+                response.set_read_index(task.index);
+                response.set_value(value);
+                send_read_response(read.client_id, read.proxy_id, response);
+            }
+
+            querying_reads_.pop_front();
+        }
+    }
+
+    // Change server state to follower
+    void Server::become_follower(term_t term, std::optional<node_id_t> leader_id)
+    {
+        #ifdef DEBUG
+        std::cout << "Server " << id_ << " becomes follower" << std::endl;
+        #endif
+
+        // The commands of this leader may never be committed
+        if (state_ == ServerState::LEADER)
+        {
+            fail_pending_completions(leader_id);
+            fail_pending_reads(leader_id);
+        }
+
+        // The leader is unknown until it contacts us in a new term
+        if (term != current_term_ || leader_id || state_ == ServerState::LEADER)
+            leader_id_ = leader_id;
+
+        // A single vote per term: the vote is kept when stepping down in the same term
+        if (term != current_term_)
+            voted_for_ = std::nullopt;
+
+        state_ = ServerState::FOLLOWER;
+        current_term_ = term;
+        votes_count_ = 0;
+
+        // The commands not appended yet are lost, the clients will retry
+        pending_commands_.clear();
+        pending_commands_bytes_ = 0;
+
+        transfer_target_ = std::nullopt;
+
+        clock_.reset();
+    }
+
+    void Server::start_election()
+    {
+        if (pre_vote_)
+            become_pre_candidate();
+        else
+            become_candidate();
+    }
+
+    // Ask the servers if they would vote for us in the next term, without increasing the term (Pre-Vote, section 9.6)
+    // A server that was partitioned or slowed down cannot depose a healthy leader this way
+    void Server::become_pre_candidate()
+    {
+        #ifdef DEBUG
+        std::cout << "Server " << id_ << " starts a pre-vote" << std::endl;
+        #endif
+
+        state_ = ServerState::PRE_CANDIDATE;
+        leader_id_ = std::nullopt;
+        votes_count_ = 1; // Pre-vote for self
+
+        // Reset election timer
+        clock_.reset();
+        set_election_timeout();
+
+        vote::VoteRequest request;
+        fill_vote_request(request);
+
+        message::Message message;
+        message.set_source_id(id_);
+        message.set_type(message::MessageType::PRE_VOTE_REQUEST);
+        message.mutable_payload()->PackFrom(request);
+        message.set_term(current_term_ + 1);
+
+        // Nothing was written: no need to wait for the disk
+        for (const auto& id: server_ids_)
+        {
+            if (id != id_) // Exclude self
+            {
+                message.set_dest_id(id);
+                rpc_->send_message(message);
+            }
+        }
+    }
+
+    void Server::fill_vote_request(vote::VoteRequest& request)
+    {
+        request.set_candidate_id(id_);
+        request.set_last_log_size(log_size());
+        request.set_last_log_term(log_size() == 0 ? 0 : log_term_at(log_size() - 1).value());
+    }
+
+    // True if the candidate's log is at least as up-to-date as ours (section 5.4.1)
+    bool Server::is_log_up_to_date(const vote::VoteRequest& request)
+    {
+        term_t last_log_term = log_size() == 0 ? 0 : log_term_at(log_size() - 1).value();
+
+        return (
+            request.last_log_term() > last_log_term ||
+            (request.last_log_term() == last_log_term && request.last_log_size() >= log_size())
+        );
+    }
+
+    // Change server state to candidate
+    // is_transfer: the election follows a TimeoutNow from the leader
+    void Server::become_candidate(bool is_transfer)
+    {
+        #ifdef DEBUG
+        std::cout << "Server " << id_ << " becomes candidate" << std::endl;
+        #endif
+
+        state_ = ServerState::CANDIDATE;
+        leader_id_ = std::nullopt;
+        voted_for_ = std::make_optional(id_); // Vote for self
+        votes_count_ = 1; // Increment vote count
+        current_term_ += 1; // Increment current term
+
+        #ifdef DEBUG
+        std::cout << "Current Term: " << current_term_ << std::endl;
+        #endif
+
+        // Reset election timer
+        clock_.reset();
+        // For the next term, reset the timeout
+        set_election_timeout();
+
+        // Send vote request to all other servers
+        vote::VoteRequest request;
+        fill_vote_request(request);
+        request.set_leadership_transfer(is_transfer);
+
+        message::Message message;
+        message.set_source_id(id_);
+        message.set_type(message::MessageType::VOTE_REQUEST);
+        message.mutable_payload()->PackFrom(request);
+        message.set_term(current_term_);
+
+        // Ask every servers to vote for us (once the new term and our vote are durable)
+        for (const auto& id: server_ids_)
+        {
+            if (id != id_) // Exclude self
+            {
+                message.set_dest_id(id);
+                send_durable_message(message);
+            }
+        }
+    }
+
+    // Change server state to leader
+    void Server::become_leader()
+    {
+        #ifdef DEBUG
+        std::cout << "Server " << id_ << " becomes leader";
+        if (preferred_leader_)
+            std::cout << " of group " << group_id_;
+        std::cout << std::endl;
+        #endif
+
+        state_ = ServerState::LEADER;
+        leader_id_ = std::make_optional(id_);
+        check_quorum_clock_.reset();
+        balance_clock_.reset();
+
+        for (const auto& id: server_ids_)
+        {
+            // Retrieve index for the server
+            index_t server_index = server_indexes_dic_[id];
+
+            progress_.at(server_index).reset(log_size());
+        }
+
+        quorum_.reset();
+
+        // Send initial AppendEntries request to each follower
+        leader_send_heartbeats();
+    }
+
+    // Handle a batch of messages (at most message_budget_), the writes of the batch are persisted together
+    void Server::handle_messages()
+    {
+        uint32 nb_handled = 0;
+
+        // Time the oldest message waited, averaged over the last batches
+        if (!messages_.empty())
+            processing_latency_ = 0.9 * processing_latency_ + 0.1 * message_wait_clock_.get_time();
+
+        while (!messages_.empty() && nb_handled < message_budget_)
+        {
+            message::Message message = std::move(messages_.front());
+            messages_.pop();
+            ++nb_handled;
+
+            // Consecutive acknowledgements of the same follower: only the furthest one matters
+            std::optional<uint32> match_log_size = successful_append_entries_response(message);
+            while (match_log_size && !messages_.empty() && nb_handled < message_budget_)
+            {
+                const message::Message& next_message = messages_.front();
+                std::optional<uint32> next_match_log_size = successful_append_entries_response(next_message);
+
+                if (!next_match_log_size || next_message.source_id() != message.source_id() || next_message.term() != message.term())
+                    break;
+
+                if (next_match_log_size.value() >= match_log_size.value())
+                {
+                    message = std::move(messages_.front());
+                    match_log_size = next_match_log_size;
+                }
+
+                messages_.pop();
+                ++nb_handled;
+            }
+
+            handle_message(message);
+        }
+
+        // A single commit index computation for all the acknowledgements of the batch
+        if (match_index_changed_)
+        {
+            match_index_changed_ = false;
+
+            if (state_ == ServerState::LEADER)
+                leader_update_commit_index();
+        }
+    }
+
+    // Match log size of a successful Append Entries response, none for any other message
+    std::optional<uint32> Server::successful_append_entries_response(const message::Message& message)
+    {
+        if (message.type() != message::MessageType::APPEND_ENTRIES_RESPONSE)
+            return std::nullopt;
+
+        append_entry::AppendEntriesResponse response;
+        message.payload().UnpackTo(&response);
+
+        if (!response.success())
+            return std::nullopt;
+
+        return std::make_optional(response.match_log_size());
+    }
+
+    // Server receives a vote request
+    void Server::handle_vote_request(const message::Message& message)
+    {
+        vote::VoteRequest request;
+        message.payload().UnpackTo(&request);
+
+        // Lease reads: the current leader may still serve reads, do not help electing another one
+        // unless it handed the leadership over (it stopped serving reads from its lease)
+        if (
+            lease_reads_ &&
+            leader_id_ &&
+            !request.leadership_transfer() &&
+            (state_ == ServerState::LEADER || clock_.get_time() < min_election_timeout)
+        )
+            return;
+
+        // Outdated term
+        if (message.term() > current_term_)
+            become_follower(message.term());
+
+        // Send Vote Response
+        vote::VoteResponse response;
+
+        // If votedFor is null or candidatedId, and candidate's log is at least as up-to-date as receiver's log, grant vote
+        if (
+            message.term() == current_term_ &&
+            (voted_for_ == std::nullopt || voted_for_.value() == request.candidate_id()) &&
+            is_log_up_to_date(request)
+        )
+        {
+            response.set_vote_granted(true);
+            voted_for_ = std::make_optional(request.candidate_id());
+
+            clock_.reset();
+        }
+        else // Reply false if term < currentTerm
+            response.set_vote_granted(false);
+
+        message::Message response_message;
+        response_message.set_source_id(id_);
+        response_message.set_dest_id(request.candidate_id());
+        response_message.set_type(message::MessageType::VOTE_RESPONSE);
+        response_message.mutable_payload()->PackFrom(response);
+        response_message.set_term(current_term_);
+
+        // The vote must be durable before the candidate can count it
+        send_durable_message(response_message);
     }
 
     // Server receives a vote response
     void Server::handle_vote_response(const message::Message& message)
     {
-        if (state_ != ServerState::CANDIDATE)
+        // Outdated term
+        if (message.term() > current_term_)
+        {
+            become_follower(message.term());
+            return;
+        }
+
+        // Only the votes of the current election count
+        if (state_ != ServerState::CANDIDATE || message.term() != current_term_)
             return;
 
         vote::VoteResponse response;
@@ -429,9 +1329,67 @@ namespace raft
             #endif
         }
 
-        // If votes received from majority of servers: become leader
+        // If votes received from majority of servers: become leader
+        if (votes_count_ >= server_ids_.size() / 2 + 1)
+            become_leader();
+    }
+
+    // Grant a pre-vote without changing our term or vote, unless we still hear from the leader
+    void Server::handle_pre_vote_request(const message::Message& message)
+    {
+        vote::VoteRequest request;
+        message.payload().UnpackTo(&request);
+
+        bool has_leader = leader_id_ && (state_ == ServerState::LEADER || clock_.get_time() < min_election_timeout);
+
+        vote::VoteResponse response;
+        response.set_vote_granted(message.term() > current_term_ && !has_leader && is_log_up_to_date(request));
+
+        message::Message response_message;
+        response_message.set_source_id(id_);
+        response_message.set_dest_id(request.candidate_id());
+        response_message.set_type(message::MessageType::PRE_VOTE_RESPONSE);
+        response_message.mutable_payload()->PackFrom(response);
+        // A granted pre-vote is for the requested term, a rejection tells our term
+        response_message.set_term(response.vote_granted() ? message.term() : current_term_);
+
+        rpc_->send_message(response_message);
+    }
+
+    void Server::handle_pre_vote_response(const message::Message& message)
+    {
+        vote::VoteResponse response;
+        message.payload().UnpackTo(&response);
+
+        if (!response.vote_granted())
+        {
+            // Outdated term
+            if (message.term() > current_term_)
+                become_follower(message.term());
+            return;
+        }
+
+        if (state_ != ServerState::PRE_CANDIDATE || message.term() != current_term_ + 1)
+            return;
+
+        ++votes_count_;
+
+        // A majority would vote for us: start the real election
         if (votes_count_ >= server_ids_.size() / 2 + 1)
-            become_leader();
+            become_candidate();
+    }
+
+    // The leader hands the leadership over to us: start an election without waiting for the election timeout
+    void Server::handle_timeout_now(const message::Message& message)
+    {
+        if (message.term() != current_term_ || state_ != ServerState::FOLLOWER)
+            return;
+
+        #ifdef DEBUG
+        std::cout << "Server " << id_ << " takes the leadership over from " << message.source_id() << std::endl;
+        #endif
+
+        become_candidate(true);
     }
 
     // Apply new log_entries
@@ -442,18 +1400,25 @@ namespace raft
         index_t old_log_index = begin_index;
         index_t new_log_index = 0;
 
+        // Skip the log entries already compacted in the snapshot (they are committed)
+        while (old_log_index < log_offset() && new_log_index < new_log_entries.size())
+        {
+            ++old_log_index;
+            ++new_log_index;
+        }
+
         bool is_conflicted = false;
 
         while (!is_conflicted)
         {
             if (
-                (old_log_index >= log_entries_.size()) ||
+                (old_log_index >= log_size()) ||
                 (new_log_index >= new_log_entries.size())
             ) {
                 break;
             }
 
-            auto old_log_term = log_entries_.at(old_log_index).term();
+            auto old_log_term = log_entry_at(old_log_index).term();
             auto new_log_term = new_log_entries.at(new_log_index).term();
 
             if (old_log_term != new_log_term)
@@ -466,211 +1431,599 @@ namespace raft
             ++new_log_index;
         }
 
-        if (is_conflicted)
-        {
-            log_entries_.erase(log_entries_.end() - old_log_index, log_entries_.end());
+        if (is_conflicted)
+        {
+            log_entries_.erase(log_entries_.begin() + (old_log_index - log_offset()), log_entries_.end());
+
+            // Only drop the conflicting suffix from the write-ahead log
+            if (old_log_index < persisted_log_size_)
+            {
+                storage_.truncate(old_log_index);
+                persisted_log_size_ = old_log_index;
+            }
+
+            #ifdef DEBUG
+            std::cout << "Server " << id_ << " had conflicted log entries from index " << old_log_index << "!" << std::endl;
+            #endif
+        }
+
+        for (index_t i = new_log_index; i < new_log_entries.size(); ++i)
+        {
+            log_entries_.push_back(new_log_entries.at(i));
+            ++count;
+        }
+
+        return count;
+    }
+
+    // Server receives an Append Entries request
+    // i.e message from the leader to followers to apply its log entries
+    // Follower: Tell the leader where the logs diverge so it can skip a whole term
+    void Server::set_conflict_hints(append_entry::AppendEntriesResponse& response, index_t prev_log_index)
+    {
+        // The log is too short: the leader can jump straight to its end
+        if (prev_log_index >= log_size())
+        {
+            response.set_conflict_index(log_size());
+            return;
+        }
+
+        term_t conflict_term = log_term_at(prev_log_index).value();
+
+        // First index of the conflicting term (the compacted entries are committed, so they cannot conflict)
+        index_t conflict_index = prev_log_index;
+        while (conflict_index > log_offset() && log_term_at(conflict_index - 1).value() == conflict_term)
+            --conflict_index;
+
+        google::protobuf::UInt32Value* term = google::protobuf::UInt32Value().New();
+        term->set_value(conflict_term);
+        response.set_allocated_conflict_term(term);
+        response.set_conflict_index(conflict_index);
+    }
+
+    void Server::handle_append_entries_request(const message::Message& message)
+    {
+        // A deposed leader (e.g. after a leadership transfer) must neither delay our election nor lower our term
+        if (message.term() >= current_term_)
+        {
+            clock_.reset();
+
+            // Outdated term or not a follower (only one leader can exist)
+            if (message.term() > current_term_ || state_ != ServerState::FOLLOWER)
+                become_follower(message.term(), std::make_optional(message.source_id()));
+        }
+
+        append_entry::AppendEntriesRequest request;
+        message.payload().UnpackTo(&request);
+
+        // Send Append Entries Response
+        append_entry::AppendEntriesResponse response;
+        response.set_read_round(request.read_round());
+        response.set_processing_latency(std::lround(processing_latency_));
+
+        if (message.term() == current_term_)
+        {
+            leader_id_ = std::make_optional(message.source_id());
+
+            index_t prev_log_index = request.prev_log_metadata().prev_log_index();
+            index_t prev_log_term = request.prev_log_metadata().prev_log_term();
+
+            if (
+                !request.has_prev_log_metadata() ||
+                (request.has_prev_log_metadata() && prev_log_index < log_size() && (prev_log_index < log_offset() || prev_log_term == log_term_at(prev_log_index).value()))
+            )
+            {
+                response.set_success(true);
+
+                // Retrieve log_entries in the response
+                std::vector<log_entry::LogEntry> new_log_entries;
+                for (index_t i = 0; i < (index_t) request.log_entries_size(); ++i)
+                    new_log_entries.push_back(request.log_entries(i));
+
+                // Apply new log_entries
+                index_t begin_index = !request.has_prev_log_metadata() ? 0 : prev_log_index + 1;
+                uint32 nb_of_new_logs = apply_new_log_entries(begin_index, new_log_entries);
+
+                // The log only matches the leader's up to the last new entry (or prevLogIndex without entries):
+                // a stale suffix after it may survive a partial send or a heartbeat
+                index_t match_log_size = begin_index + request.log_entries_size();
+                response.set_match_log_size(match_log_size);
+
+                #ifdef DEBUG
+                if (nb_of_new_logs > 0)
+                    std::cout << "Server " << id_ << " has applied " << nb_of_new_logs << " log(s)" << std::endl;
+                #endif
+
+                // If leaderCommit > commitIndex, set commitIndex=min(leaderCommit, index of last new entry)
+                if (
+                    match_log_size > 0 &&
+                    request.has_leader_commit_index() &&
+                    (!commit_index_ || request.leader_commit_index().value() > commit_index_.value())
+                )
+                {
+                    index_t commit_index = std::min((index_t) request.leader_commit_index().value(), match_log_size - 1);
+
+                    // An older request may match less than what is already committed
+                    if (!commit_index_ || commit_index > commit_index_.value())
+                        commit_index_ = std::make_optional(commit_index);
+                }
+            }
+            else // Reply false if log_entries don't contain an entry at prevLogIndex whose term matches pervLogTerm
+            {
+                response.set_success(false);
+                set_conflict_hints(response, prev_log_index);
+            }
+        }
+        else // Reply false if term < currentTerm
+            response.set_success(false);
+
+        response.set_prev_log_size(request.has_prev_log_metadata() ? request.prev_log_metadata().prev_log_index() + 1 : 0);
+
+        message::Message response_message;
+        response_message.set_source_id(id_);
+        response_message.set_dest_id(request.leader_id());
+        response_message.set_type(message::MessageType::APPEND_ENTRIES_RESPONSE);
+        response_message.mutable_payload()->PackFrom(response);
+        response_message.set_term(current_term_);
+
+        // Heartbeats are acknowledged too: the leader needs them to resume a paused replication
+        // The log entries must be durable before the leader can count them
+        send_durable_message(response_message);
+    }
+
+    // Leader receives an Append Entries response
+    void Server::handle_append_entries_response(const message::Message& message)
+    {
+        // Outdated term
+        if (message.term() > current_term_)
+        {
+            become_follower(message.term());
+            return;
+        }
+
+        append_entry::AppendEntriesResponse response;
+        message.payload().UnpackTo(&response);
+
+        // Check if the server is the leader
+        if (state_ == ServerState::LEADER && current_term_ == message.term())
+        {
+            // Retrieve index for the server
+            index_t server_index = server_indexes_dic_[message.source_id()];
+
+            Progress& progress = progress_.at(server_index);
+            progress.recent_active = true;
+            progress.processing_latency = std::make_optional(response.processing_latency());
+
+            // Any response of the term acknowledges the leadership (ReadIndex)
+            if (response.read_round() > progress.read_round)
+            {
+                progress.read_round = response.read_round();
+
+                // The lease starts when the acknowledged round was sent
+                std::optional<time_t> round_time = read_round_time(progress.read_round);
+                if (lease_reads_ && round_time)
+                    progress.lease_start = round_time;
+            }
+
+            if (response.success())
+            {
+                // The commit index is recomputed once for the whole batch
+                if (progress.on_acknowledged(response.match_log_size()))
+                {
+                    quorum_.update(server_index, progress.match_index);
+                    match_index_changed_ = true;
+
+                    if (transfer_target_ == std::make_optional(message.source_id()))
+                        leader_check_transfer();
+                }
+
+                // The follower's log matches: switch to optimistic replication
+                if (progress.state == ProgressState::PROBE)
+                    progress.become_replicate();
+            }
+            else
+            {
+                // Rejections always refer to a prev log entry
+                if (response.prev_log_size() == 0)
+                    return;
+
+                index_t rejected_index = response.prev_log_size() - 1;
+
+                // Outdated rejection (the follower's log already matches after it, or another probe was sent since)
+                if (
+                    (progress.match_index && rejected_index <= progress.match_index.value()) ||
+                    (progress.state == ProgressState::PROBE && response.prev_log_size() != progress.next_index) ||
+                    progress.state == ProgressState::SNAPSHOT
+                )
+                    return;
+
+                // Step back before the rejected entry (a whole term at once) and probe again
+                index_t match_size = progress.match_index ? progress.match_index.value() + 1 : 0;
+                index_t next_index = std::min(leader_next_index_after_conflict(response), rejected_index);
+                progress.become_probe(std::max(next_index, match_size));
+            }
+
+            // Send what the follower is still missing
+            leader_send_append_entries(message.source_id(), false);
+        }
+    }
+
+    // Server receives a snapshot chunk from the leader
+    void Server::handle_install_snapshot_request(const message::Message& message)
+    {
+        install_snapshot::InstallSnapshotRequest request;
+        message.payload().UnpackTo(&request);
+
+        message::Message response_message;
+        response_message.set_source_id(id_);
+        response_message.set_dest_id(request.leader_id());
+        response_message.set_type(message::MessageType::INSTALL_SNAPSHOT_RESPONSE);
+
+        install_snapshot::InstallSnapshotResponse response;
+        response.set_last_included_index(request.last_included_index());
+
+        // Reply immediately if term < currentTerm
+        if (message.term() < current_term_)
+        {
+            response_message.set_term(current_term_);
+            response_message.mutable_payload()->PackFrom(response);
+            rpc_->send_message(response_message);
+            return;
+        }
+
+        clock_.reset();
+
+        // Outdated term or not a follower (only one leader can exist)
+        if (message.term() > current_term_ || state_ != ServerState::FOLLOWER)
+            become_follower(message.term(), std::make_optional(message.source_id()));
+
+        leader_id_ = std::make_optional(message.source_id());
+
+        // Create a new snapshot if first chunk (offset is 0) or if the leader sends another snapshot
+        if (
+            request.offset() == 0 ||
+            pending_snapshot_.last_included_index() != request.last_included_index() ||
+            pending_snapshot_.last_included_term() != request.last_included_term()
+        )
+        {
+            pending_snapshot_.Clear();
+            pending_snapshot_.set_last_included_index(request.last_included_index());
+            pending_snapshot_.set_last_included_term(request.last_included_term());
+        }
+
+        // Write the data into the snapshot at the given offset (chunks already received are ignored)
+        if (request.offset() == pending_snapshot_.data().size())
+            pending_snapshot_.mutable_data()->append(request.data());
+
+        response.set_next_offset(pending_snapshot_.data().size());
+        response_message.set_term(current_term_);
+
+        if (request.done() && request.offset() + request.data().size() == pending_snapshot_.data().size())
+        {
+            install_snapshot(pending_snapshot_);
+            pending_snapshot_.Clear();
+
+            response.set_done(true);
+            response_message.mutable_payload()->PackFrom(response);
+
+            // The snapshot must be durable before the leader can count it
+            send_durable_message(response_message);
+        }
+        else
+        {
+            response_message.mutable_payload()->PackFrom(response);
+            rpc_->send_message(response_message);
+        }
+    }
+
+    // Leader receives an Install Snapshot response
+    void Server::handle_install_snapshot_response(const message::Message& message)
+    {
+        // Outdated term
+        if (message.term() > current_term_)
+        {
+            become_follower(message.term());
+            return;
+        }
+
+        install_snapshot::InstallSnapshotResponse response;
+        message.payload().UnpackTo(&response);
+
+        if (state_ != ServerState::LEADER || current_term_ != message.term())
+            return;
+
+        Progress& progress = progress_.at(server_indexes_dic_[message.source_id()]);
+        progress.recent_active = true;
+
+        if (progress.state != ProgressState::SNAPSHOT)
+            return;
+
+        // The snapshot was replaced in the meantime: restart from the beginning
+        if (!snapshot_ || snapshot_.value().last_included_index() != response.last_included_index())
+        {
+            progress.snapshot_offset = 0;
+            leader_send_snapshot(message.source_id());
+            return;
+        }
+
+        if (response.done())
+        {
+            if (progress.on_acknowledged(response.last_included_index() + 1))
+            {
+                quorum_.update(server_indexes_dic_[message.source_id()], progress.match_index);
+                match_index_changed_ = true;
+            }
+
+            progress.become_replicate();
+            leader_send_append_entries(message.source_id(), false);
+        }
+        else
+        {
+            // Send the next chunk right away
+            progress.snapshot_offset = response.next_offset();
+            leader_send_snapshot(message.source_id());
+        }
+    }
+
+    void Server::handle_command_entry_request(const message::Message& message)
+    {
+        #ifdef DEBUG
+        std::cout << "Server " << id_ << " received a command from node " << message.source_id() << "!" << std::endl;
+        #endif
+
+        command_entry::CommandEntryRequest request;
+        message.payload().UnpackTo(&request);
+
+        // A command forwarded by a follower carries the id of its client
+        node_id_t client_id = request.has_client_id() ? request.client_id().value() : message.source_id();
+        std::optional<node_id_t> proxy_id = request.has_client_id() ? std::make_optional(message.source_id()) : std::nullopt;
+
+        if (state_ == ServerState::LEADER)
+        {
+            // A retried command is acknowledged without being appended again
+            if (request.sequence() > 0 && leader_handle_duplicate_command(client_id, proxy_id, request.sequence()))
+                return;
+
+            // Create my new log entry, appended with the other commands of the batching window
+            log_entry::LogEntry new_entry;
+            new_entry.set_client_id(client_id);
+            new_entry.set_leader_id(message.dest_id());
+            new_entry.set_command(request.command());
+            new_entry.set_term(current_term_);
+            new_entry.set_sequence(request.sequence());
+            new_entry.set_first_unacked_sequence(request.first_unacked_sequence());
+
+            if (pending_commands_.empty())
+                command_batch_clock_.reset();
+
+            pending_commands_bytes_ += request.command().size();
+            pending_commands_.push_back(PendingCommand { std::move(new_entry), proxy_id });
+
+            if (
+                pending_commands_.size() >= command_batch_size_ ||
+                pending_commands_bytes_ >= command_batch_bytes_
+            )
+                leader_append_pending_commands();
+        }
+        else if (forward_commands_ && leader_id_ && !proxy_id) // A forwarded command is never forwarded again
+            forward_command_entry_request(request, client_id);
+        else
+            reject_command_entry_request(client_id, proxy_id, request.sequence());
+    }
+
+    // Follower: Forward a client command to the leader, the leader response is relayed back to the client
+    // The commands forwarded during a loop iteration are sent to the leader in a single batch by the RPC
+    void Server::forward_command_entry_request(command_entry::CommandEntryRequest& request, node_id_t client_id)
+    {
+        google::protobuf::UInt32Value* id = google::protobuf::UInt32Value().New();
+        id->set_value(client_id);
+        request.set_allocated_client_id(id);
+
+        message::Message message;
+        message.set_source_id(id_);
+        message.set_dest_id(leader_id_.value());
+        message.set_type(message::MessageType::COMMAND_ENTRY_REQUEST);
+        message.mutable_payload()->PackFrom(request);
+
+        rpc_->send_message(message);
+    }
 
-            #ifdef DEBUG
-            std::cout << "Server " << id_ << " had conflicted log entries from index " << old_log_index << "!" << std::endl;
-            #endif
-        }
+    // Answer a command sent to a server that is not the leader right away, with the leader if known
+    void Server::reject_command_entry_request(node_id_t client_id, std::optional<node_id_t> proxy_id, uint64 sequence)
+    {
+        command_entry::CommandEntryResponse response;
+        response.set_command_committed(false);
+        response.add_sequences(sequence);
 
-        for (index_t i = new_log_index; i < new_log_entries.size(); ++i)
+        if (leader_id_)
         {
-            log_entries_.push_back(new_log_entries.at(i));
-            ++count;
+            google::protobuf::UInt32Value* hint = google::protobuf::UInt32Value().New();
+            hint->set_value(leader_id_.value());
+            response.set_allocated_leader_hint(hint);
         }
 
-        return count;
+        send_command_entry_response(client_id, proxy_id, response);
     }
 
-    // Server receives an Append Entries request
-    // i.e message from the leader to followers to apply its log entries
-    void Server::handle_append_entries_request(const message::Message& message)
+    // Follower: Relay the response of a forwarded command to its client
+    void Server::handle_command_entry_response(const message::Message& message)
     {
-        clock_.reset();
+        command_entry::CommandEntryResponse response;
+        message.payload().UnpackTo(&response);
 
-        // Outdated term or not a follower (only one leader can exist)
-        if (message.term() > current_term_ || state_ != ServerState::FOLLOWER)
-            become_follower(message.term());
+        if (!response.has_client_id())
+            return;
 
-        append_entry::AppendEntriesRequest request;
+        node_id_t client_id = response.client_id().value();
+        response.clear_client_id();
+
+        send_command_entry_response(client_id, std::nullopt, response);
+    }
+
+    void Server::handle_read_request(const message::Message& message)
+    {
+        read_index::ReadRequest request;
         message.payload().UnpackTo(&request);
 
-        // Send Append Entries Response
-        append_entry::AppendEntriesResponse response;
+        // A read forwarded by a follower carries the id of its client
+        node_id_t client_id = request.has_client_id() ? request.client_id().value() : message.source_id();
+        std::optional<node_id_t> proxy_id = request.has_client_id() ? std::make_optional(message.source_id()) : std::nullopt;
 
-        if (message.term() == current_term_)
+        if (state_ == ServerState::LEADER)
         {
-            index_t prev_log_index = request.prev_log_metadata().prev_log_index();
-            index_t prev_log_term = request.prev_log_metadata().prev_log_term();
-
-            if (
-                !request.has_prev_log_metadata() ||
-                (request.has_prev_log_metadata() && prev_log_index < log_entries_.size() && prev_log_term == log_entries_.at(prev_log_index).term())
-            )
+            // Within the lease, the commit index is known to be the latest one without a round trip
+            if (lease_reads_ && leader_committed_in_term() && leader_has_lease())
             {
-                response.set_success(true);
-                response.set_nb_log_entries(request.log_entries_size());
-
-                // Retrieve log_entries in the response
-                std::vector<log_entry::LogEntry> new_log_entries;
-                for (index_t i = 0; i < (index_t) request.log_entries_size(); ++i)
-                    new_log_entries.push_back(request.log_entries(i));
-
-                // Apply new log_entries
-                index_t begin_index = !request.has_prev_log_metadata() ? 0 : prev_log_index + 1;
-                uint32 nb_of_new_logs = apply_new_log_entries(begin_index, new_log_entries);
-
                 #ifdef DEBUG
-                if (nb_of_new_logs > 0)
-                    std::cout << "Server " << id_ << " has applied " << nb_of_new_logs << " log(s)" << std::endl;
+                std::cout << "Server " << id_ << " serves a read within its lease" << std::endl;
                 #endif
 
-                // If leaderCommit > commitIndex, set commitIndex=min(leaderCommit, index of last new entry)
-                if (
-                    (!commit_index_ && request.has_leader_commit_index()) ||
-                    (request.has_leader_commit_index() && request.leader_commit_index().value() > commit_index_.value())
-                )
-                {
-                    index_t commit_index = std::min(
-                        (int) request.leader_commit_index().value(),
-                        std::max(0, (int) log_entries_.size() - 1)
-                    );
-
-                    commit_index_ = std::make_optional(commit_index);
-                }
+                confirmed_reads_.emplace(commit_index_.value(), PendingRead { client_id, proxy_id, request.sequence(), request.query() });
+                leader_answer_reads();
             }
-            else // Reply false if log_entries don't contain an entry at prevLogIndex whose term matches pervLogTerm
-                response.set_success(false);
+            else
+                reads_to_confirm_.push_back(PendingRead { client_id, proxy_id, request.sequence(), request.query() });
         }
-        else // Reply false if term < currentTerm
+        else if (forward_commands_ && leader_id_ && !proxy_id) // A forwarded read is never forwarded again
+            forward_read_request(request, client_id);
+        else
+        {
+            read_index::ReadResponse response;
             response.set_success(false);
+            response.set_sequence(request.sequence());
 
-        message::Message response_message;
-        response_message.set_source_id(id_);
-        response_message.set_dest_id(request.leader_id());
-        response_message.set_type(message::MessageType::APPEND_ENTRIES_RESPONSE);
-        response_message.mutable_payload()->PackFrom(response);
-        response_message.set_term(current_term_);
+            if (leader_id_)
+            {
+                google::protobuf::UInt32Value* hint = google::protobuf::UInt32Value().New();
+                hint->set_value(leader_id_.value());
+                response.set_allocated_leader_hint(hint);
+            }
 
-        if (request.log_entries_size() > 0) // No need to seed a response if the log entries was empty
-            rpc_->send_message(response_message);
+            send_read_response(client_id, proxy_id, response);
+        }
+    }
 
-        persist_state();
+    // Follower: Forward a client read to the leader, the leader response is relayed back to the client
+    void Server::forward_read_request(read_index::ReadRequest& request, node_id_t client_id)
+    {
+        google::protobuf::UInt32Value* id = google::protobuf::UInt32Value().New();
+        id->set_value(client_id);
+        request.set_allocated_client_id(id);
+
+        message::Message message;
+        message.set_source_id(id_);
+        message.set_dest_id(leader_id_.value());
+        message.set_type(message::MessageType::READ_REQUEST);
+        message.mutable_payload()->PackFrom(request);
+
+        rpc_->send_message(message);
     }
 
-    // Leader receives an Append Entries response
-    void Server::handle_append_entries_response(const message::Message& message)
+    // Follower: Relay the response of a forwarded read to its client
+    void Server::handle_read_response(const message::Message& message)
     {
-        // Outdated term
-        if (message.term() > current_term_)
-        {
-            become_follower(message.term());
+        read_index::ReadResponse response;
+        message.payload().UnpackTo(&response);
+
+        if (!response.has_client_id())
             return;
-        }
 
-        append_entry::AppendEntriesResponse response;
-        message.payload().UnpackTo(&response);
+        node_id_t client_id = response.client_id().value();
+        response.clear_client_id();
 
-        // Check if the server is the leader
-        if (state_ == ServerState::LEADER && current_term_ == message.term())
-        {
-            // Retrieve index for the server
-            index_t server_index = server_indexes_dic_[message.source_id()];
+        send_read_response(client_id, std::nullopt, response);
+    }
 
-            if (response.success())
-            {
-                index_t next_index = next_index_.at(server_index);
-                next_index_.at(server_index) = next_index + response.nb_log_entries();
-                match_index_.at(server_index) = std::make_optional(next_index_.at(server_index) - 1);
+    // Leader: Returns true if the command is already committed or in the log, and answers it once committed
+    bool Server::leader_handle_duplicate_command(node_id_t client_id, std::optional<node_id_t> proxy_id, uint64 sequence)
+    {
+        if (sessions_.is_applied(client_id, sequence))
+        {
+            command_entry::CommandEntryResponse response;
+            response.set_command_committed(true);
+            response.add_sequences(sequence);
+            send_command_entry_response(client_id, proxy_id, response);
+            return true;
+        }
 
-                // Used to log if new log entries have to be committed
-                std::optional<index_t> last_commit_index = commit_index_;
+        // Not applied yet: the command can only be in the uncommitted part of the log
+        index_t begin = std::max(log_offset(), last_applied_commit_index_ ? last_applied_commit_index_.value() + 1 : 0);
+        for (index_t index = begin; index < log_size(); ++index)
+        {
+            const log_entry::LogEntry& entry = log_entry_at(index);
 
-                index_t begin = commit_index_ ? commit_index_.value() + 1 : 0;
+            // Possibly appended by a previous leader: answer the client once it is committed
+            // through the path of this retry, the client may no longer use the proxy of the previous attempt
+            if (entry.client_id() == client_id && entry.sequence() == sequence)
+            {
+                pending_completions_.insert_or_assign(index, Completion { client_id, sequence, proxy_id });
 
-                for (index_t i = begin; i < log_entries_.size(); ++i)
-                {
-                    if (log_entries_.at(i).term() == current_term_)
-                    {
-                        // Check how many servers want to commit the new log_entries entries
-                        uint32 match_count = 1;
-                        for (const auto& id: server_ids_)
-                        {
-                            if (id != id_)
-                            {
-                                index_t idx = server_indexes_dic_[id];
-                                auto match_index = match_index_.at(idx);
-
-                                if (match_index && match_index.value() >= i)
-                                    ++match_count;
-                            }
-                        }
-
-                        // If we obtain the majority, we commit the new log entries
-                        if (match_count >= (server_ids_.size() / 2) + 1)
-                            commit_index_ = std::make_optional(i);
-                    }
-                }
+                // An entry of a previous term is only committed with an entry of the current term (§5.4.2)
+                if (log_term_at(log_size() - 1).value() != current_term_)
+                    leader_append_no_op();
 
-                if (
-                    (!last_commit_index && commit_index_) ||
-                    (commit_index_ && commit_index_.value() != last_commit_index.value())
-                )
-                {
-                    #ifdef DEBUG
-                    std::cout << "Leader commit index changed to " << commit_index_.value() << std::endl;
-                    #endif
+                return true;
+            }
+        }
 
-                    //leader_send_heartbeats();
-                }
+        for (auto& command: pending_commands_)
+        {
+            if (command.entry.client_id() == client_id && command.entry.sequence() == sequence)
+            {
+                command.proxy_id = proxy_id;
+                return true;
             }
-            else
-                next_index_.at(server_index) -= 1;
         }
+
+        return false;
     }
 
-    void Server::handle_command_entry_request(const message::Message& message)
+    // Leader: Append an empty entry of the current term, to commit the entries of the previous terms
+    void Server::leader_append_no_op()
     {
-        #ifdef DEBUG
-        std::cout << "Server " << id_ << " received a command from node " << message.source_id() << "!" << std::endl;
-        #endif
+        log_entry::LogEntry entry;
+        entry.set_leader_id(id_);
+        entry.set_index(log_size());
+        entry.set_term(current_term_);
 
-        if (state_ == ServerState::LEADER)
-        {
-            command_entry::CommandEntryRequest request;
-            message.payload().UnpackTo(&request);
+        log_entries_.push_back(std::move(entry));
 
-            // Create my new log entry
-            log_entry::LogEntry new_entry;
-            new_entry.set_client_id(message.source_id());
-            new_entry.set_leader_id(message.dest_id());
-            new_entry.set_index(log_entries_.size());
-            new_entry.set_command(request.command());
-            new_entry.set_term(current_term_);
+        leader_replicate();
+    }
+
+    // Leader: Append the commands of the batching window together and replicate them with a single fan-out
+    void Server::leader_append_pending_commands()
+    {
+        if (pending_commands_.empty() || transfer_target_)
+            return;
 
-            log_entries_.push_back(new_entry);
-            log_entries_to_commit_.emplace(new_entry);
+        for (auto& command: pending_commands_)
+        {
+            command.entry.set_index(log_size());
+            pending_completions_.emplace(command.entry.index(), Completion { command.entry.client_id(), command.entry.sequence(), command.proxy_id });
+            log_entries_.push_back(std::move(command.entry));
+        }
 
-            persist_state();
+        pending_commands_.clear();
+        pending_commands_bytes_ = 0;
 
-            leader_send_heartbeats();
+        // The followers can write the new log entries while the leader is syncing them
+        leader_replicate();
 
-            #ifdef DEBUG
-            std::cout << "Leader log entries:" << std::endl;
-            for (auto entry = log_entries_.begin(); entry != log_entries_.end(); ++entry)
-                std::cout << "- Log " << entry->index() << " with command '" << entry->command() << "'" << std::endl;
-            #endif
-        }
+        #ifdef DEBUG
+        std::cout << "Leader log entries:" << std::endl;
+        for (auto entry = log_entries_.begin(); entry != log_entries_.end(); ++entry)
+            std::cout << "- Log " << entry->index() << " with command '" << entry->command() << "'" << std::endl;
+        #endif
     }
 
+    // The leader and the followers that know it answer, the candidates stay silent
     void Server::handle_search_leader_request(const message::Message& message)
     {
-        if (state_ == ServerState::LEADER)
+        if (leader_id_)
         {
             search_leader::SearchLeaderResponse response;
-            response.set_leader_id(id_);
+            response.set_leader_id(leader_id_.value());
 
             message::Message response_message;
             response_message.set_source_id(id_);
@@ -694,6 +2047,15 @@ namespace raft
             case message::MessageType::VOTE_RESPONSE:
                 handle_vote_response(message);
                 break;
+            case message::MessageType::PRE_VOTE_REQUEST:
+                handle_pre_vote_request(message);
+                break;
+            case message::MessageType::PRE_VOTE_RESPONSE:
+                handle_pre_vote_response(message);
+                break;
+            case message::MessageType::TIMEOUT_NOW:
+                handle_timeout_now(message);
+                break;
             case message::MessageType::APPEND_ENTRIES_REQUEST:
                 handle_append_entries_request(message);
                 break;
@@ -703,36 +2065,71 @@ namespace raft
             case message::MessageType::COMMAND_ENTRY_REQUEST:
                 handle_command_entry_request(message);
                 break;
+            case message::MessageType::COMMAND_ENTRY_RESPONSE:
+                handle_command_entry_response(message);
+                break;
             case message::MessageType::SEARCH_LEADER_REQUEST:
                 handle_search_leader_request(message);
                 break;
+            case message::MessageType::READ_REQUEST:
+                handle_read_request(message);
+                break;
+            case message::MessageType::READ_RESPONSE:
+                handle_read_response(message);
+                break;
+            case message::MessageType::INSTALL_SNAPSHOT_REQUEST:
+                handle_install_snapshot_request(message);
+                break;
+            case message::MessageType::INSTALL_SNAPSHOT_RESPONSE:
+                handle_install_snapshot_response(message);
+                break;
             default:
                 break;
         }
     }
 
-    // Listen to messages from other servers and clients
-    void Server::receive_all_messages()
+    // Send the message once every write made before is durable
+    void Server::send_durable_message(const message::Message& message)
     {
-        for (const auto& id: node_ids_)
+        unsynced_messages_.push_back(message);
+    }
+
+    void Server::send_durable_messages()
+    {
+        uint64 durable_sequence = storage_.durable_sequence();
+
+        while (!durable_messages_.empty() && durable_messages_.front().first <= durable_sequence)
         {
-            if (id == id_) // Ignore the current server messages
-                continue;
+            rpc_->send_message(durable_messages_.front().second);
+            durable_messages_.pop();
+        }
+    }
 
-            while (running_)
+    // Listen to messages from the controller, other servers and clients
+    void Server::receive_all_messages()
+    {
+        for (auto& message: rpc_->receive_messages())
+        {
+            if (message.source_id() == controller_id_)
+                messages_controller_.emplace(std::move(message));
+            else if (state_ != ServerState::DEAD) // A crashed server loses the messages sent to it
             {
-                std::optional<message::Message> message = rpc_->receive_message(id);
+                if (messages_.empty())
+                    message_wait_clock_.reset();
 
-                if (message)
-                    messages_.emplace(message.value());
-                else
-                    break;
+                messages_.emplace(std::move(message));
             }
         }
     }
 
+    // Hand the newly committed log entries to the state machine in a single batch
     void Server::check_new_commit_to_apply()
     {
+        ApplyTask task;
+        task.type = ApplyTaskType::APPLY;
+
+        std::optional<index_t> last_applied_commit_index = last_applied_commit_index_;
+
         while (
             (commit_index_ && !last_applied_commit_index_) ||
             (commit_index_ && last_applied_commit_index_ && commit_index_.value() > last_applied_commit_index_.value())
@@ -743,50 +2140,223 @@ namespace raft
             else
                 last_applied_commit_index_ = std::make_optional(last_applied_commit_index_.value() + 1);
 
-            if (state_ == ServerState::LEADER && !log_entries_to_commit_.empty())
+            const log_entry::LogEntry& entry = log_entry_at(last_applied_commit_index_.value());
+
+            if (apply_session(entry))
             {
-                log_entry::LogEntry entry = log_entries_to_commit_.front();
+                task.indexes.push_back(last_applied_commit_index_.value());
+                task.inputs.push_back(entry.command());
+            }
+        }
 
-                // Send command entry response
-                command_entry::CommandEntryResponse response;
-                response.set_command_committed(state_ == ServerState::LEADER && entry.leader_id() == id_);
+        if (last_applied_commit_index_ != last_applied_commit_index)
+        {
+            task.index = last_applied_commit_index_.value();
+            applier_.submit(std::move(task));
+        }
 
-                message::Message response_message;
-                response_message.set_source_id(id_);
-                response_message.set_dest_id(entry.client_id());
-                response_message.set_type(message::MessageType::COMMAND_ENTRY_RESPONSE);
-                response_message.mutable_payload()->PackFrom(response);
+        if (state_ == ServerState::LEADER)
+            leader_answer_reads();
 
-                rpc_->send_message(response_message);
+        handle_applied_tasks();
+    }
 
-                log_entries_to_commit_.pop();
+    // Results of the state machine: answer the clients, finish the snapshot
+    void Server::handle_applied_tasks()
+    {
+        ApplyTask task;
 
-                std::cout << "Log committed by leader with index " << entry.index() << std::endl;
+        while (applier_.poll(task))
+        {
+            switch (task.type)
+            {
+                case ApplyTaskType::APPLY:
+                    if (state_ == ServerState::LEADER)
+                        leader_complete_commands(task);
+                    break;
+                case ApplyTaskType::QUERY:
+                    answer_queried_reads(task);
+                    break;
+                case ApplyTaskType::SAVE:
+                    if (saving_snapshot_ && saving_snapshot_.value().last_included_index() == task.index)
+                        finish_snapshot(task.results.front());
+                    break;
+                case ApplyTaskType::RESTORE:
+                    break;
             }
         }
     }
 
-    // Listen to messages from the controller
-    void Server::receive_controller_messages()
+    // Record a committed command in the session of its client
+    // Returns false if the state machine must skip it: a no-op, or a command retried by its client (applied only once)
+    bool Server::apply_session(const log_entry::LogEntry& entry)
     {
-        while (running_)
+        // No-op entry of a new leader
+        if (entry.command().empty())
+            return false;
+
+        // Commands sent by the controller have no session
+        if (entry.sequence() > 0)
         {
-            std::optional<message::Message> message = rpc_->receive_message(controller_id_);
+            if (sessions_.is_applied(entry.client_id(), entry.sequence()))
+            {
+                #ifdef DEBUG
+                std::cout << "Server " << id_ << " skipped the duplicate log " << entry.index() << std::endl;
+                #endif
+                return false;
+            }
+
+            sessions_.apply(entry.client_id(), entry.sequence(), entry.first_unacked_sequence());
+        }
+
+        return true;
+    }
 
-            if (message)
-                messages_controller_.emplace(message.value());
+    // Leader: Answer the clients of the log entries applied by the batch, one response per client
+    void Server::leader_complete_commands(const ApplyTask& task)
+    {
+        std::map<std::pair<node_id_t, std::optional<node_id_t>>, command_entry::CommandEntryResponse> responses;
+
+        // Both are sorted by index
+        uint32 result_index = 0;
+
+        auto completion = pending_completions_.begin();
+        while (completion != pending_completions_.end() && completion->first <= task.index)
+        {
+            command_entry::CommandEntryResponse& response = responses[{ completion->second.client_id, completion->second.proxy_id }];
+            response.set_command_committed(true);
+            response.add_sequences(completion->second.sequence);
+
+            while (result_index < task.indexes.size() && task.indexes.at(result_index) < completion->first)
+                ++result_index;
+
+            // No result for a duplicate
+            if (result_index < task.indexes.size() && task.indexes.at(result_index) == completion->first)
+                response.add_results(task.results.at(result_index));
             else
-                break;
+                response.add_results("");
+
+            std::cout << "Log committed by leader with index " << completion->first << std::endl;
+
+            completion = pending_completions_.erase(completion);
+        }
+
+        for (const auto& [destination, response]: responses)
+            send_command_entry_response(destination.first, destination.second, response);
+    }
+
+    // Fail the commands waiting for their commit right away, so the clients retry without waiting for a timeout
+    void Server::fail_pending_completions(std::optional<node_id_t> leader_hint)
+    {
+        std::map<std::pair<node_id_t, std::optional<node_id_t>>, command_entry::CommandEntryResponse> responses;
+
+        for (const auto& [index, completion]: pending_completions_)
+        {
+            command_entry::CommandEntryResponse& response = responses[{ completion.client_id, completion.proxy_id }];
+            response.add_sequences(completion.sequence);
+        }
+
+        // Commands held back by a leadership transfer
+        for (const auto& command: pending_commands_)
+        {
+            command_entry::CommandEntryResponse& response = responses[{ command.entry.client_id(), command.proxy_id }];
+            response.add_sequences(command.entry.sequence());
+        }
+
+        for (auto& [destination, response]: responses)
+        {
+            response.set_command_committed(false);
+
+            if (leader_hint)
+            {
+                google::protobuf::UInt32Value* hint = google::protobuf::UInt32Value().New();
+                hint->set_value(leader_hint.value());
+                response.set_allocated_leader_hint(hint);
+            }
+        }
+
+        pending_completions_.clear();
+
+        for (const auto& [destination, response]: responses)
+            send_command_entry_response(destination.first, destination.second, response);
+    }
+
+    // Fail the reads not answered yet, so the clients retry without waiting for a timeout
+    void Server::fail_pending_reads(std::optional<node_id_t> leader_hint)
+    {
+        std::vector<PendingRead> reads;
+        reads.swap(reads_to_confirm_);
+        reads.insert(reads.end(), confirming_reads_.begin(), confirming_reads_.end());
+        confirming_reads_.clear();
+
+        while (!confirmed_reads_.empty())
+        {
+            reads.push_back(confirmed_reads_.front().second);
+            confirmed_reads_.pop();
+        }
+
+        for (const auto& read: reads)
+        {
+            read_index::ReadResponse response;
+            response.set_success(false);
+            response.set_sequence(read.sequence);
+
+            if (leader_hint)
+            {
+                google::protobuf::UInt32Value* hint = google::protobuf::UInt32Value().New();
+                hint->set_value(leader_hint.value());
+                response.set_allocated_leader_hint(hint);
+            }
+
+            send_read_response(read.client_id, read.proxy_id, response);
+        }
+    }
+
+    // The response of a forwarded read goes through the follower that forwarded it
+    void Server::send_read_response(node_id_t client_id, std::optional<node_id_t> proxy_id, read_index::ReadResponse response)
+    {
+        if (proxy_id)
+        {
+            google::protobuf::UInt32Value* id = google::protobuf::UInt32Value().New();
+            id->set_value(client_id);
+            response.set_allocated_client_id(id);
+        }
+
+        message::Message response_message;
+        response_message.set_source_id(id_);
+        response_message.set_dest_id(proxy_id.value_or(client_id));
+        response_message.set_type(message::MessageType::READ_RESPONSE);
+        response_message.mutable_payload()->PackFrom(response);
+
+        rpc_->send_message(response_message);
+    }
+
+    // The response of a forwarded command goes through the follower that forwarded it
+    void Server::send_command_entry_response(node_id_t client_id, std::optional<node_id_t> proxy_id, command_entry::CommandEntryResponse response)
+    {
+        if (proxy_id)
+        {
+            google::protobuf::UInt32Value* id = google::protobuf::UInt32Value().New();
+            id->set_value(client_id);
+            response.set_allocated_client_id(id);
         }
+
+        message::Message response_message;
+        response_message.set_source_id(id_);
+        response_message.set_dest_id(proxy_id.value_or(client_id));
+        response_message.set_type(message::MessageType::COMMAND_ENTRY_RESPONSE);
+        response_message.mutable_payload()->PackFrom(response);
+
+        rpc_->send_message(response_message);
     }
 
     void Server::handle_controller_messages()
     {
-        if (!messages_controller_.empty())
+        while (!messages_controller_.empty())
         {
-            message::Message message = messages_controller_.front();
-            handle_controller_message(message);
+            message::Message message = std::move(messages_controller_.front());
             messages_controller_.pop();
+            handle_controller_message(message);
         }
     }
 
@@ -844,6 +2414,16 @@ namespace raft
             speed_ = request.speed();
     }
 
+    // Only the leader can hand the leadership over
+    void Server::handle_transfer_leader_request(const message::Message& message)
+    {
+        transfer_leader::TransferLeaderRequest request;
+        message.payload().UnpackTo(&request);
+
+        if (state_ == ServerState::LEADER)
+            leader_transfer_leadership(request.target_id());
+    }
+
     void Server::handle_controller_message(const message::Message& message)
     {
         switch (message.type())
@@ -863,6 +2443,9 @@ namespace raft
             case message::MessageType::SPEED_REQUEST:
                 handle_speed_request(message);
                 break;
+            case message::MessageType::TRANSFER_LEADER_REQUEST:
+                handle_transfer_leader_request(message);
+                break;
             case message::MessageType::EXIT:
                 running_ = false;
                 break;
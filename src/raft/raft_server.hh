@@ -4,13 +4,25 @@
 #include <cstdlib> // std::rand
 #include <ctime> // std::time
 #include <unistd.h> // getpid sleep
-#include <algorithm> // std::min
+#include <algorithm> // std::min std::nth_element
+#include <functional> // std::greater
 #include <string> // std::to_string
 #include <queue> // std::queue
+#include <map> // std::map
+#include <deque> // std::deque
+#include <cmath> // std::lround
+#include <memory> // std::unique_ptr
+#include <string_view> // std::string_view
 #include <google/protobuf/wrappers.pb.h> // google::protobuf::UInt32Value
 
 #include "raft_clock.hh"
 #include "raft_storage.hh"
+#include "raft_config.hh"
+#include "raft_progress.hh"
+#include "raft_quorum.hh"
+#include "raft_sessions.hh"
+#include "raft_applier.hh"
+#include "raft_waiter.hh"
 #include "rpc.hh"
 #include "raft_types.hh"
 #include "types.hh"
@@ -18,6 +30,7 @@
 
 // Proto includes
 #include "proto/append_entry.pb.h"
+#include "proto/command_entry.pb.h"
 #include "proto/log_entry.pb.h"
 #include "proto/message.pb.h"
 #include "proto/vote.pb.h"
@@ -25,21 +38,56 @@
 #include "proto/election_timeout.pb.h"
 #include "proto/speed.pb.h"
 #include "proto/persistent_state.pb.h"
+#include "proto/snapshot.pb.h"
+#include "proto/install_snapshot.pb.h"
+#include "proto/read_index.pb.h"
+#include "proto/transfer_leader.pb.h"
 
 namespace raft
 {
-    enum class ServerState { FOLLOWER, CANDIDATE, LEADER, DEAD };
+    // PRE_CANDIDATE: the election timeout expired, waiting for a majority of pre-votes before becoming candidate
+    enum class ServerState { FOLLOWER, PRE_CANDIDATE, CANDIDATE, LEADER, DEAD };
 
     class Server
     {
         public:
-            Server(node_id_t id, node_id_t controller_id, const std::vector<node_id_t> server_ids, const std::vector<node_id_t> node_ids);
+            Server(node_id_t id, group_id_t group_id, node_id_t controller_id, const std::vector<node_id_t> server_ids, const std::vector<node_id_t> node_ids, const Config& config);
             void set_rpc(class rpc::RPC* rpc) { rpc_ = rpc; }
             void run();
+
+            // MARK: - Multi-Raft (several servers share the loop of a rank)
+
+            // One iteration of the server loop, without waiting
+            void step();
+            // Time (ms) until the next timer of the server loop, none if only a message can wake it up
+            std::optional<time_t> next_timeout();
+            uint64 durable_sequence() { return storage_.durable_sequence(); }
+            bool has_applied_task() { return applier_.has_completed_task(); }
+            bool is_running() const { return running_; }
+            // Send the heartbeats early when they are half due, so they share the batch of the other groups
+            void coalesce_heartbeats();
+
+            // MARK: - Introspection (unit tests)
+
+            ServerState state() const { return state_; }
+            term_t current_term() const { return current_term_; }
+            std::optional<index_t> commit_index() const { return commit_index_; }
         private:
             void restore_state();
             void persist_state();
 
+            // MARK: - Log compaction
+
+            index_t log_offset();
+            index_t log_size();
+            const log_entry::LogEntry& log_entry_at(index_t index);
+            std::optional<term_t> log_term_at(index_t index);
+            bool should_take_snapshot();
+            void take_snapshot();
+            void finish_snapshot(const std::string& state_machine);
+            void install_snapshot(const snapshot::Snapshot& snapshot);
+            void restore_applied_state(const snapshot::Snapshot& snapshot);
+
             void set_election_timeout();
             time_t speed_to_delay();
 
@@ -51,41 +99,89 @@ namespace raft
             void handle_candidate();
             void handle_leader();
 
+            void leader_check_quorum();
+            void leader_transfer_leadership(node_id_t target_id);
+            void leader_check_transfer();
+            void leader_balance_leadership();
             void leader_send_heartbeats();
+            void leader_replicate();
+            bool leader_handle_duplicate_command(node_id_t client_id, std::optional<node_id_t> proxy_id, uint64 sequence);
+            void leader_append_pending_commands();
+            void leader_append_no_op();
+            void leader_send_append_entries(node_id_t id, bool is_heartbeat);
+            std::pair<index_t, uint64> send_append_entries_request(node_id_t id, index_t next_index, uint64 max_bytes);
+            void leader_send_snapshot(node_id_t id);
+            index_t leader_next_index_after_conflict(const append_entry::AppendEntriesResponse& response);
+            void leader_update_commit_index();
+            void leader_start_read_round();
+            std::optional<time_t> read_round_time(uint64 round);
+            bool leader_committed_in_term();
+            bool leader_has_lease();
+            void leader_confirm_reads();
+            void leader_answer_reads();
+            void fail_pending_reads(std::optional<node_id_t> leader_hint);
 
-            void become_follower(term_t term);
-            void become_candidate();
+            void become_follower(term_t term, std::optional<node_id_t> leader_id = std::nullopt);
+            void start_election();
+            void become_pre_candidate();
+            void become_candidate(bool is_transfer = false);
+            void fill_vote_request(vote::VoteRequest& request);
+            bool is_log_up_to_date(const vote::VoteRequest& request);
             void become_leader();
 
             // MARK: - Server and client messages
 
             void receive_all_messages();
+            void send_durable_message(const message::Message& message);
+            void send_durable_messages();
             void handle_messages();
+            std::optional<uint32> successful_append_entries_response(const message::Message& message);
             void handle_vote_request(const message::Message& message);
             void handle_vote_response(const message::Message& message);
+            void handle_pre_vote_request(const message::Message& message);
+            void handle_pre_vote_response(const message::Message& message);
+            void handle_timeout_now(const message::Message& message);
             void handle_append_entries_request(const message::Message& message);
+            void set_conflict_hints(append_entry::AppendEntriesResponse& response, index_t prev_log_index);
             void handle_append_entries_response(const message::Message& message);
             void handle_command_entry_request(const message::Message& message);
+            void forward_command_entry_request(command_entry::CommandEntryRequest& request, node_id_t client_id);
+            void reject_command_entry_request(node_id_t client_id, std::optional<node_id_t> proxy_id, uint64 sequence);
+            void handle_command_entry_response(const message::Message& message);
+            void handle_read_request(const message::Message& message);
+            void forward_read_request(read_index::ReadRequest& request, node_id_t client_id);
+            void handle_read_response(const message::Message& message);
+            void send_read_response(node_id_t client_id, std::optional<node_id_t> proxy_id, read_index::ReadResponse response);
             void handle_search_leader_request(const message::Message& message);
+            void handle_install_snapshot_request(const message::Message& message);
+            void handle_install_snapshot_response(const message::Message& message);
             void handle_message(const message::Message& message);
 
             uint32 apply_new_log_entries(index_t begin_index, std::vector<log_entry::LogEntry>& new_log_entries);
             void check_new_commit_to_apply();
+            bool apply_session(const log_entry::LogEntry& entry);
+            void handle_applied_tasks();
+            void leader_complete_commands(const ApplyTask& task);
+            void answer_queried_reads(const ApplyTask& task);
+            void fail_pending_completions(std::optional<node_id_t> leader_hint);
+            void send_command_entry_response(node_id_t client_id, std::optional<node_id_t> proxy_id, command_entry::CommandEntryResponse response);
 
             // MARK: - Controller messages
 
-            void receive_controller_messages();
             void handle_controller_messages();
             void handle_crash_request();
             void handle_start_request();
             void handle_election_timeout_request(const message::Message& message);
             void handle_speed_request(const message::Message& message);
+            void handle_transfer_leader_request(const message::Message& message);
             void handle_controller_message(const message::Message& message);
 
             // MARK: - Persistent state on all servers
 
             // Id of the servers
             node_id_t id_;
+            // Raft group of the server (Multi-Raft), 0 with a single group
+            group_id_t group_id_;
             // Id of the controller that rules them all
             node_id_t controller_id_;
             // Array of server ids
@@ -106,24 +202,64 @@ namespace raft
             time_t heartbeat_timeout_;
             // Candidate Id that received vote in current term
             std::optional<node_id_t> voted_for_;
-            // Number of votes the candidate received
+            // Number of votes (or pre-votes) the candidate received
             uint32 votes_count_;
+            // Start elections with a pre-vote
+            bool pre_vote_;
             // Log entries; each entry contains command for state machine, and term when entry was received by leader (first index is 1)
             std::vector<log_entry::LogEntry> log_entries_;
-            // Queue of log entries to commit
-            std::queue<log_entry::LogEntry> log_entries_to_commit_;
+            struct Completion
+            {
+                // Client waiting for the commit of the log entry
+                node_id_t client_id;
+                // Client sequence number of the command
+                uint64 sequence;
+                // Follower that forwarded the command and relays the response, if any
+                std::optional<node_id_t> proxy_id;
+            };
+
+            // Leader: log entries waiting for their commit to answer the clients, by log index
+            std::map<index_t, Completion> pending_completions_;
             // Storage
             Storage storage_;
+            // Current term in the storage
+            term_t persisted_term_;
+            // Voted for in the storage
+            std::optional<node_id_t> persisted_voted_for_;
+            // Number of log entries in the storage
+            index_t persisted_log_size_;
+            // Last snapshot, the log entries start right after its last included index
+            std::optional<snapshot::Snapshot> snapshot_;
+            // Snapshot being received from the leader
+            snapshot::Snapshot pending_snapshot_;
+            // Number of applied log entries after which a snapshot is taken (0 = never)
+            index_t snapshot_threshold_;
+            // Maximum size of a snapshot chunk sent to a follower
+            uint64 snapshot_chunk_size_;
             // Speed to simulate a delay (for debug purpose only)
             speed::Speed speed_;
             // Queue of messages from other clients and servers
             std::queue<message::Message> messages_;
             // Queue of messages from the controller
             std::queue<message::Message> messages_controller_;
+            // Messages to send once the writes of the current iteration are durable
+            std::vector<message::Message> unsynced_messages_;
+            // Messages waiting for the durability of their storage sequence number
+            std::queue<std::pair<uint64, message::Message>> durable_messages_;
             // Clock used for simulating a delay with servers and clients communication, correlated with speed
             Clock delay_clock_;
             // Is running
             bool running_;
+            // Waits for the next message or timer between two iterations
+            Waiter waiter_;
+            // Maximum number of messages handled per iteration
+            uint32 message_budget_;
+            // Average time (ms) a message waits before being handled
+            double processing_latency_;
+            // Clock started when a message arrives in the empty queue
+            Clock message_wait_clock_;
+            // Forward the commands received as a follower to the leader
+            bool forward_commands_;
 
             // MARK: - Volatile state on all servers
 
@@ -131,13 +267,96 @@ namespace raft
             std::optional<index_t> commit_index_;
             // Index of highest log entry applied to state machine (initialized to 0, increase monotonically)
             std::optional<index_t> last_applied_commit_index_;
+            // Leader of the current term if known, given as a hint to the clients
+            std::optional<node_id_t> leader_id_;
 
             // MARK: - Volatile state on leaders
 
-            // For each server, index of the next log entry to send to that server (initialized to leader last log index + 1)
-            std::vector<index_t> next_index_;
-            // For each server, index of the highest log entry known to be replicated on server (initialized to 0, increase monotonically)
-            std::vector<std::optional<index_t>> match_index_;
+            // For each server, replication progress (next log entry to send, highest log entry known to be replicated, in-flight requests)
+            std::vector<Progress> progress_;
+            // Maximum number of AppendEntries requests in flight per follower
+            uint32 max_inflight_;
+            // Maximum size of the log entries in flight per follower
+            uint64 max_inflight_bytes_;
+            // True when a match index changed during the current batch of messages
+            bool match_index_changed_;
+            // Match indexes of all the servers (including the leader) to compute the commit index
+            QuorumTracker quorum_;
+            // Step down without contact with a majority during an election timeout
+            bool check_quorum_;
+            // Clock started at the last quorum check
+            Clock check_quorum_clock_;
+            // Server the leadership is being transferred to, the new commands wait meanwhile
+            std::optional<node_id_t> transfer_target_;
+            // Clock started with the transfer, aborted after an election timeout
+            Clock transfer_clock_;
+            // Hand the leadership over to a server that handles the messages faster
+            bool auto_balance_;
+            // Clock started at the last balancing decision
+            Clock balance_clock_;
+            // Multi-Raft: server that should lead the group, so that the leaders are spread across the ranks
+            std::optional<node_id_t> preferred_leader_;
+            struct PendingCommand
+            {
+                log_entry::LogEntry entry;
+                // Follower that forwarded the command, if any
+                std::optional<node_id_t> proxy_id;
+            };
+
+            // Commands received during the current batching window, not in the log yet
+            std::vector<PendingCommand> pending_commands_;
+            // Size of the pending commands
+            uint64 pending_commands_bytes_;
+            // Clock started by the first command of the batching window
+            Clock command_batch_clock_;
+            // Batching window: time (ms), number of commands and size after which the pending commands are appended
+            time_t command_batch_window_;
+            uint32 command_batch_size_;
+            uint64 command_batch_bytes_;
+            struct PendingRead
+            {
+                // Client waiting for the read
+                node_id_t client_id;
+                // Follower that forwarded the read and relays the response, if any
+                std::optional<node_id_t> proxy_id;
+                // Client sequence number of the read
+                uint64 sequence;
+                // Query passed to the state machine
+                std::string query;
+            };
+
+            // Reads waiting for the next leadership confirmation round
+            std::vector<PendingRead> reads_to_confirm_;
+            // Latest leadership confirmation round, sent with every AppendEntries request (increases monotonically)
+            uint64 read_round_;
+            // Reads of the round in flight, served once a quorum acknowledged it...
+            std::vector<PendingRead> confirming_reads_;
+            uint64 confirming_read_round_;
+            // ... at the commit index recorded when the round started
+            index_t confirming_read_index_;
+            // Confirmed reads waiting for their read index to be applied, by read index
+            std::queue<std::pair<index_t, PendingRead>> confirmed_reads_;
+            // Serve the reads from the leader lease, without a confirmation round
+            bool lease_reads_;
+            // Margin (ms) taken off the lease for the clock drift between the servers
+            time_t lease_drift_;
+            // Start time of the rounds younger than the lease, to date their acknowledgements
+            std::deque<std::pair<uint64, time_t>> read_round_times_;
+            // Monotonic clock dating the rounds (never reset)
+            Clock lease_clock_;
+
+            // MARK: - Applied state on all servers
+
+            // Last applied command of each client (duplicate suppression)
+            SessionTable sessions_;
+            // Runs the replicated state machine (inline or on the apply thread)
+            // last_applied_commit_index_ is the last entry handed to it, the results come back later
+            Applier applier_;
+            // Reads whose query was handed to the applier, in submission order
+            std::deque<PendingRead> querying_reads_;
+            // Snapshot (and its sessions) waiting for the state of the state machine
+            std::optional<snapshot::Snapshot> saving_snapshot_;
+            snapshot::AppliedState saving_state_;
         protected:
             rpc::RPC* rpc_ = nullptr;
     };
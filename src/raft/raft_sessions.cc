@@ -0,0 +1,90 @@
+#include "raft_sessions.hh"
+
+namespace raft
+{
+    SessionTable::SessionTable(uint32 max_sessions):
+        max_sessions_(max_sessions),
+        sessions_(),
+        lru_()
+    {}
+
+    bool SessionTable::is_applied(node_id_t client_id, uint64 sequence) const
+    {
+        auto session = sessions_.find(client_id);
+
+        if (session == sessions_.end())
+            return false;
+
+        return sequence < session->second.first_unacked_sequence || session->second.applied_sequences.count(sequence) > 0;
+    }
+
+    void SessionTable::apply(node_id_t client_id, uint64 sequence, uint64 first_unacked_sequence)
+    {
+        auto session = sessions_.find(client_id);
+
+        if (session != sessions_.end())
+            lru_.splice(lru_.begin(), lru_, session->second.lru_position);
+        else
+        {
+            if (sessions_.size() >= max_sessions_)
+            {
+                sessions_.erase(lru_.back());
+                lru_.pop_back();
+            }
+
+            lru_.push_front(client_id);
+            session = sessions_.emplace(client_id, Session { 0, {}, lru_.begin() }).first;
+        }
+
+        Session& current = session->second;
+
+        // A command sent before the latest one can carry an older first unacknowledged sequence
+        if (first_unacked_sequence > current.first_unacked_sequence)
+        {
+            current.first_unacked_sequence = first_unacked_sequence;
+            current.applied_sequences.erase(current.applied_sequences.begin(), current.applied_sequences.lower_bound(first_unacked_sequence));
+        }
+
+        if (sequence >= current.first_unacked_sequence)
+            current.applied_sequences.insert(sequence);
+    }
+
+    void SessionTable::save(snapshot::AppliedState& state) const
+    {
+        state.clear_sessions();
+
+        // Least recently used first, so that restoring them keeps the LRU order
+        for (auto client_id = lru_.rbegin(); client_id != lru_.rend(); ++client_id)
+        {
+            const Session& session = sessions_.at(*client_id);
+
+            snapshot::ClientSession* saved = state.add_sessions();
+            saved->set_client_id(*client_id);
+            saved->set_first_unacked_sequence(session.first_unacked_sequence);
+            for (uint64 sequence: session.applied_sequences)
+                saved->add_applied_sequences(sequence);
+        }
+    }
+
+    void SessionTable::restore(const snapshot::AppliedState& state)
+    {
+        sessions_.clear();
+        lru_.clear();
+
+        for (const auto& saved: state.sessions())
+        {
+            lru_.push_front(saved.client_id());
+
+            Session session { saved.first_unacked_sequence(), {}, lru_.begin() };
+            session.applied_sequences.insert(saved.applied_sequences().begin(), saved.applied_sequences().end());
+            sessions_.emplace(saved.client_id(), std::move(session));
+
+            // Saved with a bigger table
+            if (sessions_.size() > max_sessions_)
+            {
+                sessions_.erase(lru_.back());
+                lru_.pop_back();
+            }
+        }
+    }
+}
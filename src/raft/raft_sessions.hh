@@ -0,0 +1,48 @@
+#pragma once
+
+#include <list> // std::list
+#include <set> // std::set
+#include <unordered_map> // std::unordered_map
+
+#include "raft_types.hh"
+#include "types.hh"
+
+#include "proto/snapshot.pb.h"
+
+namespace raft
+{
+    // Applied command sequence numbers of each client, to apply each command only once
+    // A client keeps several commands in flight: they may reach the log out of order (leader change, follower proxy),
+    // so each session keeps the applied sequences from the first one its client has not seen committed
+    // Updated in log order on every server, so the evictions are the same everywhere
+    class SessionTable
+    {
+        public:
+            SessionTable(uint32 max_sessions);
+
+            // True if the command was already applied
+            bool is_applied(node_id_t client_id, uint64 sequence) const;
+            // Record an applied command, evicts the least recently used session when full
+            // The client saw every command before first_unacked_sequence committed: they are forgotten
+            void apply(node_id_t client_id, uint64 sequence, uint64 first_unacked_sequence);
+
+            // The sessions are part of the applied state saved in the snapshots
+            void save(snapshot::AppliedState& state) const;
+            void restore(const snapshot::AppliedState& state);
+        private:
+            struct Session
+            {
+                // Every command before it was applied
+                uint64 first_unacked_sequence;
+                // Applied commands from first_unacked_sequence
+                std::set<uint64> applied_sequences;
+                // Position in the LRU list
+                std::list<node_id_t>::iterator lru_position;
+            };
+
+            uint32 max_sessions_;
+            std::unordered_map<node_id_t, Session> sessions_;
+            // Client ids, most recently used first
+            std::list<node_id_t> lru_;
+    };
+}
@@ -0,0 +1,40 @@
+#include "raft_state_machine.hh"
+#include "raft_kv_state_machine.hh"
+
+namespace raft
+{
+    void LastCommandStateMachine::apply(const std::vector<std::string_view>& commands, std::vector<std::string>& results)
+    {
+        // No result
+        results.resize(results.size() + commands.size());
+
+        if (!commands.empty())
+            last_command_ = commands.back();
+    }
+
+    std::string LastCommandStateMachine::query(const std::string&) const
+    {
+        return last_command_;
+    }
+
+    std::string LastCommandStateMachine::save() const
+    {
+        return last_command_;
+    }
+
+    void LastCommandStateMachine::restore(const std::string& data)
+    {
+        last_command_ = data;
+    }
+
+    std::unique_ptr<StateMachine> make_state_machine(StateMachineType type)
+    {
+        switch (type)
+        {
+            case StateMachineType::KV:
+                return std::make_unique<KVStateMachine>();
+            default:
+                return std::make_unique<LastCommandStateMachine>();
+        }
+    }
+}
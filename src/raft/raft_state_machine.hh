@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string> // std::string
+#include <string_view> // std::string_view
+#include <vector> // std::vector
+#include <memory> // std::unique_ptr
+
+#include "types.hh"
+
+namespace raft
+{
+    // LAST_COMMAND: remembers the last applied command (the reads return it)
+    // KV: key-value store driven by PUT/GET/DEL/CAS commands
+    enum class StateMachineType { LAST_COMMAND, KV };
+
+    // Replicated state machine: receives the committed commands of the log, in order, once each
+    class StateMachine
+    {
+        public:
+            virtual ~StateMachine() {}
+
+            // Apply a batch of committed commands in log order, and append the result of each one to results
+            virtual void apply(const std::vector<std::string_view>& commands, std::vector<std::string>& results) = 0;
+            // Read-only query served by the reads (ReadIndex or lease)
+            virtual std::string query(const std::string& query) const = 0;
+            // The state is part of the applied state saved in the snapshots
+            virtual std::string save() const = 0;
+            virtual void restore(const std::string& data) = 0;
+    };
+
+    class LastCommandStateMachine: public StateMachine
+    {
+        public:
+            // Overriden methods
+            void apply(const std::vector<std::string_view>& commands, std::vector<std::string>& results) override;
+            std::string query(const std::string& query) const override;
+            std::string save() const override;
+            void restore(const std::string& data) override;
+        private:
+            std::string last_command_;
+    };
+
+    std::unique_ptr<StateMachine> make_state_machine(StateMachineType type);
+}
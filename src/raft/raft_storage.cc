@@ -2,30 +2,305 @@
 
 namespace raft
 {
-    Storage::Storage(node_id_t id):
-        path_("logs/server_" + std::to_string(id) + ".data")
+    // Size after which the log rolls to a new segment (4 MB)
+    static const uint64 segment_size = 4 * 1024 * 1024;
+    // Number of flushed batches the ring holds
+    static const uint64 ring_capacity = 1024;
+    // Time the writer polls for the next batch before sleeping
+    static const std::chrono::microseconds spin_duration(100);
+    // First and maximum sleep of the idle writer
+    static const std::chrono::microseconds min_park_duration(50);
+    static const std::chrono::microseconds max_park_duration(1000);
+
+    Storage::Storage(node_id_t id, group_id_t group_id, time_t sync_window):
+        directory_("logs/server_" + std::to_string(id) + (group_id == 0 ? "" : "_group_" + std::to_string(group_id))),
+        state_path_(directory_ + "/state.data"),
+        snapshot_path_(directory_ + "/snapshot.data"),
+        wal_(directory_, segment_size),
+        sync_window_(sync_window),
+        staged_operations_(),
+        flushed_sequence_(0),
+        batches_(ring_capacity),
+        backlog_(),
+        stopping_(false),
+        durable_sequence_(0),
+        durable_log_size_(wal_.size()),
+        writer_(&Storage::run_writer, this)
+    {}
+
+    Storage::~Storage()
     {
-        boost::filesystem::create_directory("logs");
+        flush();
+
+        // Every batch must reach the writer before it stops
+        while (!backlog_.empty())
+        {
+            std::this_thread::sleep_for(min_park_duration);
+            flush_backlog();
+        }
+
+        stopping_.store(true, std::memory_order_release);
+
+        writer_.join();
     }
 
     void Storage::save(const persistent_state::PersistentState& state)
     {
-        std::ofstream file(path_, std::ios_base::out | std::ios_base::binary);
-        state.SerializeToOstream(&file);
-        file.close();
+        persistent_state::PersistentState hard_state;
+        hard_state.set_current_term(state.current_term());
+        if (state.has_voted_for())
+            hard_state.mutable_voted_for()->set_value(state.voted_for().value());
+
+        staged_operations_.push_back(Operation { OperationType::SAVE, 0, hard_state.SerializeAsString() });
+    }
+
+    void Storage::append(const log_entry::LogEntry& entry)
+    {
+        staged_operations_.push_back(Operation { OperationType::APPEND, 0, entry.SerializeAsString() });
     }
 
+    void Storage::truncate(uint32 index)
+    {
+        staged_operations_.push_back(Operation { OperationType::TRUNCATE, index, "" });
+    }
+
+    void Storage::save_snapshot(const snapshot::Snapshot& snapshot)
+    {
+        staged_operations_.push_back(Operation { OperationType::SNAPSHOT, 0, snapshot.SerializeAsString() });
+    }
+
+    void Storage::compact(uint32 index)
+    {
+        staged_operations_.push_back(Operation { OperationType::COMPACT, index, "" });
+    }
+
+    void Storage::reset(uint32 index)
+    {
+        staged_operations_.push_back(Operation { OperationType::RESET, index, "" });
+    }
+
+    // Must be called before any write
     persistent_state::PersistentState Storage::get()
     {
-        std::ifstream file(path_, std::ios_base::in | std::ios_base::binary);
+        std::ifstream file(state_path_, std::ios_base::in | std::ios_base::binary);
         persistent_state::PersistentState state;
         state.ParseFromIstream(&file);
         file.close();
+
+        std::optional<snapshot::Snapshot> snapshot = get_snapshot();
+        index_t first_index = snapshot ? snapshot.value().last_included_index() + 1 : 0;
+
+        // The log ends before the snapshot (crash right after installing it)
+        if (wal_.size() < first_index)
+        {
+            wal_.reset(first_index);
+            durable_log_size_.store(first_index, std::memory_order_release);
+        }
+
+        // Replay the log entries from the segments, skipping the ones in the snapshot
+        wal_.replay([&state, first_index](uint32 index, const std::string& record) {
+            if (index >= first_index)
+                state.add_log_entries()->ParseFromString(record);
+        });
+
         return state;
     }
 
+    std::optional<snapshot::Snapshot> Storage::get_snapshot()
+    {
+        if (!boost::filesystem::exists(snapshot_path_))
+            return std::nullopt;
+
+        std::ifstream file(snapshot_path_, std::ios_base::in | std::ios_base::binary);
+        snapshot::Snapshot snapshot;
+        bool is_parsed = snapshot.ParseFromIstream(&file);
+        file.close();
+
+        return is_parsed ? std::make_optional(snapshot) : std::nullopt;
+    }
+
     bool Storage::has_data()
     {
-        return boost::filesystem::exists(path_) && boost::filesystem::file_size(path_) != 0;
+        return boost::filesystem::exists(state_path_) || boost::filesystem::exists(snapshot_path_) || durable_log_size() != 0;
+    }
+
+    uint64 Storage::flush()
+    {
+        flush_backlog();
+
+        // Nothing new: the previous batches already cover every write
+        if (staged_operations_.empty())
+            return flushed_sequence_;
+
+        ++flushed_sequence_;
+
+        Batch batch { flushed_sequence_, std::move(staged_operations_) };
+        if (!backlog_.empty() || !batches_.push(std::move(batch)))
+            backlog_.push_back(std::move(batch));
+
+        staged_operations_.clear();
+
+        return flushed_sequence_;
+    }
+
+    void Storage::flush_backlog()
+    {
+        while (!backlog_.empty() && batches_.push(std::move(backlog_.front())))
+            backlog_.pop_front();
+    }
+
+    void Storage::run_writer()
+    {
+        std::deque<Batch> batches;
+        Batch batch;
+
+        auto idle_start = std::chrono::steady_clock::now();
+        auto park_duration = min_park_duration;
+
+        while (true)
+        {
+            // Read the flag first: the batches pushed before it was set are popped below
+            bool is_stopping = stopping_.load(std::memory_order_acquire);
+
+            while (batches_.pop(batch))
+                batches.push_back(std::move(batch));
+
+            if (batches.empty())
+            {
+                if (is_stopping)
+                    break;
+
+                // Spin first, then sleep with a growing delay
+                if (std::chrono::steady_clock::now() - idle_start >= spin_duration)
+                {
+                    std::this_thread::sleep_for(park_duration);
+                    park_duration = std::min(park_duration * 2, max_park_duration);
+                }
+
+                continue;
+            }
+
+            // Give the server loop some time to flush other batches
+            if (sync_window_ > 0 && !is_stopping)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(sync_window_));
+
+                while (batches_.pop(batch))
+                    batches.push_back(std::move(batch));
+            }
+
+            // The durable watermarks must never cover a write that failed: stop the node
+            try
+            {
+                write_batches(batches);
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "Server storage failed: " << e.what() << std::endl;
+                std::abort();
+            }
+
+            batches.clear();
+
+            idle_start = std::chrono::steady_clock::now();
+            park_duration = min_park_duration;
+        }
+    }
+
+    // Write every batch then make them durable with a single sync
+    void Storage::write_batches(std::deque<Batch>& batches)
+    {
+        const std::string* state = nullptr;
+        // Log prefix to remove once the snapshot is durable
+        std::optional<uint32> compact_index = std::nullopt;
+
+        for (const auto& batch: batches)
+        {
+            for (const auto& operation: batch.operations)
+            {
+                switch (operation.type)
+                {
+                    case OperationType::SAVE:
+                        // Only the last hard state matters
+                        state = &operation.data;
+                        break;
+                    case OperationType::APPEND:
+                        wal_.append(operation.data);
+                        break;
+                    case OperationType::TRUNCATE:
+                        wal_.truncate(operation.index);
+                        break;
+                    case OperationType::SNAPSHOT:
+                        // Written right away: later operations of the batch may depend on it
+                        write_file(snapshot_path_, operation.data);
+                        break;
+                    case OperationType::COMPACT:
+                        compact_index = std::make_optional(operation.index);
+                        break;
+                    case OperationType::RESET:
+                        wal_.reset(operation.index);
+                        compact_index = std::nullopt;
+                        break;
+                }
+            }
+        }
+
+        wal_.sync();
+
+        if (state)
+            write_file(state_path_, *state);
+
+        if (compact_index)
+            wal_.compact(compact_index.value());
+
+        durable_log_size_.store(wal_.size(), std::memory_order_release);
+        durable_sequence_.store(batches.back().sequence, std::memory_order_release);
+    }
+
+    // Write in a temporary file then rename it to never leave a half written file
+    void Storage::write_file(const std::string& path, const std::string& data)
+    {
+        std::string tmp_path = path + ".tmp";
+
+        int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+            throw std::runtime_error("Storage: cannot open " + tmp_path);
+
+        for (uint64 offset = 0; offset < data.size(); )
+        {
+            ssize_t count = ::write(fd, data.data() + offset, data.size() - offset);
+
+            if (count < 0)
+            {
+                // Interrupted by a signal before writing anything
+                if (errno == EINTR)
+                    continue;
+
+                ::close(fd);
+                throw std::runtime_error("Storage: cannot write " + tmp_path + ": " + std::strerror(errno));
+            }
+
+            offset += count;
+        }
+
+        if (::fdatasync(fd) < 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Storage: cannot sync " + tmp_path + ": " + std::strerror(errno));
+        }
+        ::close(fd);
+
+        boost::filesystem::rename(tmp_path, path);
+
+        // Make the rename durable
+        int directory_fd = ::open(directory_.c_str(), O_RDONLY | O_DIRECTORY);
+        if (directory_fd < 0)
+            throw std::runtime_error("Storage: cannot open " + directory_ + ": " + std::strerror(errno));
+
+        int result = ::fsync(directory_fd);
+        ::close(directory_fd);
+
+        if (result < 0)
+            throw std::runtime_error("Storage: cannot sync " + directory_ + ": " + std::strerror(errno));
     }
 }
@@ -2,24 +2,101 @@
 
 #include <iostream>
 #include <fstream> // std::ifstream std::fstream
-#include <boost/filesystem.hpp> // boost::filesystem::create_directory
+#include <thread> // std::thread std::this_thread::sleep_for
+#include <atomic> // std::atomic
+#include <chrono> // std::chrono::milliseconds
+#include <deque> // std::deque
+#include <algorithm> // std::min
+#include <cstdlib> // std::abort
+#include <cstring> // std::strerror
+#include <cerrno> // errno EINTR
+#include <boost/filesystem.hpp> // boost::filesystem::rename
 
 #include "storage.hh"
+#include "wal.hh"
 #include "raft_types.hh"
+#include "spsc_ring.hh"
 
+#include "proto/log_entry.pb.h"
 #include "proto/persistent_state.pb.h"
+#include "proto/snapshot.pb.h"
 
 namespace raft
 {
+    // Writes are staged by the server loop then made durable by a writer thread (persistence stage):
+    // every batch flushed while the writer is busy (or within the sync window) shares a single fdatasync
+    // The batches go to the writer over a lock-free SPSC ring, a flush never waits for a sync in progress
+    // A failed write or sync aborts the process: the writes it covered may be lost and must never be acknowledged
     class Storage: public storage::Storage
     {
         public:
-            Storage(node_id_t id);
+            // Each group of a server has its own directory (Multi-Raft)
+            Storage(node_id_t id, group_id_t group_id, time_t sync_window);
+            ~Storage();
             // Overriden methods
             void save(const persistent_state::PersistentState& state) override;
+            void append(const log_entry::LogEntry& entry) override;
+            void truncate(uint32 index) override;
+            void save_snapshot(const snapshot::Snapshot& snapshot) override;
+            void compact(uint32 index) override;
+            void reset(uint32 index) override;
             persistent_state::PersistentState get() override;
+            std::optional<snapshot::Snapshot> get_snapshot() override;
             bool has_data() override;
+            uint64 flush() override;
+            uint64 durable_sequence() override { return durable_sequence_.load(std::memory_order_acquire); }
+
+            // Number of log entries known to be durable
+            index_t durable_log_size() { return durable_log_size_.load(std::memory_order_acquire); }
         private:
-            std::string path_;
+            enum class OperationType { SAVE, APPEND, TRUNCATE, SNAPSHOT, COMPACT, RESET };
+
+            struct Operation
+            {
+                OperationType type;
+                // Index of the truncation, compaction or reset
+                uint32 index;
+                // Serialized hard state, log entry or snapshot
+                std::string data;
+            };
+
+            struct Batch
+            {
+                uint64 sequence;
+                std::vector<Operation> operations;
+            };
+
+            void run_writer();
+            // Push the batches waiting for room in the ring
+            void flush_backlog();
+            void write_batches(std::deque<Batch>& batches);
+            void write_file(const std::string& path, const std::string& data);
+
+            // Directory of the server (logs/server_N)
+            std::string directory_;
+            // Path of the hard state file (current term and voted for)
+            std::string state_path_;
+            // Path of the snapshot file
+            std::string snapshot_path_;
+            // Log entries
+            storage::WAL wal_;
+            // Time to wait for other batches before syncing (ms)
+            time_t sync_window_;
+            // Operations staged since the last flush (server loop only)
+            std::vector<Operation> staged_operations_;
+            // Sequence number of the last flushed batch (server loop only)
+            uint64 flushed_sequence_;
+            // Server loop => writer
+            utils::SPSCRing<Batch> batches_;
+            // Batches flushed while the ring was full (server loop only)
+            std::deque<Batch> backlog_;
+            // True when the writer has to stop (after writing the remaining batches)
+            std::atomic<bool> stopping_;
+            // Sequence number of the last durable batch
+            std::atomic<uint64> durable_sequence_;
+            // Number of durable log entries
+            std::atomic<index_t> durable_log_size_;
+            // Thread syncing the batches to the disk
+            std::thread writer_;
     };
 }
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <optional> // std::optional
+
 #include "types.hh"
 
 // Raft types
 namespace raft
 {
     using node_id_t = uint32;
+    using group_id_t = uint32;
     using index_t = uint32;
     using term_t = uint32;
     using time_t = sint32;
@@ -0,0 +1,47 @@
+#include "raft_waiter.hh"
+
+namespace raft
+{
+    // Time spent polling before parking (a reply usually arrives within it under load)
+    static const std::chrono::microseconds spin_duration(100);
+    // First and maximum sleep while parked (bounds the wake up latency)
+    static const std::chrono::microseconds min_park_duration(50);
+    static const std::chrono::microseconds max_park_duration(1000);
+
+    Waiter::Waiter(WaitMode mode):
+        mode_(mode)
+    {}
+
+    void Waiter::wait(rpc::RPC* rpc, std::optional<time_t> timeout, const std::function<bool()>& ready)
+    {
+        if (mode_ == WaitMode::SPIN || (timeout && timeout.value() <= 0))
+            return;
+
+        auto start = std::chrono::steady_clock::now();
+        std::optional<std::chrono::steady_clock::time_point> deadline = std::nullopt;
+        if (timeout)
+            deadline = std::make_optional(start + std::chrono::milliseconds(timeout.value()));
+
+        auto park_duration = min_park_duration;
+
+        while (!rpc->has_message() && !ready())
+        {
+            auto now = std::chrono::steady_clock::now();
+
+            if (deadline && now >= deadline.value())
+                return;
+
+            // Spin first
+            if (now - start < spin_duration)
+                continue;
+
+            // Then park, without sleeping past the deadline
+            auto sleep_duration = park_duration;
+            if (deadline)
+                sleep_duration = std::min(sleep_duration, std::chrono::duration_cast<std::chrono::microseconds>(deadline.value() - now));
+
+            std::this_thread::sleep_for(sleep_duration);
+            park_duration = std::min(park_duration * 2, max_park_duration);
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <optional> // std::optional
+#include <functional> // std::function
+#include <chrono> // std::chrono
+#include <thread> // std::this_thread::sleep_for
+#include <algorithm> // std::min
+
+#include "rpc.hh"
+#include "types.hh"
+
+namespace raft
+{
+    // SPIN: the loop never waits (lowest latency, one core per rank)
+    // ADAPTIVE: the loop spins a short time for the next event, then parks with growing sleeps
+    enum class WaitMode { SPIN, ADAPTIVE };
+
+    // Waits for the next event of a node loop: a message, a deadline or a custom condition
+    class Waiter
+    {
+        public:
+            Waiter(WaitMode mode);
+
+            // Return when a message is pending, when ready() is true or after timeout (ms, none = no deadline)
+            void wait(rpc::RPC* rpc, std::optional<time_t> timeout, const std::function<bool()>& ready);
+        private:
+            WaitMode mode_;
+    };
+}
@@ -0,0 +1,53 @@
+#include "group_rpc.hh"
+
+namespace rpc
+{
+    std::string command_key(const std::string& command)
+    {
+        std::string key = command;
+
+        std::string::size_type begin = command.find(' ');
+        if (begin != std::string::npos)
+        {
+            std::string::size_type end = command.find(' ', begin + 1);
+            key = command.substr(begin + 1, end == std::string::npos ? std::string::npos : end - begin - 1);
+        }
+
+        return key;
+    }
+
+    raft::group_id_t key_group(const std::string& key, uint32 nb_groups)
+    {
+        return std::hash<std::string>{}(key) % nb_groups;
+    }
+
+    GroupRPC::GroupRPC(raft::group_id_t group_id):
+        group_id_(group_id),
+        transport_(nullptr),
+        inbox_()
+    {}
+
+    void GroupRPC::deliver(message::Message&& message)
+    {
+        inbox_.push_back(std::move(message));
+    }
+
+    void GroupRPC::send_message(const message::Message& message)
+    {
+        message::Message group_message = message;
+        group_message.set_group_id(group_id_);
+        transport_->send_message(group_message);
+    }
+
+    std::vector<message::Message> GroupRPC::receive_messages()
+    {
+        std::vector<message::Message> messages;
+        messages.swap(inbox_);
+        return messages;
+    }
+
+    bool GroupRPC::has_message()
+    {
+        return !inbox_.empty();
+    }
+}
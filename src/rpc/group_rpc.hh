@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector> // std::vector
+#include <string> // std::string
+#include <functional> // std::hash
+
+#include "rpc.hh"
+#include "raft_types.hh"
+
+namespace rpc
+{
+    // The key of a command "OP KEY ..." is its second word, a command without space is its own key
+    std::string command_key(const std::string& command);
+    // Group a key belongs to, the same for the clients and the servers
+    raft::group_id_t key_group(const std::string& key, uint32 nb_groups);
+
+    // Multi-Raft: the RPC seen by the node of a single group
+    // The messages are tagged with the group on the shared transport, the host of the rank
+    // receives them once and delivers them to the inbox of their group
+    class GroupRPC: public RPC
+    {
+        public:
+            GroupRPC(raft::group_id_t group_id);
+            void set_transport(RPC* transport) { transport_ = transport; }
+            // Called by the host for each message of the group
+            void deliver(message::Message&& message);
+
+            // Overriden methods
+            void send_message(const message::Message& message) override;
+            std::vector<message::Message> receive_messages() override;
+            bool has_message() override;
+            // The host batches the messages of every group of the rank together
+            void begin_batch() override {}
+            void flush_batch() override {}
+        private:
+            raft::group_id_t group_id_;
+            // Shared by the groups of the rank
+            RPC* transport_;
+            // Messages delivered by the host, not received by the node yet
+            std::vector<message::Message> inbox_;
+    };
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector> // std::vector
+
 #include "raft_types.hh"
 
 #include "proto/message.pb.h"
@@ -12,6 +14,12 @@ namespace rpc
             virtual ~RPC() {}
 
             virtual void send_message(const message::Message& message) = 0;
-            virtual std::optional<message::Message> receive_message(raft::node_id_t id) = 0;
+            // Until flush_batch, the messages sent to the same destination are packed together
+            virtual void begin_batch() = 0;
+            virtual void flush_batch() = 0;
+            // Every pending message from any node, with its source id set to the sender
+            virtual std::vector<message::Message> receive_messages() = 0;
+            // True when a message is waiting to be received
+            virtual bool has_message() = 0;
     };
 }
@@ -1,7 +1,13 @@
 #pragma once
 
 // #include <google/protobuf/message.h> // google::protobuf::MessageLite
+#include <optional> // std::optional
+
+#include "types.hh"
+
+#include "proto/log_entry.pb.h"
 #include "proto/persistent_state.pb.h"
+#include "proto/snapshot.pb.h"
 
 namespace storage
 {
@@ -12,8 +18,28 @@ namespace storage
 
             // TODO: @sebmenozzi I would like to use google::protobuf::MessageLite instead
             // but I can't use a abstract class in a interface, should probably use generics!
+
+            // Save the hard state (current term and voted for), log entries are ignored
             virtual void save(const persistent_state::PersistentState& state) = 0;
+            // Append a log entry at the end of the log
+            virtual void append(const log_entry::LogEntry& entry) = 0;
+            // Remove every log entry from index (included) to the end of the log
+            virtual void truncate(uint32 index) = 0;
+            // Save a snapshot of the applied state
+            virtual void save_snapshot(const snapshot::Snapshot& snapshot) = 0;
+            // Remove the log entries before index (already in the snapshot)
+            virtual void compact(uint32 index) = 0;
+            // Remove every log entry, the next appended entry will have the given index
+            virtual void reset(uint32 index) = 0;
+            // Retrieve the hard state and the log entries after the snapshot
             virtual persistent_state::PersistentState get() = 0;
+            // Retrieve the last snapshot if any
+            virtual std::optional<snapshot::Snapshot> get_snapshot() = 0;
             virtual bool has_data() = 0;
+
+            // Hand the pending writes to the disk, returns the sequence number that covers them
+            virtual uint64 flush() = 0;
+            // Sequence number of the last writes known to be durable
+            virtual uint64 durable_sequence() = 0;
     };
 }
@@ -0,0 +1,299 @@
+#include "wal.hh"
+
+namespace storage
+{
+    // Size of a record header: [size][crc32]
+    static const uint64 header_size = 2 * sizeof(std::uint32_t);
+
+    static std::uint32_t checksum(const char* data, uint64 size)
+    {
+        boost::crc_32_type crc;
+        crc.process_bytes(data, size);
+        return crc.checksum();
+    }
+
+    static std::string read_file(const std::string& path)
+    {
+        std::string content;
+        int fd = ::open(path.c_str(), O_RDONLY);
+
+        if (fd < 0)
+            return content;
+
+        char buffer[64 * 1024];
+        ssize_t count;
+        while ((count = ::read(fd, buffer, sizeof(buffer))) > 0)
+            content.append(buffer, count);
+
+        ::close(fd);
+        return content;
+    }
+
+    static void write_all(int fd, const char* data, uint64 size)
+    {
+        while (size > 0)
+        {
+            ssize_t count = ::write(fd, data, size);
+
+            if (count < 0)
+            {
+                // Interrupted by a signal before writing anything
+                if (errno == EINTR)
+                    continue;
+
+                throw std::runtime_error(std::string("WAL: write failed: ") + std::strerror(errno));
+            }
+
+            data += count;
+            size -= count;
+        }
+    }
+
+    // A failed sync may have dropped the dirty pages: the records can no longer be assumed durable
+    static void sync_file(int fd)
+    {
+        if (::fdatasync(fd) < 0)
+            throw std::runtime_error(std::string("WAL: fdatasync failed: ") + std::strerror(errno));
+    }
+
+    WAL::WAL(const std::string& directory, uint64 segment_size):
+        directory_(directory),
+        segment_size_(segment_size),
+        segments_(),
+        base_index_(0),
+        fd_(-1),
+        directory_dirty_(false)
+    {
+        boost::filesystem::create_directories(directory_);
+
+        // Retrieve the segments sorted by their first index
+        std::vector<uint32> first_indexes;
+        for (const auto& file: boost::filesystem::directory_iterator(directory_))
+        {
+            std::string name = file.path().filename().string();
+
+            if (name.rfind("segment_", 0) == 0 && file.path().extension() == ".wal")
+                first_indexes.push_back(std::stoul(name.substr(8, name.size() - 12)));
+        }
+        std::sort(first_indexes.begin(), first_indexes.end());
+
+        // Compute the record offsets and stop at the first torn or missing record
+        bool is_torn = false;
+
+        for (const auto& first_index: first_indexes)
+        {
+            std::string path = segment_path(first_index);
+
+            if (is_torn || (!segments_.empty() && first_index != size()))
+            {
+                is_torn = true;
+                boost::filesystem::remove(path);
+                continue;
+            }
+
+            std::string content = read_file(path);
+
+            Segment segment { first_index, {}, 0 };
+
+            while (segment.size + header_size <= content.size())
+            {
+                std::uint32_t record_size;
+                std::uint32_t record_crc;
+                std::memcpy(&record_size, content.data() + segment.size, sizeof(record_size));
+                std::memcpy(&record_crc, content.data() + segment.size + sizeof(record_size), sizeof(record_crc));
+
+                uint64 end = segment.size + header_size + record_size;
+
+                if (end > content.size() || checksum(content.data() + segment.size + header_size, record_size) != record_crc)
+                    break;
+
+                segment.offsets.push_back(segment.size);
+                segment.size = end;
+            }
+
+            // Partially written record (crash in the middle of an append)
+            if (segment.size != content.size())
+            {
+                is_torn = true;
+                boost::filesystem::resize_file(path, segment.size);
+            }
+
+            segments_.push_back(segment);
+        }
+
+        open_last_segment();
+    }
+
+    WAL::~WAL()
+    {
+        close_segment();
+    }
+
+    void WAL::replay(const std::function<void(uint32 index, const std::string& record)>& callback)
+    {
+        for (const auto& segment: segments_)
+        {
+            std::string content = read_file(segment_path(segment.first_index));
+
+            for (uint32 i = 0; i < segment.offsets.size(); ++i)
+            {
+                std::uint32_t record_size;
+                std::memcpy(&record_size, content.data() + segment.offsets.at(i), sizeof(record_size));
+
+                callback(segment.first_index + i, content.substr(segment.offsets.at(i) + header_size, record_size));
+            }
+        }
+    }
+
+    void WAL::append(const std::string& record)
+    {
+        if (segments_.empty() || segments_.back().size >= segment_size_)
+            roll();
+
+        std::uint32_t record_size = record.size();
+        std::uint32_t record_crc = checksum(record.data(), record.size());
+
+        // Build the whole frame to write it with a single system call
+        std::string frame;
+        frame.reserve(header_size + record.size());
+        frame.append(reinterpret_cast<const char*>(&record_size), sizeof(record_size));
+        frame.append(reinterpret_cast<const char*>(&record_crc), sizeof(record_crc));
+        frame.append(record);
+
+        write_all(fd_, frame.data(), frame.size());
+
+        Segment& segment = segments_.back();
+        segment.offsets.push_back(segment.size);
+        segment.size += frame.size();
+    }
+
+    void WAL::truncate(uint32 index)
+    {
+        if (index >= size())
+            return;
+
+        // Remove the segments that only contain truncated records
+        while (!segments_.empty() && segments_.back().first_index >= index)
+        {
+            close_segment();
+            boost::filesystem::remove(segment_path(segments_.back().first_index));
+            segments_.pop_back();
+            directory_dirty_ = true;
+        }
+
+        if (segments_.empty())
+            base_index_ = index;
+
+        // Cut the last segment at the first truncated record
+        if (!segments_.empty())
+        {
+            Segment& segment = segments_.back();
+            uint32 count = index - segment.first_index;
+
+            if (count < segment.offsets.size())
+            {
+                segment.size = segment.offsets.at(count);
+                segment.offsets.resize(count);
+
+                close_segment();
+                boost::filesystem::resize_file(segment_path(segment.first_index), segment.size);
+            }
+        }
+
+        open_last_segment();
+    }
+
+    void WAL::compact(uint32 index)
+    {
+        // The active segment is always kept
+        while (segments_.size() > 1 && segments_.at(1).first_index <= index)
+        {
+            boost::filesystem::remove(segment_path(segments_.front().first_index));
+            segments_.erase(segments_.begin());
+            directory_dirty_ = true;
+        }
+    }
+
+    void WAL::reset(uint32 index)
+    {
+        close_segment();
+
+        for (const auto& segment: segments_)
+            boost::filesystem::remove(segment_path(segment.first_index));
+
+        segments_.clear();
+        base_index_ = index;
+        directory_dirty_ = true;
+    }
+
+    void WAL::sync()
+    {
+        if (fd_ >= 0)
+            sync_file(fd_);
+
+        // New or removed segments are only durable once the directory is synced
+        if (directory_dirty_)
+        {
+            int fd = ::open(directory_.c_str(), O_RDONLY | O_DIRECTORY);
+
+            if (fd < 0)
+                throw std::runtime_error(std::string("WAL: cannot open the directory: ") + std::strerror(errno));
+
+            int result = ::fsync(fd);
+            ::close(fd);
+
+            if (result < 0)
+                throw std::runtime_error(std::string("WAL: directory fsync failed: ") + std::strerror(errno));
+
+            directory_dirty_ = false;
+        }
+    }
+
+    uint32 WAL::size() const
+    {
+        if (segments_.empty())
+            return base_index_;
+
+        return segments_.back().first_index + segments_.back().offsets.size();
+    }
+
+    std::string WAL::segment_path(uint32 first_index) const
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "segment_%010lu.wal", first_index);
+        return directory_ + "/" + name;
+    }
+
+    void WAL::open_last_segment()
+    {
+        if (fd_ >= 0 || segments_.empty())
+            return;
+
+        fd_ = ::open(segment_path(segments_.back().first_index).c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+
+        if (fd_ < 0)
+            throw std::runtime_error("WAL: cannot open segment");
+    }
+
+    void WAL::close_segment()
+    {
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    // Start a new segment for the next records
+    void WAL::roll()
+    {
+        // The previous segment will not be synced anymore
+        if (fd_ >= 0)
+            sync_file(fd_);
+
+        close_segment();
+        segments_.push_back(Segment { size(), {}, 0 });
+        open_last_segment();
+        directory_dirty_ = true;
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <string> // std::string
+#include <cstring> // std::memcpy std::strerror
+#include <cerrno> // errno EINTR
+#include <cstdio> // std::snprintf
+#include <stdexcept> // std::runtime_error
+#include <algorithm> // std::sort
+#include <vector> // std::vector
+#include <functional> // std::function
+#include <cstdint> // std::uint32_t
+#include <fcntl.h> // open
+#include <unistd.h> // write close fdatasync fsync
+#include <boost/filesystem.hpp> // boost::filesystem::directory_iterator
+#include <boost/crc.hpp> // boost::crc_32_type
+
+#include "types.hh"
+
+namespace storage
+{
+    // Append-only write-ahead log split in segment files (Raft log on disk)
+    // Each segment is named after the index of its first record and contains
+    // records framed as [size (4 bytes)][crc32 (4 bytes)][payload]
+    class WAL
+    {
+        public:
+            WAL(const std::string& directory, uint64 segment_size);
+            ~WAL();
+
+            // Read every valid record of the segments in order, drop a torn tail if any
+            void replay(const std::function<void(uint32 index, const std::string& record)>& callback);
+            // Append a record at the end of the log (index = size())
+            void append(const std::string& record);
+            // Remove every record from index (included) to the end of the log
+            void truncate(uint32 index);
+            // Remove the segments that only contain records before index (log compaction)
+            void compact(uint32 index);
+            // Remove every record, the next appended record will have the given index
+            void reset(uint32 index);
+            // Make the appended and truncated records durable (fdatasync), throws if the sync failed
+            void sync();
+
+            bool empty() const { return size() == 0; }
+            // Index of the next record to append
+            uint32 size() const;
+        private:
+            struct Segment
+            {
+                // Index of the first record in the segment
+                uint32 first_index;
+                // Offset of each record in the segment file
+                std::vector<uint64> offsets;
+                // Size of the segment file
+                uint64 size;
+            };
+
+            std::string segment_path(uint32 first_index) const;
+            void open_last_segment();
+            void close_segment();
+            void roll();
+
+            // Directory containing the segments
+            std::string directory_;
+            // Size after which a new segment is created
+            uint64 segment_size_;
+            // Segments sorted by first index, the last one is the active one
+            std::vector<Segment> segments_;
+            // Index of the next record when there is no segment
+            uint32 base_index_;
+            // File descriptor of the active segment
+            int fd_;
+            // True when segments were created or removed since the last sync
+            bool directory_dirty_;
+    };
+}
@@ -8,12 +8,35 @@ namespace utils
         {
             int nb_servers = 1; // Default number of servers
             int nb_clients = 1; // Default number of clients
+            raft::Config config; // Default tunables
 
             po::options_description desc("Allowed Options");
             desc.add_options()
                 ("help, h", "Show Usage")
                 ("servers, s", po::value<int>(), "Setup the number of servers")
                 ("clients, c", po::value<int>(), "Setup the number of clients")
+                ("sync-window", po::value<int>(), "Time window (ms) to group log writes in a single fdatasync")
+                ("snapshot-threshold", po::value<int>(), "Number of applied log entries after which a snapshot is taken (0 = never)")
+                ("snapshot-chunk-size", po::value<int>(), "Maximum size (bytes) of a snapshot chunk sent to a follower")
+                ("max-inflight", po::value<int>(), "Maximum number of AppendEntries requests in flight per follower")
+                ("max-inflight-bytes", po::value<int>(), "Maximum size (bytes) of the log entries in flight per follower")
+                ("batch-window", po::value<int>(), "Time window (ms) during which the leader gathers client commands before appending them")
+                ("batch-size", po::value<int>(), "Maximum number of client commands in a batching window")
+                ("batch-bytes", po::value<int>(), "Maximum size (bytes) of the client commands in a batching window")
+                ("client-window", po::value<int>(), "Maximum number of commands a client keeps in flight")
+                ("forward", "Followers forward the client commands to the leader, each client sticks to a single server")
+                ("max-sessions", po::value<int>(), "Maximum number of client sessions kept to suppress duplicate commands")
+                ("message-budget", po::value<int>(), "Maximum number of messages handled per loop iteration")
+                ("pre-vote", "Start the elections with a pre-vote that does not increase the term")
+                ("check-quorum", "The leader steps down when it loses contact with a majority")
+                ("auto-balance", "The leadership moves to the server that handles the messages the fastest")
+                ("lease-reads", "The leader serves the reads locally while it holds a lease from a majority")
+                ("lease-drift", po::value<int>(), "Margin (ms) taken off the leader lease for the clock drift between servers")
+                ("state-machine", po::value<std::string>(), "State machine the committed commands are applied to: last or kv")
+                ("apply-thread", "Apply the committed commands on a dedicated thread")
+                ("io-thread", "Receive, deserialize and send the messages on a dedicated thread")
+                ("groups", po::value<int>(), "Number of independent Raft groups hosted by each rank")
+                ("wait-mode", po::value<std::string>(), "How the nodes wait for messages and timers: spin or adaptive (spin then park)")
             ;
 
             po::variables_map vm;
@@ -51,8 +74,248 @@ namespace utils
                 }
             }
 
+            // Sync window option: --sync-window
+            if (vm.count("sync-window"))
+            {
+                config.sync_window = vm["sync-window"].as<int>();
+
+                if (config.sync_window < 0)
+                {
+                    std::cerr << "Invalid sync window: " << config.sync_window << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+
+            // Snapshot threshold option: --snapshot-threshold
+            if (vm.count("snapshot-threshold"))
+            {
+                int snapshot_threshold = vm["snapshot-threshold"].as<int>();
+
+                if (snapshot_threshold < 0)
+                {
+                    std::cerr << "Invalid snapshot threshold: " << snapshot_threshold << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.snapshot_threshold = snapshot_threshold;
+            }
+
+            // Snapshot chunk size option: --snapshot-chunk-size
+            if (vm.count("snapshot-chunk-size"))
+            {
+                int snapshot_chunk_size = vm["snapshot-chunk-size"].as<int>();
+
+                if (snapshot_chunk_size <= 0)
+                {
+                    std::cerr << "Invalid snapshot chunk size: " << snapshot_chunk_size << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.snapshot_chunk_size = snapshot_chunk_size;
+            }
+
+            // Max inflight option: --max-inflight
+            if (vm.count("max-inflight"))
+            {
+                int max_inflight = vm["max-inflight"].as<int>();
+
+                if (max_inflight <= 0)
+                {
+                    std::cerr << "Invalid max inflight: " << max_inflight << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.max_inflight = max_inflight;
+            }
+
+            // Max inflight bytes option: --max-inflight-bytes
+            if (vm.count("max-inflight-bytes"))
+            {
+                int max_inflight_bytes = vm["max-inflight-bytes"].as<int>();
+
+                if (max_inflight_bytes <= 0)
+                {
+                    std::cerr << "Invalid max inflight bytes: " << max_inflight_bytes << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.max_inflight_bytes = max_inflight_bytes;
+            }
+
+            // Batch window option: --batch-window
+            if (vm.count("batch-window"))
+            {
+                int batch_window = vm["batch-window"].as<int>();
+
+                if (batch_window < 0)
+                {
+                    std::cerr << "Invalid batch window: " << batch_window << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.command_batch_window = batch_window;
+            }
+
+            // Batch size option: --batch-size
+            if (vm.count("batch-size"))
+            {
+                int batch_size = vm["batch-size"].as<int>();
+
+                if (batch_size <= 0)
+                {
+                    std::cerr << "Invalid batch size: " << batch_size << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.command_batch_size = batch_size;
+            }
+
+            // Batch bytes option: --batch-bytes
+            if (vm.count("batch-bytes"))
+            {
+                int batch_bytes = vm["batch-bytes"].as<int>();
+
+                if (batch_bytes <= 0)
+                {
+                    std::cerr << "Invalid batch bytes: " << batch_bytes << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.command_batch_bytes = batch_bytes;
+            }
+
+            // Client window option: --client-window
+            if (vm.count("client-window"))
+            {
+                int client_window = vm["client-window"].as<int>();
+
+                if (client_window <= 0)
+                {
+                    std::cerr << "Invalid client window: " << client_window << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.client_max_inflight = client_window;
+            }
+
+            // Forward option: --forward
+            if (vm.count("forward"))
+                config.forward_commands = true;
+
+            // Max sessions option: --max-sessions
+            if (vm.count("max-sessions"))
+            {
+                int max_sessions = vm["max-sessions"].as<int>();
+
+                if (max_sessions <= 0)
+                {
+                    std::cerr << "Invalid max sessions: " << max_sessions << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.max_sessions = max_sessions;
+            }
+
+            // Message budget option: --message-budget
+            if (vm.count("message-budget"))
+            {
+                int message_budget = vm["message-budget"].as<int>();
+
+                if (message_budget <= 0)
+                {
+                    std::cerr << "Invalid message budget: " << message_budget << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.message_budget = message_budget;
+            }
+
+            // Pre-vote option: --pre-vote
+            if (vm.count("pre-vote"))
+                config.pre_vote = true;
+
+            // Check quorum option: --check-quorum
+            if (vm.count("check-quorum"))
+                config.check_quorum = true;
+
+            // Auto balance option: --auto-balance
+            if (vm.count("auto-balance"))
+                config.auto_balance = true;
+
+            // Lease reads option: --lease-reads
+            if (vm.count("lease-reads"))
+                config.lease_reads = true;
+
+            // Lease drift option: --lease-drift
+            if (vm.count("lease-drift"))
+            {
+                int lease_drift = vm["lease-drift"].as<int>();
+
+                if (lease_drift < 0)
+                {
+                    std::cerr << "Invalid lease drift: " << lease_drift << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.lease_drift = lease_drift;
+            }
+
+            // State machine option: --state-machine
+            if (vm.count("state-machine"))
+            {
+                std::string state_machine = vm["state-machine"].as<std::string>();
+
+                if (state_machine == "last")
+                    config.state_machine = raft::StateMachineType::LAST_COMMAND;
+                else if (state_machine == "kv")
+                    config.state_machine = raft::StateMachineType::KV;
+                else
+                {
+                    std::cerr << "Invalid state machine: " << state_machine << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+
+            // Apply thread option: --apply-thread
+            if (vm.count("apply-thread"))
+                config.apply_thread = true;
+
+            // I/O thread option: --io-thread
+            if (vm.count("io-thread"))
+                config.io_thread = true;
+
+            // Groups option: --groups
+            if (vm.count("groups"))
+            {
+                int groups = vm["groups"].as<int>();
+
+                if (groups <= 0)
+                {
+                    std::cerr << "Invalid number of groups: " << groups << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                config.groups = groups;
+            }
+
+            // Wait mode option: --wait-mode
+            if (vm.count("wait-mode"))
+            {
+                std::string wait_mode = vm["wait-mode"].as<std::string>();
+
+                if (wait_mode == "spin")
+                    config.wait_mode = raft::WaitMode::SPIN;
+                else if (wait_mode == "adaptive")
+                    config.wait_mode = raft::WaitMode::ADAPTIVE;
+                else
+                {
+                    std::cerr << "Invalid wait mode: " << wait_mode << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+
             // Handles the MPI process
-            return mpi::handle_mpi_process(argc, argv, nb_servers, nb_clients);
+            return mpi::handle_mpi_process(argc, argv, nb_servers, nb_clients, config);
         }
         catch (const po::error &e)
         {
@@ -9,12 +9,23 @@ namespace utils
         return str;
     }
 
+    void serialize_message(const message::Message& message, std::vector<char>& buffer)
+    {
+        buffer.resize(message.ByteSizeLong());
+        message.SerializeToArray(buffer.data(), buffer.size());
+    }
+
     std::optional<message::Message> deserialize_message(const std::string& str)
+    {
+        return deserialize_message(str.data(), str.size());
+    }
+
+    std::optional<message::Message> deserialize_message(const char* data, uint64 size)
     {
         message::Message message;
-        if (!message.ParseFromString(str))
+        if (!message.ParseFromArray(data, size))
             return std::nullopt;
 
-        return std::make_optional(message);
+        return std::make_optional(std::move(message));
     }
 }
@@ -1,11 +1,19 @@
 #pragma once
 
+#include <optional> // std::optional
+#include <vector> // std::vector
+
 #include "proto/message.pb.h"
 #include "proto/command_entry.pb.h"
 #include "proto/persistent_state.pb.h"
 
+#include "types.hh"
+
 namespace utils
 {
     std::string serialize_message(const message::Message& message);
+    // Serialize in a reused buffer (no allocation once the buffer is large enough)
+    void serialize_message(const message::Message& message, std::vector<char>& buffer);
     std::optional<message::Message> deserialize_message(const std::string& str);
+    std::optional<message::Message> deserialize_message(const char* data, uint64 size);
 }
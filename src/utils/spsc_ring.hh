@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic> // std::atomic
+#include <vector> // std::vector
+#include <utility> // std::move
+
+#include "types.hh"
+
+namespace utils
+{
+    // Lock-free single producer single consumer ring buffer (bounded)
+    // The producer only writes tail_, the consumer only writes head_: a push and a pop never wait for each other
+    template <typename T>
+    class SPSCRing
+    {
+        public:
+            // The capacity is rounded up to a power of two
+            SPSCRing(uint64 capacity):
+                slots_(round_up(capacity)),
+                mask_(slots_.size() - 1),
+                head_(0),
+                tail_(0)
+            {}
+
+            // Producer: false if the ring is full (the value is left untouched)
+            bool push(T&& value)
+            {
+                uint64 tail = tail_.load(std::memory_order_relaxed);
+
+                if (tail - head_.load(std::memory_order_acquire) == slots_.size())
+                    return false;
+
+                slots_[tail & mask_] = std::move(value);
+                tail_.store(tail + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            // Consumer: false if the ring is empty
+            bool pop(T& value)
+            {
+                uint64 head = head_.load(std::memory_order_relaxed);
+
+                if (head == tail_.load(std::memory_order_acquire))
+                    return false;
+
+                value = std::move(slots_[head & mask_]);
+                head_.store(head + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            // Consumer
+            bool empty() const
+            {
+                return head_.load(std::memory_order_relaxed) == tail_.load(std::memory_order_acquire);
+            }
+        private:
+            static uint64 round_up(uint64 capacity)
+            {
+                uint64 size = 1;
+                while (size < capacity)
+                    size *= 2;
+                return size;
+            }
+
+            std::vector<T> slots_;
+            uint64 mask_;
+            // Next slot to pop (written by the consumer)
+            alignas(64) std::atomic<uint64> head_;
+            // Next slot to push (written by the producer)
+            alignas(64) std::atomic<uint64> tail_;
+    };
+}
@@ -15,3 +15,7 @@ typedef signed short sint16; // −32 767 => 32 767
 // 32 bytes
 typedef unsigned long uint32; // 0 => 4 294 967 295
 typedef signed long sint32; // −2 147 483 647 => 2 147 483 64
+
+// 64 bytes
+typedef unsigned long long uint64; // 0 => 18 446 744 073 709 551 615
+typedef signed long long sint64; // −9 223 372 036 854 775 807 => 9 223 372 036 854 775 807
@@ -135,7 +135,7 @@ def handle_leader_crash_log(scenario):
         print("Error occured")
         print(err)
     else:
-        if is_log_test_sucessful(out, scenario, ["server_1.data"]):
+        if is_log_test_sucessful(out, scenario, ["server_1"]):
             return True
         else:
             return out
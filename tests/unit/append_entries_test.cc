@@ -0,0 +1,215 @@
+#include "unit_test.hh"
+#include "local_network.hh"
+
+#include "proto/append_entry.pb.h"
+#include "proto/command_entry.pb.h"
+
+// The test plays the servers it does not start (the fake leaders 2 and 3, and client 4)
+static const std::vector<raft::node_id_t> server_ids = { 1, 2, 3 };
+
+static log_entry::LogEntry make_entry(raft::index_t index, raft::term_t term)
+{
+    log_entry::LogEntry entry;
+    entry.set_index(index);
+    entry.set_term(term);
+    entry.set_command("command_" + std::to_string(index) + "_term_" + std::to_string(term));
+    return entry;
+}
+
+// Entries first_index to last_index (included) of the given term
+static std::vector<log_entry::LogEntry> make_entries(raft::index_t first_index, raft::index_t last_index, raft::term_t term)
+{
+    std::vector<log_entry::LogEntry> entries;
+    for (raft::index_t index = first_index; index <= last_index; ++index)
+        entries.push_back(make_entry(index, term));
+    return entries;
+}
+
+struct AppendEntries
+{
+    raft::node_id_t leader_id;
+    raft::term_t term;
+    // Index and term of the prev log entry, none to send from the start of the log
+    std::optional<std::pair<raft::index_t, raft::term_t>> prev_log;
+    std::vector<log_entry::LogEntry> entries;
+    std::optional<raft::index_t> leader_commit_index;
+};
+
+// Send the request to the server and return its response (once the new entries are durable)
+static append_entry::AppendEntriesResponse append_entries(LocalCluster& cluster, raft::node_id_t id, const AppendEntries& append)
+{
+    append_entry::AppendEntriesRequest request;
+    request.set_term(append.term);
+    request.set_leader_id(append.leader_id);
+
+    if (append.prev_log)
+    {
+        request.mutable_prev_log_metadata()->set_prev_log_index(append.prev_log.value().first);
+        request.mutable_prev_log_metadata()->set_prev_log_term(append.prev_log.value().second);
+    }
+
+    for (const auto& entry: append.entries)
+        *request.add_log_entries() = entry;
+
+    if (append.leader_commit_index)
+        request.mutable_leader_commit_index()->set_value(append.leader_commit_index.value());
+
+    cluster.send(append.leader_id, id, message::MessageType::APPEND_ENTRIES_REQUEST, request, append.term);
+
+    std::optional<append_entry::AppendEntriesResponse> response;
+    bool is_answered = cluster.run_until([&cluster, &append, &response]() {
+        for (const auto& message: cluster.network().take_messages(append.leader_id))
+        {
+            if (message.type() == message::MessageType::APPEND_ENTRIES_RESPONSE)
+            {
+                response.emplace();
+                message.payload().UnpackTo(&response.value());
+            }
+        }
+        return response.has_value();
+    });
+
+    CHECK(is_answered);
+    return response.value();
+}
+
+// A chunk or a heartbeat only proves the follower's log matches the leader's up to its last entry:
+// a stale suffix after it must not be committed, whatever the leader commit index
+TEST(the_follower_commit_index_is_bounded_by_the_last_new_entry)
+{
+    raft::Config config;
+    config.snapshot_threshold = 0;
+
+    LocalCluster cluster(server_ids, server_ids, config);
+    cluster.start(1);
+
+    // Leader 3 of term 2 appends [0, 4] of term 1 and [5, 9] of term 2, never committed
+    std::vector<log_entry::LogEntry> entries = make_entries(0, 4, 1);
+    for (const auto& entry: make_entries(5, 9, 2))
+        entries.push_back(entry);
+
+    append_entry::AppendEntriesResponse response = append_entries(cluster, 1, { 3, 2, std::nullopt, entries, std::nullopt });
+    CHECK(response.success());
+    CHECK_EQ(response.match_log_size(), 10u);
+    CHECK(!cluster.server(1).commit_index());
+
+    // Leader 2 of term 3 only kept [5, 6] of term 2, and sends them in a chunk of its own
+    response = append_entries(cluster, 1, { 2, 3, std::make_pair(4, 1), make_entries(5, 6, 2), 20 });
+    CHECK(response.success());
+    CHECK_EQ(response.match_log_size(), 7u);
+    CHECK(cluster.server(1).commit_index());
+    CHECK_EQ(cluster.server(1).commit_index().value(), 6u);
+
+    // Heartbeat right after the chunk: the stale entries 7 to 9 still are not committed
+    response = append_entries(cluster, 1, { 2, 3, std::make_pair(6, 2), {}, 20 });
+    CHECK(response.success());
+    CHECK_EQ(cluster.server(1).commit_index().value(), 6u);
+
+    // An older heartbeat (prev log index 4) does not lower the commit index
+    response = append_entries(cluster, 1, { 2, 3, std::make_pair(4, 1), {}, 20 });
+    CHECK(response.success());
+    CHECK_EQ(cluster.server(1).commit_index().value(), 6u);
+
+    // The next chunk replaces the stale suffix, its entries can be committed
+    response = append_entries(cluster, 1, { 2, 3, std::make_pair(6, 2), make_entries(7, 8, 3), 20 });
+    CHECK(response.success());
+    CHECK_EQ(response.match_log_size(), 9u);
+    CHECK_EQ(cluster.server(1).commit_index().value(), 8u);
+
+    cluster.stop_all();
+
+    std::vector<log_entry::LogEntry> log = LocalCluster::read_log(1);
+    CHECK_EQ(log.size(), 9u);
+    CHECK_EQ(log.at(6).term(), 2u);
+    CHECK_EQ(log.at(7).term(), 3u);
+    CHECK_EQ(log.at(8).term(), 3u);
+}
+
+// Build the log of a server with a fake leader 3 per term: each chunk follows the previous one
+static void build_log(LocalCluster& cluster, raft::node_id_t id, const std::vector<raft::term_t>& terms)
+{
+    std::optional<std::pair<raft::index_t, raft::term_t>> prev_log;
+    raft::index_t index = 0;
+
+    while (index < terms.size())
+    {
+        raft::term_t term = terms.at(index);
+        raft::index_t last_index = index;
+        while (last_index + 1 < terms.size() && terms.at(last_index + 1) == term)
+            ++last_index;
+
+        append_entry::AppendEntriesResponse response = append_entries(cluster, id, { 3, term, prev_log, make_entries(index, last_index, term), std::nullopt });
+        CHECK(response.success());
+
+        prev_log = std::make_pair(last_index, term);
+        index = last_index + 1;
+    }
+}
+
+// Leader 1 backtracks over the conflicting terms of follower 2, which ends up with the leader's log
+static void check_divergent_follower_converges(const raft::Config& config)
+{
+    LocalCluster cluster(server_ids, { 1, 2, 3, 4 }, config);
+    cluster.start(1);
+    cluster.start(2);
+
+    // Server 2 holds a longer log whose terms 2 and 3 server 1 never saw
+    const std::vector<raft::term_t> follower_terms = { 1, 1, 1, 2, 2, 2, 3, 3, 3 };
+    const std::vector<raft::term_t> leader_terms = { 1, 1, 1, 4, 4, 5, 5 };
+    build_log(cluster, 2, follower_terms);
+    build_log(cluster, 1, leader_terms);
+
+    // Server 1 has the most up-to-date log (last term 5): server 2 grants its vote
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+    CHECK_EQ(cluster.server(1).current_term(), 6u);
+
+    // An entry of the new term lets the leader commit the whole log
+    command_entry::CommandEntryRequest request;
+    request.set_command("command_7_term_6");
+    request.set_sequence(1);
+    cluster.send(4, 1, message::MessageType::COMMAND_ENTRY_REQUEST, request);
+
+    CHECK(cluster.run_until([&cluster]() {
+        auto is_committed = [&cluster](raft::node_id_t id) {
+            return cluster.server(id).commit_index() && cluster.server(id).commit_index().value() == 7;
+        };
+        return is_committed(1) && is_committed(2);
+    }));
+
+    cluster.stop_all();
+
+    std::vector<log_entry::LogEntry> leader_log = LocalCluster::read_log(1);
+    std::vector<log_entry::LogEntry> follower_log = LocalCluster::read_log(2);
+
+    CHECK_EQ(leader_log.size(), 8u);
+    CHECK_EQ(follower_log.size(), leader_log.size());
+
+    for (raft::index_t index = 0; index < leader_log.size(); ++index)
+    {
+        raft::term_t term = index < leader_terms.size() ? leader_terms.at(index) : 6;
+        CHECK_EQ(leader_log.at(index).term(), term);
+        CHECK_EQ(follower_log.at(index).index(), index);
+        CHECK_EQ(follower_log.at(index).term(), term);
+        CHECK_EQ(follower_log.at(index).command(), leader_log.at(index).command());
+    }
+}
+
+TEST(a_follower_with_conflicting_terms_converges_to_the_leader_log)
+{
+    raft::Config config;
+    config.snapshot_threshold = 0;
+
+    check_divergent_follower_converges(config);
+}
+
+// Same with a single entry per request: the follower log is fixed entry by entry after the conflict
+TEST(a_follower_with_conflicting_terms_converges_with_one_entry_in_flight)
+{
+    raft::Config config;
+    config.snapshot_threshold = 0;
+    config.max_inflight = 1;
+    config.max_inflight_bytes = 1;
+
+    check_divergent_follower_converges(config);
+}
@@ -0,0 +1,165 @@
+#include "unit_test.hh"
+#include "local_network.hh"
+
+#include "raft_applier.hh"
+
+#include "proto/transfer_leader.pb.h"
+
+static raft::ApplyTask apply_task(raft::index_t index, const std::string& command)
+{
+    raft::ApplyTask task;
+    task.type = raft::ApplyTaskType::APPLY;
+    task.index = index;
+    task.indexes.push_back(index);
+    task.inputs.push_back(command);
+    return task;
+}
+
+static raft::ApplyTask query_task(raft::index_t index, const std::string& query)
+{
+    raft::ApplyTask task;
+    task.type = raft::ApplyTaskType::QUERY;
+    task.index = index;
+    task.inputs.push_back(query);
+    return task;
+}
+
+// Wait for the next completed task of the apply thread
+static raft::ApplyTask next_task(raft::Applier& applier)
+{
+    raft::ApplyTask task;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (!applier.poll(task))
+    {
+        CHECK(std::chrono::steady_clock::now() < deadline);
+        std::this_thread::yield();
+    }
+
+    return task;
+}
+
+// More tasks than the rings hold are submitted before the first poll: they come back in order, applied in order
+TEST(the_apply_thread_completes_the_tasks_in_submission_order)
+{
+    raft::Applier applier(raft::StateMachineType::KV, true);
+    const raft::index_t count = 3000;
+
+    for (raft::index_t index = 0; index < count; ++index)
+    {
+        applier.submit(apply_task(index, "PUT a " + std::to_string(index)));
+        applier.submit(query_task(index, "a"));
+    }
+
+    for (raft::index_t index = 0; index < count; ++index)
+    {
+        raft::ApplyTask applied = next_task(applier);
+        CHECK(applied.type == raft::ApplyTaskType::APPLY);
+        CHECK_EQ(applied.index, index);
+        CHECK_EQ(applied.results.size(), 1u);
+        CHECK_EQ(applied.results.at(0), "OK");
+
+        // The query sees every command submitted before it, and none after
+        raft::ApplyTask queried = next_task(applier);
+        CHECK(queried.type == raft::ApplyTaskType::QUERY);
+        CHECK_EQ(queried.index, index);
+        CHECK_EQ(queried.results.at(0), std::to_string(index));
+    }
+
+    raft::ApplyTask task;
+    CHECK(!applier.poll(task));
+}
+
+TEST(the_apply_thread_saves_and_restores_the_state_between_the_commands)
+{
+    raft::Applier applier(raft::StateMachineType::KV, true);
+
+    applier.submit(apply_task(0, "PUT a 1"));
+
+    raft::ApplyTask save;
+    save.type = raft::ApplyTaskType::SAVE;
+    save.index = 0;
+    applier.submit(std::move(save));
+
+    applier.submit(apply_task(1, "PUT a 2"));
+
+    CHECK_EQ(next_task(applier).results.at(0), "OK");
+    std::string state = next_task(applier).results.at(0);
+    CHECK_EQ(next_task(applier).results.at(0), "OK");
+
+    raft::ApplyTask restore;
+    restore.type = raft::ApplyTaskType::RESTORE;
+    restore.index = 0;
+    restore.inputs.push_back(state);
+    applier.submit(std::move(restore));
+    applier.submit(query_task(0, "a"));
+
+    CHECK(next_task(applier).type == raft::ApplyTaskType::RESTORE);
+    CHECK_EQ(next_task(applier).results.at(0), "1");
+}
+
+static std::string commit(LocalCluster& cluster, raft::node_id_t server_id, uint64 sequence, const std::string& command)
+{
+    std::optional<command_entry::CommandEntryResponse> response = cluster.command(4, server_id, sequence, command);
+    CHECK(response);
+    CHECK(response.value().command_committed());
+    CHECK_EQ(response.value().results_size(), 1);
+
+    return response.value().results(0);
+}
+
+static std::string read(LocalCluster& cluster, raft::node_id_t server_id, uint64 sequence, const std::string& key)
+{
+    std::optional<read_index::ReadResponse> response = cluster.read(4, server_id, sequence, key);
+    CHECK(response);
+    CHECK(response.value().success());
+
+    return response.value().value();
+}
+
+// The servers hand their committed commands to the apply thread: the results and the reads are those of the log order
+TEST(the_servers_answer_from_the_apply_thread)
+{
+    raft::Config config;
+    config.state_machine = raft::StateMachineType::KV;
+    config.apply_thread = true;
+    config.snapshot_threshold = 8;
+
+    LocalCluster cluster({ 1, 2, 3 }, { 1, 2, 3, 4 }, config);
+    cluster.start(1);
+    cluster.start(2);
+    cluster.start(3);
+
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+
+    CHECK_EQ(commit(cluster, 1, 1, "PUT a 1"), "OK");
+    CHECK_EQ(commit(cluster, 1, 2, "CAS a 2 3"), "FAILED");
+    CHECK_EQ(commit(cluster, 1, 3, "CAS a 1 3"), "OK");
+    CHECK_EQ(read(cluster, 1, 1, "a"), "3");
+
+    for (uint64 sequence = 4; sequence <= 20; ++sequence)
+        CHECK_EQ(commit(cluster, 1, sequence, "PUT b " + std::to_string(sequence)), "OK");
+
+    CHECK_EQ(commit(cluster, 1, 21, "DEL a"), "OK");
+    CHECK_EQ(read(cluster, 1, 2, "a"), "NOT_FOUND");
+    CHECK_EQ(read(cluster, 1, 3, "b"), "20");
+
+    // The state saved by the apply thread comes back when server 2 restarts from its snapshot
+    CHECK(cluster.run_until([]() {
+        std::optional<snapshot::Snapshot> snapshot = LocalCluster::read_snapshot(2);
+        return snapshot && snapshot.value().last_included_index() >= 15;
+    }));
+
+    cluster.stop(2);
+    cluster.start(2);
+
+    transfer_leader::TransferLeaderRequest transfer;
+    transfer.set_target_id(2);
+    cluster.send(LocalCluster::controller_id, 1, message::MessageType::TRANSFER_LEADER_REQUEST, transfer);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(2); }));
+
+    CHECK_EQ(read(cluster, 2, 4, "a"), "NOT_FOUND");
+    CHECK_EQ(read(cluster, 2, 5, "b"), "20");
+    CHECK_EQ(commit(cluster, 2, 22, "CAS b 20 21"), "OK");
+}
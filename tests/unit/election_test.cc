@@ -0,0 +1,85 @@
+#include "unit_test.hh"
+#include "local_network.hh"
+
+// Server 3 is cut from the others and keeps timing out: with pre-vote its term is not increased
+// so it rejoins as a follower and the leader is not disrupted
+TEST(an_isolated_server_does_not_increase_its_term_with_pre_vote)
+{
+    raft::Config config;
+    config.pre_vote = true;
+
+    LocalCluster cluster({ 1, 2, 3 }, { 1, 2, 3, 4 }, config);
+    cluster.start(1);
+    cluster.start(2);
+    cluster.start(3, 200);
+
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+    CHECK(cluster.command(4, 1, 1, "a"));
+    raft::term_t term = cluster.server(1).current_term();
+
+    cluster.network().disconnect(3);
+    CHECK(cluster.run_until([&cluster]() { return cluster.server(3).state() == raft::ServerState::PRE_CANDIDATE; }));
+    cluster.run_for(1000);
+    CHECK_EQ(cluster.server(3).current_term(), term);
+
+    cluster.network().connect(3);
+    CHECK(cluster.run_until([&cluster]() { return cluster.server(3).state() == raft::ServerState::FOLLOWER; }));
+
+    CHECK(cluster.command(4, 1, 2, "b"));
+    CHECK(cluster.is_leader(1));
+    CHECK_EQ(cluster.server(1).current_term(), term);
+    CHECK_EQ(cluster.server(3).current_term(), term);
+}
+
+// Without pre-vote, the same server comes back with a higher term and the leader steps down
+TEST(an_isolated_server_disrupts_the_leader_without_pre_vote)
+{
+    raft::Config config;
+
+    LocalCluster cluster({ 1, 2, 3 }, { 1, 2, 3, 4 }, config);
+    cluster.start(1);
+    cluster.start(2);
+    cluster.start(3, 200);
+
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+    CHECK(cluster.command(4, 1, 1, "a"));
+    raft::term_t term = cluster.server(1).current_term();
+
+    cluster.network().disconnect(3);
+    CHECK(cluster.run_until([&cluster, term]() { return cluster.server(3).current_term() > term; }));
+
+    cluster.network().connect(3);
+    CHECK(cluster.run_until([&cluster, term]() { return cluster.server(1).current_term() > term; }));
+}
+
+// The leader steps down once it stops hearing from a majority, it keeps leading while it hears from one
+TEST(a_leader_cut_from_the_majority_steps_down_with_check_quorum)
+{
+    raft::Config config;
+    config.check_quorum = true;
+
+    LocalCluster cluster({ 1, 2, 3 }, { 1, 2, 3, 4 }, config);
+    cluster.start(1);
+    cluster.start(2);
+    cluster.start(3);
+
+    // The election timeout of the leader is drawn again when it runs for election (at most 300 ms)
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+    raft::term_t term = cluster.server(1).current_term();
+
+    cluster.run_for(1000);
+    CHECK(cluster.is_leader(1));
+
+    // A single follower is enough for a majority
+    cluster.network().disconnect(3);
+    cluster.run_for(1000);
+    CHECK(cluster.is_leader(1));
+
+    cluster.network().disconnect(2);
+    CHECK(cluster.run_until([&cluster]() { return !cluster.is_leader(1); }, 2000));
+    CHECK(cluster.server(1).state() == raft::ServerState::FOLLOWER);
+    CHECK_EQ(cluster.server(1).current_term(), term);
+}
@@ -0,0 +1,232 @@
+#include "unit_test.hh"
+
+#include <map> // std::map
+#include <random> // std::mt19937
+
+#include "kv_engine.hh"
+#include "kv_arena.hh"
+
+static std::string key(uint32 i)
+{
+    return "key_" + std::to_string(i);
+}
+
+// The engine holds exactly the entries of the reference
+static void check_same_entries(const kv::Engine& engine, const std::map<std::string, std::string>& reference)
+{
+    CHECK_EQ(engine.size(), reference.size());
+
+    for (const auto& [key, value]: reference)
+    {
+        std::optional<std::string_view> found = engine.get(key);
+        CHECK(found);
+        CHECK_EQ(found.value(), value);
+    }
+
+    uint64 count = 0;
+    engine.for_each([&reference, &count](std::string_view key, std::string_view value) {
+        auto entry = reference.find(std::string(key));
+        CHECK(entry != reference.end());
+        CHECK_EQ(value, entry->second);
+        ++count;
+    });
+    CHECK_EQ(count, reference.size());
+}
+
+TEST(the_arena_allocates_contiguously_in_its_blocks)
+{
+    kv::Arena arena(64);
+
+    char* first = arena.allocate(10);
+    char* second = arena.allocate(20);
+    CHECK(second == first + 10);
+
+    // The block is full: the next allocation starts a new one
+    char* third = arena.allocate(40);
+    CHECK(third != second + 20);
+    CHECK_EQ(arena.allocated(), 70u);
+
+    arena.clear();
+    CHECK_EQ(arena.allocated(), 0u);
+}
+
+TEST(an_oversized_allocation_keeps_the_current_block)
+{
+    kv::Arena arena(64);
+
+    char* small = arena.allocate(10);
+    char* large = arena.allocate(1000);
+    std::memset(large, 'x', 1000);
+
+    // Still allocated right after the first one
+    char* next = arena.allocate(10);
+    CHECK(next == small + 10);
+    CHECK_EQ(arena.allocated(), 1020u);
+    CHECK_EQ(std::string(large, 1000), std::string(1000, 'x'));
+}
+
+TEST(put_get_erase_and_compare_and_swap)
+{
+    kv::Engine engine;
+    CHECK(!engine.get("a"));
+    CHECK(!engine.erase("a"));
+    CHECK(!engine.compare_and_swap("a", "", "1"));
+
+    engine.put("a", "1");
+    engine.put("empty", "");
+    CHECK_EQ(engine.size(), 2u);
+    CHECK_EQ(engine.get("a").value(), "1");
+    CHECK_EQ(engine.get("empty").value(), "");
+
+    // Shorter then longer values reuse then outgrow the space of the entry
+    engine.put("a", "");
+    CHECK_EQ(engine.get("a").value(), "");
+    engine.put("a", "a much longer value than before");
+    CHECK_EQ(engine.get("a").value(), "a much longer value than before");
+    CHECK_EQ(engine.size(), 2u);
+
+    CHECK(!engine.compare_and_swap("a", "1", "2"));
+    CHECK(engine.compare_and_swap("a", "a much longer value than before", "2"));
+    CHECK_EQ(engine.get("a").value(), "2");
+
+    CHECK(engine.erase("a"));
+    CHECK(!engine.get("a"));
+    CHECK(!engine.erase("a"));
+    CHECK(!engine.compare_and_swap("a", "2", "3"));
+    CHECK_EQ(engine.size(), 1u);
+
+    engine.clear();
+    CHECK_EQ(engine.size(), 0u);
+    CHECK(!engine.get("empty"));
+}
+
+TEST(the_table_grows_and_keeps_every_key)
+{
+    kv::Engine engine;
+    std::map<std::string, std::string> reference;
+
+    // Many times the initial capacity: the probe sequences collide and the table is doubled several times
+    for (uint32 i = 0; i < 10000; ++i)
+    {
+        engine.put(key(i), "value_" + std::to_string(i));
+        reference[key(i)] = "value_" + std::to_string(i);
+    }
+
+    check_same_entries(engine, reference);
+    CHECK(!engine.get("key_10000"));
+}
+
+TEST(a_lookup_probes_past_the_deleted_keys)
+{
+    kv::Engine engine;
+    std::map<std::string, std::string> reference;
+
+    for (uint32 i = 0; i < 40; ++i)
+    {
+        engine.put(key(i), key(i));
+        reference[key(i)] = key(i);
+    }
+
+    // Every other key leaves a tombstone in the probe sequences of the keys after it
+    for (uint32 i = 0; i < 40; i += 2)
+    {
+        CHECK(engine.erase(key(i)));
+        reference.erase(key(i));
+    }
+    check_same_entries(engine, reference);
+
+    // Inserting again reuses the tombstones
+    for (uint32 i = 0; i < 40; i += 4)
+    {
+        engine.put(key(i), "again");
+        reference[key(i)] = "again";
+    }
+    check_same_entries(engine, reference);
+}
+
+TEST(deletes_and_reinserts_do_not_fill_the_table)
+{
+    kv::Engine engine;
+
+    // Each round leaves tombstones: without the rebuilds dropping them, a lookup would never end on an EMPTY slot
+    for (uint32 round = 0; round < 1000; ++round)
+    {
+        engine.put(key(round), "value");
+        CHECK(engine.erase(key(round)));
+        CHECK(!engine.get(key(round)));
+    }
+
+    CHECK_EQ(engine.size(), 0u);
+    CHECK(!engine.get("missing"));
+}
+
+TEST(the_arena_garbage_is_dropped_by_a_rebuild)
+{
+    kv::Engine engine;
+    engine.put("small", "stays");
+
+    // Each longer value moves the entry in the arena: 32 MB of garbage in total
+    std::string value;
+    for (uint32 size = 1; size <= 8 * 1024; ++size)
+    {
+        value.assign(size, 'a' + size % 26);
+        engine.put("large", value);
+    }
+
+    CHECK_EQ(engine.get("large").value(), value);
+    CHECK_EQ(engine.get("small").value(), "stays");
+
+    // The garbage never grows much past the rebuild threshold (4 MB)
+    CHECK(engine.arena_bytes() < 5 * 1024 * 1024);
+
+    // Same with the deleted entries
+    for (uint32 i = 0; i < 4 * 1024; ++i)
+    {
+        engine.put(key(i), std::string(4 * 1024, 'x'));
+        CHECK(engine.erase(key(i)));
+    }
+
+    CHECK_EQ(engine.size(), 2u);
+    CHECK_EQ(engine.get("small").value(), "stays");
+    CHECK(engine.arena_bytes() < 5 * 1024 * 1024);
+}
+
+TEST(random_operations_match_a_map)
+{
+    std::mt19937 random(7);
+    kv::Engine engine;
+    std::map<std::string, std::string> reference;
+
+    for (uint32 operation = 0; operation < 50000; ++operation)
+    {
+        std::string k = key(random() % 500);
+        std::string v(random() % 64, 'a' + random() % 26);
+        auto entry = reference.find(k);
+
+        switch (random() % 4)
+        {
+            case 0:
+            case 1:
+                engine.put(k, v);
+                reference[k] = v;
+                break;
+            case 2:
+                CHECK_EQ(engine.erase(k), entry != reference.end());
+                reference.erase(k);
+                break;
+            case 3:
+            {
+                // Half of the swaps expect the current value
+                std::string expected = entry != reference.end() && random() % 2 ? entry->second : "other";
+                bool swapped = entry != reference.end() && entry->second == expected;
+
+                CHECK_EQ(engine.compare_and_swap(k, expected, v), swapped);
+                if (swapped)
+                    entry->second = v;
+                break;
+            }
+        }
+    }
+
+    check_same_entries(engine, reference);
+}
@@ -0,0 +1,179 @@
+#include "unit_test.hh"
+#include "local_network.hh"
+
+#include "raft_kv_state_machine.hh"
+
+#include "proto/transfer_leader.pb.h"
+
+// Apply a single command and return its result
+static std::string apply(raft::StateMachine& state_machine, const std::string& command)
+{
+    std::vector<std::string_view> commands = { command };
+    std::vector<std::string> results;
+    state_machine.apply(commands, results);
+
+    CHECK_EQ(results.size(), 1u);
+    return results.at(0);
+}
+
+TEST(the_commands_return_their_result)
+{
+    raft::KVStateMachine state_machine;
+
+    CHECK_EQ(apply(state_machine, "GET a"), "NOT_FOUND");
+    CHECK_EQ(apply(state_machine, "PUT a 1"), "OK");
+    CHECK_EQ(apply(state_machine, "GET a"), "1");
+
+    CHECK_EQ(apply(state_machine, "CAS a 2 3"), "FAILED");
+    CHECK_EQ(apply(state_machine, "CAS a 1 3"), "OK");
+    CHECK_EQ(apply(state_machine, "GET a"), "3");
+    CHECK_EQ(apply(state_machine, "CAS missing 1 3"), "FAILED");
+
+    CHECK_EQ(apply(state_machine, "DEL a"), "OK");
+    CHECK_EQ(apply(state_machine, "DEL a"), "NOT_FOUND");
+    CHECK_EQ(apply(state_machine, "GET a"), "NOT_FOUND");
+}
+
+TEST(a_value_is_the_rest_of_the_put_command)
+{
+    raft::KVStateMachine state_machine;
+
+    CHECK_EQ(apply(state_machine, "PUT a hello raft world"), "OK");
+    CHECK_EQ(state_machine.query("a"), "hello raft world");
+
+    CHECK_EQ(apply(state_machine, "PUT b"), "OK");
+    CHECK_EQ(state_machine.query("b"), "");
+}
+
+TEST(a_malformed_command_is_invalid)
+{
+    raft::KVStateMachine state_machine;
+    apply(state_machine, "PUT a 1");
+
+    CHECK_EQ(apply(state_machine, ""), "INVALID");
+    CHECK_EQ(apply(state_machine, "PUT"), "INVALID");
+    CHECK_EQ(apply(state_machine, "GET"), "INVALID");
+    CHECK_EQ(apply(state_machine, "GET a b"), "INVALID");
+    CHECK_EQ(apply(state_machine, "DEL a b"), "INVALID");
+    CHECK_EQ(apply(state_machine, "CAS a 1 2 3"), "INVALID");
+    CHECK_EQ(apply(state_machine, "put a 2"), "INVALID");
+    CHECK_EQ(apply(state_machine, "INCR a"), "INVALID");
+
+    // Nothing was modified
+    CHECK_EQ(state_machine.query("a"), "1");
+}
+
+TEST(a_batch_returns_one_result_per_command_in_order)
+{
+    raft::KVStateMachine state_machine;
+
+    std::vector<std::string_view> commands = { "PUT a 1", "CAS a 1 2", "GET a", "DEL b", "BAD" };
+    std::vector<std::string> results;
+    state_machine.apply(commands, results);
+
+    CHECK_EQ(results.size(), 5u);
+    CHECK_EQ(results.at(0), "OK");
+    CHECK_EQ(results.at(1), "OK");
+    CHECK_EQ(results.at(2), "2");
+    CHECK_EQ(results.at(3), "NOT_FOUND");
+    CHECK_EQ(results.at(4), "INVALID");
+}
+
+TEST(a_saved_state_is_restored_in_another_state_machine)
+{
+    raft::KVStateMachine state_machine;
+    apply(state_machine, "PUT a 1");
+    apply(state_machine, "PUT b 2");
+    apply(state_machine, "PUT c 3");
+    apply(state_machine, "CAS a 1 10");
+    apply(state_machine, "DEL b");
+
+    std::string data = state_machine.save();
+
+    // The restored state replaces the previous one
+    raft::KVStateMachine restored;
+    apply(restored, "PUT b old");
+    apply(restored, "PUT d old");
+    restored.restore(data);
+
+    CHECK_EQ(restored.query("a"), "10");
+    CHECK_EQ(restored.query("b"), "NOT_FOUND");
+    CHECK_EQ(restored.query("c"), "3");
+    CHECK_EQ(restored.query("d"), "NOT_FOUND");
+
+    // It keeps working after the restore
+    CHECK_EQ(apply(restored, "CAS c 3 30"), "OK");
+    CHECK_EQ(restored.query("c"), "30");
+
+    // An empty state machine saves an empty state
+    raft::KVStateMachine empty;
+    restored.restore(empty.save());
+    CHECK_EQ(restored.query("a"), "NOT_FOUND");
+}
+
+// Result of a committed command, empty for a duplicate (not applied again)
+static std::string commit(LocalCluster& cluster, raft::node_id_t server_id, uint64 sequence, const std::string& command)
+{
+    std::optional<command_entry::CommandEntryResponse> response = cluster.command(4, server_id, sequence, command);
+    CHECK(response);
+    CHECK(response.value().command_committed());
+
+    return response.value().results_size() == 0 ? "" : response.value().results(0);
+}
+
+static std::string read(LocalCluster& cluster, raft::node_id_t server_id, uint64 sequence, const std::string& key)
+{
+    std::optional<read_index::ReadResponse> response = cluster.read(4, server_id, sequence, key);
+    CHECK(response);
+    CHECK(response.value().success());
+
+    return response.value().value();
+}
+
+// A restarted server gets its key-value store back from its snapshot, the log entries it covers are gone
+TEST(a_restarted_server_restores_the_store_from_its_snapshot)
+{
+    raft::Config config;
+    config.state_machine = raft::StateMachineType::KV;
+    config.snapshot_threshold = 1;
+
+    LocalCluster cluster({ 1, 2, 3 }, { 1, 2, 3, 4 }, config);
+    cluster.start(1);
+    cluster.start(2);
+    cluster.start(3);
+
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+
+    CHECK_EQ(commit(cluster, 1, 1, "PUT a 1"), "OK");
+    CHECK_EQ(commit(cluster, 1, 2, "PUT b 2"), "OK");
+    CHECK_EQ(commit(cluster, 1, 3, "PUT c 3"), "OK");
+    CHECK_EQ(commit(cluster, 1, 4, "CAS a 1 10"), "OK");
+    CHECK_EQ(commit(cluster, 1, 5, "DEL b"), "OK");
+    CHECK_EQ(commit(cluster, 1, 6, "CAS c 999 30"), "FAILED");
+    CHECK_EQ(commit(cluster, 1, 7, "DEL zz"), "NOT_FOUND");
+
+    // Server 3 applied the 7 commands and compacted them in its snapshot
+    CHECK(cluster.run_until([]() {
+        std::optional<snapshot::Snapshot> snapshot = LocalCluster::read_snapshot(3);
+        return snapshot && snapshot.value().last_included_index() == 6;
+    }));
+
+    cluster.stop(3);
+    cluster.start(3);
+
+    transfer_leader::TransferLeaderRequest transfer;
+    transfer.set_target_id(3);
+    cluster.send(LocalCluster::controller_id, 1, message::MessageType::TRANSFER_LEADER_REQUEST, transfer);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(3); }));
+
+    CHECK_EQ(read(cluster, 3, 1, "a"), "10");
+    CHECK_EQ(read(cluster, 3, 2, "b"), "NOT_FOUND");
+    CHECK_EQ(read(cluster, 3, 3, "c"), "3");
+    CHECK_EQ(read(cluster, 3, 4, "zz"), "NOT_FOUND");
+
+    // The sessions came back with the store: a retried CAS is not applied again
+    CHECK_EQ(commit(cluster, 3, 4, "CAS a 1 10"), "");
+    CHECK_EQ(commit(cluster, 3, 8, "CAS a 10 11"), "OK");
+    CHECK_EQ(read(cluster, 3, 5, "a"), "11");
+}
@@ -0,0 +1,80 @@
+#include "unit_test.hh"
+#include "local_network.hh"
+
+#include "proto/transfer_leader.pb.h"
+
+static void transfer(LocalCluster& cluster, raft::node_id_t leader_id, raft::node_id_t target_id)
+{
+    transfer_leader::TransferLeaderRequest request;
+    request.set_target_id(target_id);
+    cluster.send(LocalCluster::controller_id, leader_id, message::MessageType::TRANSFER_LEADER_REQUEST, request);
+}
+
+// Server 3 missed entries: the leader catches it up before sending TimeoutNow, it wins the next term with the whole log
+TEST(a_lagging_follower_is_caught_up_before_it_takes_the_leadership)
+{
+    raft::Config config;
+
+    LocalCluster cluster({ 1, 2, 3 }, { 1, 2, 3, 4 }, config);
+    cluster.start(1);
+    cluster.start(2);
+    cluster.start(3);
+
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+    CHECK(cluster.command(4, 1, 1, "a"));
+    raft::term_t term = cluster.server(1).current_term();
+
+    cluster.network().disconnect(3);
+    CHECK(cluster.command(4, 1, 2, "b"));
+    CHECK(cluster.command(4, 1, 3, "c"));
+
+    uint32 timeout_now_count = cluster.network().delivered(message::MessageType::TIMEOUT_NOW);
+    transfer(cluster, 1, 3);
+    cluster.step();
+    CHECK_EQ(cluster.network().delivered(message::MessageType::TIMEOUT_NOW), timeout_now_count);
+
+    cluster.network().connect(3);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(3); }));
+    CHECK_EQ(cluster.network().delivered(message::MessageType::TIMEOUT_NOW), timeout_now_count + 1);
+    CHECK_EQ(cluster.server(3).current_term(), term + 1);
+
+    CHECK(cluster.command(4, 3, 4, "d"));
+    CHECK(cluster.run_until([&cluster]() { return cluster.server(1).commit_index() == cluster.server(3).commit_index(); }));
+    CHECK(!cluster.is_leader(1));
+
+    cluster.stop_all();
+
+    std::vector<log_entry::LogEntry> log = LocalCluster::read_log(3);
+    CHECK_EQ(log.size(), 4u);
+    CHECK_EQ(log.at(0).command(), "a");
+    CHECK_EQ(log.at(1).command(), "b");
+    CHECK_EQ(log.at(2).command(), "c");
+    CHECK_EQ(log.at(3).command(), "d");
+    CHECK_EQ(log.at(3).term(), term + 1);
+}
+
+// The target never answers: the leader gives up after an election timeout and keeps serving the commands
+TEST(a_transfer_to_an_unreachable_server_is_aborted)
+{
+    raft::Config config;
+
+    LocalCluster cluster({ 1, 2, 3 }, { 1, 2, 3, 4 }, config);
+    cluster.start(1);
+    cluster.start(2);
+    cluster.start(3);
+
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+    raft::term_t term = cluster.server(1).current_term();
+
+    cluster.network().disconnect(3);
+    transfer(cluster, 1, 3);
+    cluster.run_for(1000);
+
+    std::optional<command_entry::CommandEntryResponse> response = cluster.command(4, 1, 1, "a");
+    CHECK(response);
+    CHECK(response.value().command_committed());
+    CHECK(cluster.is_leader(1));
+    CHECK_EQ(cluster.server(1).current_term(), term);
+}
@@ -0,0 +1,320 @@
+#pragma once
+
+#include <map> // std::map
+#include <set> // std::set
+#include <deque> // std::deque
+#include <vector> // std::vector
+#include <memory> // std::unique_ptr
+#include <optional> // std::optional
+#include <chrono> // std::chrono
+#include <thread> // std::this_thread::sleep_for
+#include <functional> // std::function
+#include <fstream> // std::ifstream
+#include <boost/filesystem.hpp> // boost::filesystem::exists
+
+#include "unit_test.hh"
+#include "rpc.hh"
+#include "raft_server.hh"
+#include "raft_config.hh"
+#include "wal.hh"
+
+#include "proto/message.pb.h"
+#include "proto/log_entry.pb.h"
+#include "proto/command_entry.pb.h"
+#include "proto/read_index.pb.h"
+#include "proto/snapshot.pb.h"
+
+// In-memory network for the servers of a unit test
+// Messages to a node without an endpoint (a client, or a server played by the test) are kept for the test to read
+class LocalNetwork
+{
+    public:
+        class Endpoint: public rpc::RPC
+        {
+            public:
+                Endpoint(LocalNetwork& network, raft::node_id_t id):
+                    network_(network),
+                    id_(id),
+                    inbox_()
+                {}
+
+                // Overriden methods
+                void send_message(const message::Message& message) override
+                {
+                    message::Message sent = message;
+                    sent.set_source_id(id_);
+                    network_.deliver(std::move(sent));
+                }
+
+                std::vector<message::Message> receive_messages() override
+                {
+                    std::vector<message::Message> messages(inbox_.begin(), inbox_.end());
+                    inbox_.clear();
+                    return messages;
+                }
+
+                bool has_message() override { return !inbox_.empty(); }
+                void begin_batch() override {}
+                void flush_batch() override {}
+
+                void push(message::Message&& message) { inbox_.push_back(std::move(message)); }
+                void clear() { inbox_.clear(); }
+            private:
+                LocalNetwork& network_;
+                raft::node_id_t id_;
+                std::deque<message::Message> inbox_;
+        };
+
+        Endpoint* endpoint(raft::node_id_t id)
+        {
+            auto& endpoint = endpoints_[id];
+            if (!endpoint)
+                endpoint = std::make_unique<Endpoint>(*this, id);
+            return endpoint.get();
+        }
+
+        // A disconnected node neither sends nor receives anything
+        void disconnect(raft::node_id_t id) { disconnected_.insert(id); }
+        void connect(raft::node_id_t id) { disconnected_.erase(id); }
+
+        // Send a message as if it came from its source id
+        void deliver(message::Message&& message)
+        {
+            if (disconnected_.count(message.source_id()) || disconnected_.count(message.dest_id()))
+                return;
+
+            delivered_[message.type()]++;
+
+            auto endpoint = endpoints_.find(message.dest_id());
+
+            if (endpoint != endpoints_.end())
+                endpoint->second->push(std::move(message));
+            else
+                outbox_[message.dest_id()].push_back(std::move(message));
+        }
+
+        // Messages sent to a node without an endpoint
+        std::vector<message::Message> take_messages(raft::node_id_t id)
+        {
+            std::vector<message::Message> messages;
+            messages.swap(outbox_[id]);
+            return messages;
+        }
+
+        // Number of messages of this type delivered so far (the dropped ones are not counted)
+        uint32 delivered(message::MessageType type) { return delivered_[type]; }
+    private:
+        std::map<raft::node_id_t, std::unique_ptr<Endpoint>> endpoints_;
+        std::set<raft::node_id_t> disconnected_;
+        std::map<raft::node_id_t, std::vector<message::Message>> outbox_;
+        std::map<message::MessageType, uint32> delivered_;
+};
+
+// Servers of a unit test, driven step by step on the test thread (the storage writers run on their own threads)
+class LocalCluster
+{
+    public:
+        // Id of the controller
+        static constexpr raft::node_id_t controller_id = 0;
+        // Id the test sends its own messages from (the controller messages are handled apart)
+        static constexpr raft::node_id_t tester_id = 1000;
+
+        // The servers the test never starts are played by the test itself
+        LocalCluster(const std::vector<raft::node_id_t>& server_ids, const std::vector<raft::node_id_t>& node_ids, const raft::Config& config):
+            server_ids_(server_ids),
+            node_ids_(node_ids),
+            config_(config),
+            network_(),
+            servers_()
+        {
+            unit::remove_directory("logs");
+        }
+
+        LocalNetwork& network() { return network_; }
+
+        raft::Server& server(raft::node_id_t id) { return *servers_.at(id); }
+
+        // Create the server (restoring what it stored, if anything) and start it
+        // By default the election timeout is long enough for the test to decide the elections (TimeoutNow)
+        void start(raft::node_id_t id, time_t election_timeout = 60 * 1000)
+        {
+            LocalNetwork::Endpoint* endpoint = network_.endpoint(id);
+            endpoint->clear();
+
+            servers_[id] = std::make_unique<raft::Server>(id, 0, controller_id, server_ids_, node_ids_, config_);
+            servers_[id]->set_rpc(endpoint);
+
+            election_timeout::ElectionTimeoutRequest timeout_request;
+            timeout_request.set_timeout(election_timeout);
+            send(controller_id, id, message::MessageType::ELECTION_TIMEOUT_REQUEST, timeout_request);
+            send(controller_id, id, message::MessageType::START_REQUEST);
+
+            // A server drops the messages it receives while it is not started
+            servers_[id]->step();
+        }
+
+        // Destroy the server, its writes are flushed to the disk first
+        void stop(raft::node_id_t id)
+        {
+            servers_.erase(id);
+            network_.endpoint(id)->clear();
+        }
+
+        void stop_all() { servers_.clear(); }
+
+        // Ask the server to start an election right away
+        void elect(raft::node_id_t id)
+        {
+            send(tester_id, id, message::MessageType::TIMEOUT_NOW, server(id).current_term());
+        }
+
+        void send(raft::node_id_t source_id, raft::node_id_t dest_id, message::MessageType type, raft::term_t term = 0)
+        {
+            message::Message message;
+            message.set_source_id(source_id);
+            message.set_dest_id(dest_id);
+            message.set_type(type);
+            message.set_term(term);
+            network_.deliver(std::move(message));
+        }
+
+        void send(raft::node_id_t source_id, raft::node_id_t dest_id, message::MessageType type, const google::protobuf::Message& payload, raft::term_t term = 0)
+        {
+            message::Message message;
+            message.set_source_id(source_id);
+            message.set_dest_id(dest_id);
+            message.set_type(type);
+            message.set_term(term);
+            message.mutable_payload()->PackFrom(payload);
+            network_.deliver(std::move(message));
+        }
+
+        void step()
+        {
+            for (auto& [id, server]: servers_)
+                server->step();
+        }
+
+        // Step the servers until the condition holds, false after timeout (ms)
+        bool run_until(const std::function<bool()>& condition, time_t timeout = 5000)
+        {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+            while (std::chrono::steady_clock::now() < deadline)
+            {
+                step();
+
+                if (condition())
+                    return true;
+
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+
+            return false;
+        }
+
+        // Step the servers for a while
+        void run_for(time_t duration)
+        {
+            run_until([]() { return false; }, duration);
+        }
+
+        // Send a command from a client and wait for the response of its sequence (the client's other messages are dropped)
+        // By default the client saw all its previous commands committed
+        std::optional<command_entry::CommandEntryResponse> command(raft::node_id_t client_id, raft::node_id_t server_id, uint64 sequence, const std::string& command,
+                                                                   std::optional<uint64> first_unacked_sequence = std::nullopt)
+        {
+            command_entry::CommandEntryRequest request = command_request(sequence, command, first_unacked_sequence.value_or(sequence));
+            send(client_id, server_id, message::MessageType::COMMAND_ENTRY_REQUEST, request);
+
+            std::optional<command_entry::CommandEntryResponse> response;
+            run_until([this, client_id, sequence, &response]() {
+                for (const auto& message: network_.take_messages(client_id))
+                {
+                    command_entry::CommandEntryResponse answer;
+                    if (message.type() != message::MessageType::COMMAND_ENTRY_RESPONSE || !message.payload().UnpackTo(&answer))
+                        continue;
+
+                    for (uint64 answered: answer.sequences())
+                    {
+                        if (answered == sequence)
+                            response = answer;
+                    }
+                }
+                return response.has_value();
+            });
+
+            return response;
+        }
+
+        static command_entry::CommandEntryRequest command_request(uint64 sequence, const std::string& command, uint64 first_unacked_sequence)
+        {
+            command_entry::CommandEntryRequest request;
+            request.set_command(command);
+            request.set_sequence(sequence);
+            request.set_first_unacked_sequence(first_unacked_sequence);
+            return request;
+        }
+
+        // Send a read from a client and wait for the response of its sequence (the client's other messages are dropped)
+        std::optional<read_index::ReadResponse> read(raft::node_id_t client_id, raft::node_id_t server_id, uint64 sequence, const std::string& query)
+        {
+            read_index::ReadRequest request;
+            request.set_sequence(sequence);
+            request.set_query(query);
+            send(client_id, server_id, message::MessageType::READ_REQUEST, request);
+
+            std::optional<read_index::ReadResponse> response;
+            run_until([this, client_id, sequence, &response]() {
+                for (const auto& message: network_.take_messages(client_id))
+                {
+                    read_index::ReadResponse answer;
+                    if (message.type() == message::MessageType::READ_RESPONSE && message.payload().UnpackTo(&answer) && answer.sequence() == sequence)
+                        response = answer;
+                }
+                return response.has_value();
+            });
+
+            return response;
+        }
+
+        bool is_leader(raft::node_id_t id)
+        {
+            return servers_.count(id) && server(id).state() == raft::ServerState::LEADER;
+        }
+
+        // Log entries of a stopped server, read back from its write-ahead log
+        static std::vector<log_entry::LogEntry> read_log(raft::node_id_t id)
+        {
+            std::vector<log_entry::LogEntry> entries;
+
+            storage::WAL wal("logs/server_" + std::to_string(id), 4 * 1024 * 1024);
+            wal.replay([&entries](uint32, const std::string& record) {
+                entries.emplace_back();
+                entries.back().ParseFromString(record);
+            });
+
+            return entries;
+        }
+
+        // Snapshot a server saved, none if it did not save any yet
+        static std::optional<snapshot::Snapshot> read_snapshot(raft::node_id_t id)
+        {
+            std::string path = "logs/server_" + std::to_string(id) + "/snapshot.data";
+            if (!boost::filesystem::exists(path))
+                return std::nullopt;
+
+            snapshot::Snapshot snapshot;
+            std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+            if (!snapshot.ParseFromIstream(&file))
+                return std::nullopt;
+
+            return snapshot;
+        }
+    private:
+        std::vector<raft::node_id_t> server_ids_;
+        std::vector<raft::node_id_t> node_ids_;
+        raft::Config config_;
+        LocalNetwork network_;
+        std::map<raft::node_id_t, std::unique_ptr<raft::Server>> servers_;
+};
@@ -0,0 +1,240 @@
+#include "unit_test.hh"
+#include "local_network.hh"
+
+#include <algorithm> // std::count
+
+#include "raft_multi_server.hh"
+#include "group_rpc.hh"
+
+#include "proto/election_timeout.pb.h"
+
+static const std::vector<raft::node_id_t> server_ids = { 1, 2, 3 };
+static const raft::node_id_t client_id = 4;
+static const uint32 nb_groups = 2;
+
+// Ranks 1 to 3 each host the servers of 2 Raft groups, stepped on the test thread
+class MultiCluster
+{
+    public:
+        MultiCluster():
+            network_(),
+            ranks_(),
+            next_sequence_(1)
+        {
+            unit::remove_directory("logs");
+
+            raft::Config config;
+            config.groups = nb_groups;
+            config.snapshot_threshold = 0;
+
+            for (raft::node_id_t id: server_ids)
+            {
+                ranks_[id] = std::make_unique<raft::MultiServer>(id, LocalCluster::controller_id, server_ids, std::vector<raft::node_id_t> { 1, 2, 3, client_id }, config);
+                ranks_[id]->set_rpc(network_.endpoint(id));
+
+                // Every group of the rank handles them
+                election_timeout::ElectionTimeoutRequest timeout_request;
+                timeout_request.set_timeout(60 * 1000);
+                send(LocalCluster::controller_id, id, 0, message::MessageType::ELECTION_TIMEOUT_REQUEST, timeout_request);
+                send(LocalCluster::controller_id, id, 0, message::MessageType::START_REQUEST);
+                ranks_[id]->step();
+            }
+        }
+
+        LocalNetwork& network() { return network_; }
+
+        void send(raft::node_id_t source_id, raft::node_id_t dest_id, raft::group_id_t group_id, message::MessageType type)
+        {
+            message::Message message;
+            message.set_source_id(source_id);
+            message.set_dest_id(dest_id);
+            message.set_group_id(group_id);
+            message.set_type(type);
+            network_.deliver(std::move(message));
+        }
+
+        void send(raft::node_id_t source_id, raft::node_id_t dest_id, raft::group_id_t group_id, message::MessageType type, const google::protobuf::Message& payload)
+        {
+            message::Message message;
+            message.set_source_id(source_id);
+            message.set_dest_id(dest_id);
+            message.set_group_id(group_id);
+            message.set_type(type);
+            message.mutable_payload()->PackFrom(payload);
+            network_.deliver(std::move(message));
+        }
+
+        bool run_until(const std::function<bool()>& condition, time_t timeout = 5000)
+        {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+            while (std::chrono::steady_clock::now() < deadline)
+            {
+                for (auto& [id, rank]: ranks_)
+                    rank->step();
+
+                if (condition())
+                    return true;
+
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+
+            return false;
+        }
+
+        // Send a command of the client to a rank, and return the responses it got until the first one
+        std::vector<message::Message> command(raft::node_id_t id, raft::group_id_t group_id, const std::string& command)
+        {
+            command_entry::CommandEntryRequest request;
+            request.set_command(command);
+            request.set_sequence(next_sequence_);
+            request.set_first_unacked_sequence(next_sequence_);
+            ++next_sequence_;
+            send(client_id, id, group_id, message::MessageType::COMMAND_ENTRY_REQUEST, request);
+
+            return wait_responses(client_id);
+        }
+
+        std::vector<message::Message> wait_responses(raft::node_id_t id)
+        {
+            std::vector<message::Message> responses;
+            run_until([this, id, &responses]() {
+                for (auto& message: network_.take_messages(id))
+                {
+                    if (message.type() == message::MessageType::COMMAND_ENTRY_RESPONSE)
+                        responses.push_back(std::move(message));
+                }
+                return !responses.empty();
+            });
+
+            return responses;
+        }
+
+        // The rank becomes the leader of the group (current term 0), true once it commits a command
+        bool elect(raft::node_id_t id, raft::group_id_t group_id)
+        {
+            send(LocalCluster::tester_id, id, group_id, message::MessageType::TIMEOUT_NOW);
+
+            return run_until([this, id, group_id]() {
+                std::vector<message::Message> responses = command(id, group_id, "ELECTED");
+                return !responses.empty() && is_committed(responses.front());
+            });
+        }
+
+        static bool is_committed(const message::Message& message)
+        {
+            command_entry::CommandEntryResponse response;
+            message.payload().UnpackTo(&response);
+            return response.command_committed();
+        }
+
+        void stop() { ranks_.clear(); }
+    private:
+        LocalNetwork network_;
+        std::map<raft::node_id_t, std::unique_ptr<raft::MultiServer>> ranks_;
+        uint64 next_sequence_;
+};
+
+// Commands of the log of a stopped rank in the group
+static std::vector<std::string> group_commands(raft::node_id_t id, raft::group_id_t group_id)
+{
+    std::vector<std::string> commands;
+
+    storage::WAL wal("logs/server_" + std::to_string(id) + (group_id == 0 ? "" : "_group_" + std::to_string(group_id)), 4 * 1024 * 1024);
+    wal.replay([&commands](uint32, const std::string& record) {
+        log_entry::LogEntry entry;
+        entry.ParseFromString(record);
+        commands.push_back(entry.command());
+    });
+
+    return commands;
+}
+
+static uint32 count(const std::vector<std::string>& commands, const std::string& command)
+{
+    return std::count(commands.begin(), commands.end(), command);
+}
+
+// A controller command reaches a rank once: only the group of its key appends it and answers
+TEST(a_controller_command_is_handled_by_the_group_of_its_key)
+{
+    MultiCluster cluster;
+    CHECK(cluster.elect(1, 0));
+    CHECK(cluster.elect(2, 1));
+
+    const std::string command = "PUT controller_key value";
+    raft::group_id_t group_id = rpc::key_group(rpc::command_key(command), nb_groups);
+    raft::node_id_t leader_id = group_id == 0 ? 1 : 2;
+
+    command_entry::CommandEntryRequest request;
+    request.set_command(command);
+    cluster.send(LocalCluster::controller_id, leader_id, 0, message::MessageType::COMMAND_ENTRY_REQUEST, request);
+
+    std::vector<message::Message> responses = cluster.wait_responses(LocalCluster::controller_id);
+    CHECK_EQ(responses.size(), 1u);
+    CHECK_EQ(responses.front().group_id(), group_id);
+    CHECK(MultiCluster::is_committed(responses.front()));
+
+    // No late response of the other group
+    cluster.run_until([]() { return false; }, 200);
+    CHECK(cluster.network().take_messages(LocalCluster::controller_id).empty());
+
+    cluster.stop();
+    CHECK_EQ(count(group_commands(leader_id, group_id), command), 1u);
+    CHECK_EQ(count(group_commands(leader_id, 1 - group_id), command), 0u);
+}
+
+static command_entry::CommandEntryResponse unpack(const message::Message& message)
+{
+    command_entry::CommandEntryResponse response;
+    message.payload().UnpackTo(&response);
+    return response;
+}
+
+// Each group of a rank only sees the messages of its group id: the leader of a group is a follower in the other one
+TEST(the_messages_are_routed_by_group_id)
+{
+    MultiCluster cluster;
+    CHECK(cluster.elect(1, 0));
+    CHECK(cluster.elect(2, 1));
+
+    std::vector<message::Message> responses = cluster.command(1, 0, "PUT a group_0");
+    CHECK_EQ(responses.size(), 1u);
+    CHECK_EQ(responses.front().group_id(), 0u);
+    CHECK(unpack(responses.front()).command_committed());
+
+    responses = cluster.command(2, 1, "PUT a group_1");
+    CHECK_EQ(responses.size(), 1u);
+    CHECK_EQ(responses.front().group_id(), 1u);
+    CHECK(unpack(responses.front()).command_committed());
+
+    // The other group of the rank rejects it with the leader of its own group
+    responses = cluster.command(1, 1, "PUT b group_1");
+    CHECK_EQ(responses.size(), 1u);
+    CHECK_EQ(responses.front().group_id(), 1u);
+    CHECK(!unpack(responses.front()).command_committed());
+    CHECK_EQ(unpack(responses.front()).leader_hint().value(), 2u);
+
+    responses = cluster.command(2, 0, "PUT b group_0");
+    CHECK_EQ(responses.size(), 1u);
+    CHECK(!unpack(responses.front()).command_committed());
+    CHECK_EQ(unpack(responses.front()).leader_hint().value(), 1u);
+
+    // A message of an unknown group is dropped
+    command_entry::CommandEntryRequest request;
+    request.set_command("PUT c unknown");
+    request.set_sequence(1000);
+    cluster.send(client_id, 1, nb_groups, message::MessageType::COMMAND_ENTRY_REQUEST, request);
+    cluster.run_until([]() { return false; }, 200);
+    CHECK(cluster.network().take_messages(client_id).empty());
+
+    cluster.stop();
+
+    std::vector<std::string> group_0 = group_commands(1, 0);
+    std::vector<std::string> group_1 = group_commands(2, 1);
+    CHECK_EQ(count(group_0, "PUT a group_0"), 1u);
+    CHECK_EQ(count(group_0, "PUT a group_1"), 0u);
+    CHECK_EQ(count(group_1, "PUT a group_1"), 1u);
+    CHECK_EQ(count(group_1, "PUT a group_0"), 0u);
+    CHECK_EQ(count(group_0, "PUT c unknown") + count(group_1, "PUT c unknown"), 0u);
+}
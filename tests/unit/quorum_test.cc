@@ -0,0 +1,121 @@
+#include "unit_test.hh"
+
+#include <random> // std::mt19937
+#include <algorithm> // std::sort
+
+#include "raft_quorum.hh"
+
+// Index 0 is the leader in these tests
+static raft::QuorumTracker make_tracker(const std::vector<std::optional<raft::index_t>>& match_indexes)
+{
+    raft::QuorumTracker tracker(match_indexes.size());
+    for (uint32 i = 0; i < match_indexes.size(); ++i)
+        tracker.update(i, match_indexes.at(i));
+    return tracker;
+}
+
+// Highest index on a majority, by sorting the match indexes (none sorted first)
+static std::optional<raft::index_t> sorted_quorum_match_index(std::vector<std::optional<raft::index_t>> match_indexes)
+{
+    std::sort(match_indexes.begin(), match_indexes.end());
+    return match_indexes.at((match_indexes.size() - 1) / 2);
+}
+
+TEST(nothing_is_replicated_on_a_majority_of_an_empty_log)
+{
+    CHECK(!make_tracker({ std::nullopt, std::nullopt, std::nullopt }).quorum_match_index());
+
+    // A single replica out of three is not a majority
+    CHECK(!make_tracker({ 8, std::nullopt, std::nullopt }).quorum_match_index());
+    CHECK(!raft::QuorumTracker(0).quorum_match_index());
+}
+
+TEST(the_quorum_of_an_odd_cluster_is_the_median)
+{
+    CHECK_EQ(make_tracker({ 4 }).quorum_match_index().value(), 4u);
+    CHECK_EQ(make_tracker({ 9, 3, 6 }).quorum_match_index().value(), 6u);
+    CHECK_EQ(make_tracker({ 9, 3, std::nullopt }).quorum_match_index().value(), 3u);
+
+    // 3 servers out of 5 have 7
+    CHECK_EQ(make_tracker({ 10, 2, 7, 8, std::nullopt }).quorum_match_index().value(), 7u);
+    CHECK_EQ(make_tracker({ 5, 5, 5, 1, 1 }).quorum_match_index().value(), 5u);
+}
+
+TEST(the_quorum_of_an_even_cluster_needs_more_than_half)
+{
+    // 2 servers out of 2
+    CHECK_EQ(make_tracker({ 9, 4 }).quorum_match_index().value(), 4u);
+    CHECK(!make_tracker({ 9, std::nullopt }).quorum_match_index());
+
+    // 3 servers out of 4: half of them having 9 is not enough
+    CHECK_EQ(make_tracker({ 9, 9, 4, 2 }).quorum_match_index().value(), 4u);
+    CHECK_EQ(make_tracker({ 9, 7, 7, std::nullopt }).quorum_match_index().value(), 7u);
+    CHECK(!make_tracker({ 9, 7, std::nullopt, std::nullopt }).quorum_match_index());
+
+    // 4 servers out of 6
+    CHECK_EQ(make_tracker({ 6, 5, 4, 3, 2, 1 }).quorum_match_index().value(), 3u);
+}
+
+// The leader only counts its own entries once they are durable: it may be behind its followers
+TEST(a_leader_whose_durable_index_lags_is_counted_like_a_follower)
+{
+    CHECK_EQ(make_tracker({ 5, 9, 7 }).quorum_match_index().value(), 7u);
+    CHECK_EQ(make_tracker({ std::nullopt, 9, 7 }).quorum_match_index().value(), 7u);
+    CHECK_EQ(make_tracker({ 2, 9, 9, 9 }).quorum_match_index().value(), 9u);
+    CHECK_EQ(make_tracker({ 2, 9, 9, 1 }).quorum_match_index().value(), 2u);
+
+    raft::QuorumTracker tracker = make_tracker({ std::nullopt, 4, std::nullopt });
+    CHECK(!tracker.quorum_match_index());
+
+    // The leader sync completes
+    tracker.update(0, 6);
+    CHECK_EQ(tracker.quorum_match_index().value(), 4u);
+}
+
+TEST(the_match_indexes_can_go_down_and_be_reset)
+{
+    raft::QuorumTracker tracker = make_tracker({ 8, 8, 3 });
+    CHECK_EQ(tracker.quorum_match_index().value(), 8u);
+
+    // A follower restarted with a shorter log
+    tracker.update(1, 2);
+    CHECK_EQ(tracker.quorum_match_index().value(), 3u);
+
+    // New leader
+    tracker.reset();
+    CHECK(!tracker.quorum_match_index());
+
+    tracker.update(2, 5);
+    tracker.update(0, 5);
+    CHECK_EQ(tracker.quorum_match_index().value(), 5u);
+}
+
+TEST(the_quorum_matches_the_sorted_match_indexes)
+{
+    std::mt19937 random(42);
+
+    for (uint32 nb_servers = 1; nb_servers <= 8; ++nb_servers)
+    {
+        for (uint32 round = 0; round < 200; ++round)
+        {
+            std::vector<std::optional<raft::index_t>> match_indexes;
+            for (uint32 i = 0; i < nb_servers; ++i)
+            {
+                // Few distinct values, to have ties and empty logs
+                raft::index_t value = random() % 6;
+                match_indexes.push_back(value == 0 ? std::nullopt : std::make_optional(value - 1));
+            }
+
+            // The same tracker is reused: the selection buffer must not leak between calls
+            raft::QuorumTracker tracker = make_tracker(match_indexes);
+            tracker.quorum_match_index();
+
+            std::optional<raft::index_t> expected = sorted_quorum_match_index(match_indexes);
+            std::optional<raft::index_t> actual = tracker.quorum_match_index();
+
+            CHECK_EQ(actual.has_value(), expected.has_value());
+            if (expected)
+                CHECK_EQ(actual.value(), expected.value());
+        }
+    }
+}
@@ -0,0 +1,265 @@
+#include "unit_test.hh"
+#include "local_network.hh"
+
+#include "raft_sessions.hh"
+
+#include "proto/transfer_leader.pb.h"
+
+TEST(a_sequence_is_applied_once_per_client)
+{
+    raft::SessionTable sessions(16);
+    CHECK(!sessions.is_applied(4, 1));
+
+    sessions.apply(4, 1, 1);
+    sessions.apply(4, 2, 2);
+    CHECK(sessions.is_applied(4, 1));
+    CHECK(sessions.is_applied(4, 2));
+    CHECK(!sessions.is_applied(4, 3));
+    CHECK(!sessions.is_applied(5, 1));
+}
+
+// Sequence 2 reaches the log before sequence 1 (sent to a new leader while 1 was lost with the old one)
+TEST(a_sequence_committed_out_of_order_is_still_applied)
+{
+    raft::SessionTable sessions(16);
+
+    sessions.apply(4, 2, 1);
+    CHECK(sessions.is_applied(4, 2));
+    CHECK(!sessions.is_applied(4, 1));
+    CHECK(!sessions.is_applied(4, 3));
+
+    sessions.apply(4, 1, 1);
+    CHECK(sessions.is_applied(4, 1));
+    CHECK(sessions.is_applied(4, 2));
+
+    // The client saw 1 to 3 committed
+    sessions.apply(4, 5, 4);
+    CHECK(sessions.is_applied(4, 3));
+    CHECK(!sessions.is_applied(4, 4));
+    CHECK(sessions.is_applied(4, 5));
+
+    // A command sent earlier carries an older first unacknowledged sequence: nothing is forgotten again
+    sessions.apply(4, 4, 2);
+    CHECK(sessions.is_applied(4, 3));
+    CHECK(sessions.is_applied(4, 4));
+    CHECK(!sessions.is_applied(4, 6));
+}
+
+TEST(the_least_recently_used_session_is_evicted)
+{
+    raft::SessionTable sessions(2);
+    sessions.apply(4, 1, 1);
+    sessions.apply(5, 1, 1);
+
+    // Client 4 is used again: client 5 is the least recently used one
+    sessions.apply(4, 2, 2);
+    sessions.apply(6, 1, 1);
+
+    CHECK(sessions.is_applied(4, 2));
+    CHECK(sessions.is_applied(6, 1));
+    CHECK(!sessions.is_applied(5, 1));
+}
+
+TEST(the_restored_sessions_keep_their_applied_sequences_and_lru_order)
+{
+    raft::SessionTable sessions(2);
+    sessions.apply(4, 1, 1);
+    sessions.apply(5, 3, 2);
+    sessions.apply(4, 2, 2);
+
+    snapshot::AppliedState state;
+    sessions.save(state);
+    CHECK_EQ(state.sessions_size(), 2);
+    CHECK_EQ(state.sessions(0).client_id(), 5u);
+    CHECK_EQ(state.sessions(0).first_unacked_sequence(), 2u);
+    CHECK_EQ(state.sessions(0).applied_sequences_size(), 1);
+    CHECK_EQ(state.sessions(0).applied_sequences(0), 3u);
+
+    raft::SessionTable restored(2);
+    restored.restore(state);
+    CHECK(restored.is_applied(5, 1));
+    CHECK(!restored.is_applied(5, 2));
+    CHECK(restored.is_applied(5, 3));
+    CHECK(restored.is_applied(4, 2));
+
+    // Same eviction as the saved table
+    restored.apply(6, 1, 1);
+    CHECK(!restored.is_applied(5, 3));
+    CHECK(restored.is_applied(4, 2));
+}
+
+// Result of a committed command, empty for a duplicate (not applied again)
+static std::string commit(LocalCluster& cluster, raft::node_id_t client_id, raft::node_id_t server_id, uint64 sequence, const std::string& command,
+                          std::optional<uint64> first_unacked_sequence = std::nullopt)
+{
+    std::optional<command_entry::CommandEntryResponse> response = cluster.command(client_id, server_id, sequence, command, first_unacked_sequence);
+    CHECK(response);
+    CHECK(response.value().command_committed());
+    CHECK_EQ(response.value().sequences_size(), 1);
+    CHECK_EQ(response.value().sequences(0), sequence);
+
+    return response.value().results_size() == 0 ? "" : response.value().results(0);
+}
+
+static uint32 count_entries(const std::vector<log_entry::LogEntry>& log, raft::node_id_t client_id, uint64 sequence)
+{
+    uint32 count = 0;
+    for (const auto& entry: log)
+    {
+        if (entry.client_id() == client_id && entry.sequence() == sequence)
+            ++count;
+    }
+    return count;
+}
+
+// The sessions are updated in log order on every server: the new leader recognizes the retry of a command
+// the previous leader applied, and evicted the same session
+TEST(a_command_retried_after_a_leader_change_is_applied_once)
+{
+    raft::Config config;
+    config.snapshot_threshold = 0;
+    config.state_machine = raft::StateMachineType::KV;
+    config.max_sessions = 2;
+
+    LocalCluster cluster({ 1, 2, 3 }, { 1, 2, 3, 4, 5, 6 }, config);
+    cluster.start(1);
+    cluster.start(2);
+    cluster.start(3);
+
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+
+    CHECK_EQ(commit(cluster, 5, 1, 1, "PUT j x"), "OK");
+
+    // Applying the CAS twice would leave k to b
+    CHECK_EQ(commit(cluster, 4, 1, 1, "PUT k a"), "OK");
+    CHECK_EQ(commit(cluster, 4, 1, 2, "CAS k a b"), "OK");
+    CHECK_EQ(commit(cluster, 4, 1, 3, "CAS k b a"), "OK");
+
+    // The session of client 5 is evicted
+    CHECK_EQ(commit(cluster, 6, 1, 1, "PUT l y"), "OK");
+
+    transfer_leader::TransferLeaderRequest transfer;
+    transfer.set_target_id(2);
+    cluster.send(LocalCluster::controller_id, 1, message::MessageType::TRANSFER_LEADER_REQUEST, transfer);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(2); }));
+
+    // The response to the CAS was lost: client 4 retries it with the new leader
+    CHECK_EQ(commit(cluster, 4, 2, 2, "CAS k a b"), "");
+
+    std::optional<read_index::ReadResponse> read = cluster.read(4, 2, 1, "k");
+    CHECK(read);
+    CHECK(read.value().success());
+    CHECK_EQ(read.value().value(), "a");
+
+    CHECK_EQ(commit(cluster, 6, 2, 1, "PUT l y"), "");
+
+    // An evicted session no longer suppresses the duplicates: the command is applied again
+    CHECK_EQ(commit(cluster, 5, 2, 1, "PUT j x"), "OK");
+
+    cluster.stop_all();
+
+    std::vector<log_entry::LogEntry> log = LocalCluster::read_log(2);
+    CHECK_EQ(count_entries(log, 4, 2), 1u);
+    CHECK_EQ(count_entries(log, 6, 1), 1u);
+    CHECK_EQ(count_entries(log, 5, 1), 2u);
+}
+
+// The client keeps several commands in flight: sequence 2 is lost with a deposed leader, sequence 3 is committed
+// by the new one, the retry of sequence 2 must still be applied
+TEST(a_command_committed_after_a_later_one_is_applied)
+{
+    raft::Config config;
+    config.snapshot_threshold = 0;
+    config.state_machine = raft::StateMachineType::KV;
+
+    LocalCluster cluster({ 1, 2, 3 }, { 1, 2, 3, 4 }, config);
+    cluster.start(1);
+    cluster.start(2);
+    cluster.start(3);
+
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+    CHECK_EQ(commit(cluster, 4, 1, 1, "PUT k a"), "OK");
+
+    // Leader 1 is cut from the cluster as the client sends sequence 2
+    cluster.network().disconnect(1);
+    cluster.send(4, 1, message::MessageType::COMMAND_ENTRY_REQUEST, LocalCluster::command_request(2, "PUT j x", 2));
+
+    cluster.elect(2);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(2); }));
+
+    // Sent with sequence 2 still in flight
+    CHECK_EQ(commit(cluster, 4, 2, 3, "PUT k c", 2), "OK");
+    CHECK_EQ(commit(cluster, 4, 2, 2, "PUT j x", 2), "OK");
+
+    std::optional<read_index::ReadResponse> read = cluster.read(4, 2, 1, "j");
+    CHECK(read);
+    CHECK(read.value().success());
+    CHECK_EQ(read.value().value(), "x");
+
+    // Both are duplicates now
+    CHECK_EQ(commit(cluster, 4, 2, 2, "PUT j x", 2), "");
+    CHECK_EQ(commit(cluster, 4, 2, 3, "PUT k c", 2), "");
+    CHECK_EQ(commit(cluster, 4, 2, 4, "PUT k d", 4), "OK");
+    CHECK_EQ(commit(cluster, 4, 2, 2, "PUT j x", 4), "");
+
+    cluster.stop_all();
+
+    std::vector<log_entry::LogEntry> log = LocalCluster::read_log(2);
+    CHECK_EQ(count_entries(log, 4, 2), 1u);
+    CHECK_EQ(count_entries(log, 4, 3), 1u);
+}
+
+// A command forwarded by a follower is retried directly with the leader before its commit:
+// the response must not go through the follower the client gave up on
+TEST(a_retried_command_is_answered_through_the_path_of_the_retry)
+{
+    raft::Config config;
+    config.snapshot_threshold = 0;
+    config.forward_commands = true;
+
+    LocalCluster cluster({ 1, 2, 3, 4, 5 }, { 1, 2, 3, 4, 5, 6 }, config);
+    for (raft::node_id_t id = 1; id <= 5; ++id)
+        cluster.start(id);
+
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+
+    // Leader 1 and follower 2 alone are not a majority: the command stays uncommitted
+    cluster.network().disconnect(3);
+    cluster.network().disconnect(4);
+    cluster.network().disconnect(5);
+
+    cluster.send(6, 2, message::MessageType::COMMAND_ENTRY_REQUEST, LocalCluster::command_request(1, "command", 1));
+    cluster.run_for(50);
+    CHECK(cluster.network().take_messages(6).empty());
+
+    // The client retries with the leader, then its proxy fails
+    cluster.send(6, 1, message::MessageType::COMMAND_ENTRY_REQUEST, LocalCluster::command_request(1, "command", 1));
+    cluster.run_for(50);
+    cluster.network().disconnect(2);
+
+    cluster.network().connect(3);
+    cluster.network().connect(4);
+
+    std::optional<command_entry::CommandEntryResponse> response;
+    CHECK(cluster.run_until([&cluster, &response]() {
+        for (const auto& message: cluster.network().take_messages(6))
+        {
+            if (message.type() == message::MessageType::COMMAND_ENTRY_RESPONSE)
+            {
+                CHECK_EQ(message.source_id(), 1u);
+                response.emplace();
+                message.payload().UnpackTo(&response.value());
+            }
+        }
+        return response.has_value();
+    }));
+
+    CHECK(response.value().command_committed());
+    CHECK_EQ(response.value().sequences(0), 1u);
+
+    cluster.stop_all();
+    CHECK_EQ(count_entries(LocalCluster::read_log(1), 6, 1), 1u);
+}
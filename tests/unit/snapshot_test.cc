@@ -0,0 +1,84 @@
+#include "unit_test.hh"
+#include "local_network.hh"
+
+#include "proto/transfer_leader.pb.h"
+
+static std::string commit(LocalCluster& cluster, raft::node_id_t server_id, uint64 sequence, const std::string& command)
+{
+    std::optional<command_entry::CommandEntryResponse> response = cluster.command(4, server_id, sequence, command);
+    CHECK(response);
+    CHECK(response.value().command_committed());
+    CHECK_EQ(response.value().results_size(), 1);
+
+    return response.value().results(0);
+}
+
+static std::string read(LocalCluster& cluster, raft::node_id_t server_id, uint64 sequence, const std::string& key)
+{
+    std::optional<read_index::ReadResponse> response = cluster.read(4, server_id, sequence, key);
+    CHECK(response);
+    CHECK(response.value().success());
+
+    return response.value().value();
+}
+
+// Server 3 starts after the leader compacted the entries it misses: it gets them as a snapshot sent in chunks
+TEST(a_follower_behind_the_compacted_log_installs_the_snapshot_of_the_leader)
+{
+    raft::Config config;
+    config.state_machine = raft::StateMachineType::KV;
+    config.snapshot_threshold = 5;
+    config.snapshot_chunk_size = 64;
+
+    LocalCluster cluster({ 1, 2, 3 }, { 1, 2, 3, 4 }, config);
+    cluster.start(1);
+    cluster.start(2);
+
+    cluster.elect(1);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(1); }));
+
+    for (uint64 sequence = 1; sequence <= 20; ++sequence)
+        CHECK_EQ(commit(cluster, 1, sequence, "PUT key_" + std::to_string(sequence) + " value_" + std::to_string(sequence)), "OK");
+
+    CHECK(cluster.run_until([]() {
+        std::optional<snapshot::Snapshot> snapshot = LocalCluster::read_snapshot(1);
+        return snapshot && snapshot.value().last_included_index() >= 10;
+    }));
+    CHECK(!LocalCluster::read_snapshot(3));
+
+    cluster.start(3);
+
+    CHECK(cluster.run_until([]() {
+        std::optional<snapshot::Snapshot> snapshot = LocalCluster::read_snapshot(3);
+        return snapshot && snapshot.value().last_included_index() >= 10;
+    }));
+
+    // The snapshot is larger than a chunk
+    std::optional<snapshot::Snapshot> leader_snapshot = LocalCluster::read_snapshot(1);
+    CHECK(leader_snapshot.value().data().size() > config.snapshot_chunk_size);
+    CHECK(cluster.network().delivered(message::MessageType::INSTALL_SNAPSHOT_REQUEST) >= 2);
+
+    // Server 3 replicates the entries following the snapshot
+    CHECK_EQ(commit(cluster, 1, 21, "PUT key_21 value_21"), "OK");
+    CHECK(cluster.run_until([&cluster]() { return cluster.server(3).commit_index() == cluster.server(1).commit_index(); }));
+
+    // The log of server 3 starts after the snapshot, it restarts from the snapshot and leads with the whole store
+    cluster.stop(3);
+    CHECK(LocalCluster::read_log(3).front().index() > 0);
+    cluster.start(3);
+
+    transfer_leader::TransferLeaderRequest transfer;
+    transfer.set_target_id(3);
+    cluster.send(LocalCluster::controller_id, 1, message::MessageType::TRANSFER_LEADER_REQUEST, transfer);
+    CHECK(cluster.run_until([&cluster]() { return cluster.is_leader(3); }));
+
+    CHECK_EQ(read(cluster, 3, 1, "key_1"), "value_1");
+    CHECK_EQ(read(cluster, 3, 2, "key_10"), "value_10");
+    CHECK_EQ(read(cluster, 3, 3, "key_21"), "value_21");
+
+    // The sessions came with the snapshot: a retried command is not applied again
+    std::optional<command_entry::CommandEntryResponse> retry = cluster.command(4, 3, 1, "PUT key_1 value_1");
+    CHECK(retry);
+    CHECK(retry.value().command_committed());
+    CHECK(retry.value().results_size() == 0 || retry.value().results(0).empty());
+}
@@ -0,0 +1,196 @@
+#include "unit_test.hh"
+
+#include <mutex> // std::mutex std::lock_guard
+#include <set> // std::set
+#include <deque> // std::deque
+#include <thread> // std::thread
+#include <chrono> // std::chrono
+
+#include "mpi_staged_rpc.hh"
+
+// Transport of the I/O stage in place of MPI: keeps the sent batches, receives the injected messages one at a time
+// It is called by the I/O thread while the test thread reads it
+class FakeTransport: public rpc::RPC
+{
+    public:
+        void send_message(const message::Message& message) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            callers_.insert(std::this_thread::get_id());
+
+            if (batching_)
+                batch_.push_back(message);
+            else
+                batches_.push_back({ message });
+        }
+
+        void begin_batch() override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            callers_.insert(std::this_thread::get_id());
+            batching_ = true;
+        }
+
+        void flush_batch() override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            callers_.insert(std::this_thread::get_id());
+
+            batching_ = false;
+            if (!batch_.empty())
+                batches_.push_back(std::move(batch_));
+            batch_.clear();
+        }
+
+        std::vector<message::Message> receive_messages() override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            callers_.insert(std::this_thread::get_id());
+
+            std::vector<message::Message> messages;
+            if (!incoming_.empty())
+            {
+                messages.push_back(std::move(incoming_.front()));
+                incoming_.pop_front();
+            }
+            return messages;
+        }
+
+        bool has_message() override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            callers_.insert(std::this_thread::get_id());
+            return !incoming_.empty();
+        }
+
+        void inject(const message::Message& message)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            incoming_.push_back(message);
+        }
+
+        // Number of injected messages not received yet
+        uint32 pending()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return incoming_.size();
+        }
+
+        std::vector<std::vector<message::Message>> batches()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return batches_;
+        }
+
+        std::set<std::thread::id> callers()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return callers_;
+        }
+    private:
+        std::mutex mutex_;
+        bool batching_ = false;
+        std::vector<message::Message> batch_;
+        std::vector<std::vector<message::Message>> batches_;
+        std::deque<message::Message> incoming_;
+        // Threads that called the transport
+        std::set<std::thread::id> callers_;
+};
+
+static message::Message make_message(raft::node_id_t dest_id, raft::term_t term)
+{
+    message::Message message;
+    message.set_source_id(1);
+    message.set_dest_id(dest_id);
+    message.set_type(message::MessageType::APPEND_ENTRIES_REQUEST);
+    message.set_term(term);
+    return message;
+}
+
+// More batches than the ring holds are flushed before the I/O stage runs: close() waits until they are all sent,
+// each one as a single batch of the transport, in order, by the I/O thread only
+TEST(the_batches_of_the_node_are_sent_in_order_by_the_io_stage)
+{
+    FakeTransport transport;
+    mpi::StagedRPC staged_rpc(transport);
+    const uint32 count = 3000;
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        staged_rpc.begin_batch();
+        staged_rpc.send_message(make_message(2, 2 * i));
+        staged_rpc.send_message(make_message(3, 2 * i + 1));
+        staged_rpc.flush_batch();
+    }
+
+    // Outside of a batch, a message is sent right away
+    staged_rpc.send_message(make_message(4, 2 * count));
+
+    // An empty batch sends nothing
+    staged_rpc.begin_batch();
+    staged_rpc.flush_batch();
+
+    std::thread io_thread(&mpi::StagedRPC::run_io, &staged_rpc);
+    std::thread::id io_thread_id = io_thread.get_id();
+    staged_rpc.close();
+    io_thread.join();
+
+    std::vector<std::vector<message::Message>> batches = transport.batches();
+    CHECK_EQ(batches.size(), count + 1);
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        CHECK_EQ(batches.at(i).size(), 2u);
+        CHECK_EQ(batches.at(i).at(0).dest_id(), 2u);
+        CHECK_EQ(batches.at(i).at(0).term(), 2 * i);
+        CHECK_EQ(batches.at(i).at(1).dest_id(), 3u);
+        CHECK_EQ(batches.at(i).at(1).term(), 2 * i + 1);
+    }
+
+    CHECK_EQ(batches.at(count).size(), 1u);
+    CHECK_EQ(batches.at(count).at(0).term(), 2 * count);
+
+    CHECK(transport.callers() == std::set<std::thread::id>({ io_thread_id }));
+}
+
+// The I/O stage receives more batches than the ring holds before the node reads any: they come out in order
+TEST(the_received_messages_reach_the_node_in_order)
+{
+    FakeTransport transport;
+    mpi::StagedRPC staged_rpc(transport);
+    const uint32 count = 3000;
+
+    for (uint32 i = 0; i < count; ++i)
+        transport.inject(make_message(1, i));
+
+    std::thread io_thread(&mpi::StagedRPC::run_io, &staged_rpc);
+    std::thread::id io_thread_id = io_thread.get_id();
+
+    // Every message is received (one per batch) before the node reads any
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (transport.pending() > 0 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    // Checked once the I/O thread is joined (a failed check ends the test)
+    uint32 pending = transport.pending();
+    bool has_message = staged_rpc.has_message();
+
+    std::vector<message::Message> messages;
+    while (messages.size() < count && std::chrono::steady_clock::now() < deadline)
+    {
+        for (auto& message: staged_rpc.receive_messages())
+            messages.push_back(std::move(message));
+    }
+
+    staged_rpc.close();
+    io_thread.join();
+
+    CHECK_EQ(pending, 0u);
+    CHECK(has_message);
+    CHECK_EQ(messages.size(), count);
+    for (uint32 i = 0; i < count; ++i)
+        CHECK_EQ(messages.at(i).term(), i);
+
+    CHECK(!staged_rpc.has_message());
+    CHECK(transport.callers() == std::set<std::thread::id>({ io_thread_id }));
+}
@@ -0,0 +1,53 @@
+#include "unit_test.hh"
+
+#include <boost/filesystem.hpp> // boost::filesystem::remove_all
+#include <google/protobuf/stubs/common.h> // google::protobuf::ShutdownProtobufLibrary
+
+namespace unit
+{
+    std::vector<TestCase>& test_cases()
+    {
+        static std::vector<TestCase> cases;
+        return cases;
+    }
+
+    void fail(const char* file, int line, const std::string& message)
+    {
+        std::ostringstream stream;
+        stream << file << ":" << line << ": " << message;
+        throw Failure { stream.str() };
+    }
+
+    void remove_directory(const std::string& path)
+    {
+        boost::filesystem::remove_all(path);
+    }
+}
+
+int main()
+{
+    int nb_failures = 0;
+
+    for (const auto& test_case: unit::test_cases())
+    {
+        try
+        {
+            test_case.function();
+            std::cout << "[ OK ] " << test_case.name << std::endl;
+        }
+        catch (const unit::Failure& failure)
+        {
+            std::cout << "[FAIL] " << test_case.name << ": " << failure.message << std::endl;
+            ++nb_failures;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[FAIL] " << test_case.name << ": exception: " << e.what() << std::endl;
+            ++nb_failures;
+        }
+    }
+
+    google::protobuf::ShutdownProtobufLibrary();
+
+    return nb_failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
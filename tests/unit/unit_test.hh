@@ -0,0 +1,65 @@
+#pragma once
+
+#include <iostream> // std::cout std::cerr
+#include <sstream> // std::ostringstream
+#include <string> // std::string
+#include <vector> // std::vector
+#include <functional> // std::function
+
+// Minimal unit test harness: each test file registers its tests with TEST, unit_test.cc runs them all
+namespace unit
+{
+    struct TestCase
+    {
+        std::string name;
+        std::function<void()> function;
+    };
+
+    // Thrown by a failed check, ends the running test
+    struct Failure
+    {
+        std::string message;
+    };
+
+    std::vector<TestCase>& test_cases();
+
+    struct Registrar
+    {
+        Registrar(const std::string& name, const std::function<void()>& function)
+        {
+            test_cases().push_back(TestCase { name, function });
+        }
+    };
+
+    [[noreturn]] void fail(const char* file, int line, const std::string& message);
+
+    // Remove a directory the servers or the WAL write to (each test starts from an empty disk)
+    void remove_directory(const std::string& path);
+}
+
+#define TEST(name) \
+    static void name(); \
+    static unit::Registrar name##_registrar(#name, name); \
+    static void name()
+
+#define CHECK(condition) \
+    do \
+    { \
+        if (!(condition)) \
+            unit::fail(__FILE__, __LINE__, #condition); \
+    } while (0)
+
+// Both values must be printable
+// They are copied: a reference into a temporary (optional.value(), response.field()) would dangle
+#define CHECK_EQ(actual, expected) \
+    do \
+    { \
+        const auto actual_value = (actual); \
+        const auto expected_value = (expected); \
+        if (!(actual_value == expected_value)) \
+        { \
+            std::ostringstream message; \
+            message << #actual " == " #expected " (" << actual_value << " != " << expected_value << ")"; \
+            unit::fail(__FILE__, __LINE__, message.str()); \
+        } \
+    } while (0)
@@ -0,0 +1,355 @@
+#include "unit_test.hh"
+
+#include <cstdio> // std::snprintf
+#include <fstream> // std::ifstream std::ofstream
+#include <iterator> // std::istreambuf_iterator
+#include <utility> // std::pair
+#include <boost/filesystem.hpp> // boost::filesystem::exists
+#include <boost/crc.hpp> // boost::crc_32_type
+
+#include "wal.hh"
+
+static const std::string directory = "wal";
+// Size of a record header: [size][crc32]
+static const uint64 header_size = 8;
+// A 10 bytes record takes 18 bytes on disk: with 30 bytes segments, each segment holds 2 of them
+static const uint64 two_records_segment_size = 30;
+
+static std::string segment_path(uint32 first_index)
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "segment_%010lu.wal", first_index);
+    return directory + "/" + name;
+}
+
+static std::string read_file(const std::string& path)
+{
+    std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void write_file(const std::string& path, const std::string& content)
+{
+    std::ofstream file(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    file << content;
+}
+
+static std::string record(uint32 index)
+{
+    char content[16];
+    std::snprintf(content, sizeof(content), "record_%03lu", index);
+    return content;
+}
+
+static std::vector<std::pair<uint32, std::string>> replay(storage::WAL& wal)
+{
+    std::vector<std::pair<uint32, std::string>> records;
+    wal.replay([&records](uint32 index, const std::string& content) {
+        records.emplace_back(index, content);
+    });
+    return records;
+}
+
+// Records 0 to count - 1, 2 per segment
+static void append_records(storage::WAL& wal, uint32 count)
+{
+    for (uint32 i = wal.size(); i < count; ++i)
+        wal.append(record(i));
+    wal.sync();
+}
+
+TEST(records_are_replayed_in_order_after_reopen)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, 1024 * 1024);
+        CHECK(wal.empty());
+
+        wal.append("a");
+        wal.append("");
+        wal.append("ccc");
+        wal.sync();
+        CHECK_EQ(wal.size(), 3u);
+    }
+
+    storage::WAL wal(directory, 1024 * 1024);
+    CHECK_EQ(wal.size(), 3u);
+
+    auto records = replay(wal);
+    CHECK_EQ(records.size(), 3u);
+    CHECK_EQ(records.at(0).first, 0u);
+    CHECK_EQ(records.at(0).second, "a");
+    CHECK_EQ(records.at(1).second, "");
+    CHECK_EQ(records.at(2).first, 2u);
+    CHECK_EQ(records.at(2).second, "ccc");
+}
+
+TEST(a_record_is_framed_with_its_size_and_crc32)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, 1024 * 1024);
+        wal.append("hello");
+        wal.sync();
+    }
+
+    std::string content = read_file(segment_path(0));
+    CHECK_EQ(content.size(), header_size + 5);
+
+    std::uint32_t size;
+    std::uint32_t crc;
+    std::memcpy(&size, content.data(), sizeof(size));
+    std::memcpy(&crc, content.data() + sizeof(size), sizeof(crc));
+
+    boost::crc_32_type expected_crc;
+    expected_crc.process_bytes("hello", 5);
+
+    CHECK_EQ(size, 5u);
+    CHECK_EQ(crc, expected_crc.checksum());
+    CHECK_EQ(content.substr(header_size), "hello");
+}
+
+TEST(a_truncated_last_record_is_dropped_on_reopen)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, 1024 * 1024);
+        append_records(wal, 3);
+    }
+
+    // Crash in the middle of the last append
+    uint64 full_size = boost::filesystem::file_size(segment_path(0));
+    boost::filesystem::resize_file(segment_path(0), full_size - 2);
+
+    {
+        storage::WAL wal(directory, 1024 * 1024);
+        CHECK_EQ(wal.size(), 2u);
+        CHECK_EQ(replay(wal).size(), 2u);
+
+        // The torn bytes are cut, the next record follows the last valid one
+        CHECK_EQ(boost::filesystem::file_size(segment_path(0)), full_size / 3 * 2);
+
+        wal.append("new");
+        wal.sync();
+    }
+
+    storage::WAL wal(directory, 1024 * 1024);
+    auto records = replay(wal);
+    CHECK_EQ(records.size(), 3u);
+    CHECK_EQ(records.at(1).second, record(1));
+    CHECK_EQ(records.at(2).first, 2u);
+    CHECK_EQ(records.at(2).second, "new");
+}
+
+TEST(a_partial_header_is_dropped_on_reopen)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, 1024 * 1024);
+        append_records(wal, 2);
+    }
+
+    std::string content = read_file(segment_path(0));
+    write_file(segment_path(0), content + std::string(3, '\x7f'));
+
+    storage::WAL wal(directory, 1024 * 1024);
+    CHECK_EQ(wal.size(), 2u);
+    CHECK_EQ(boost::filesystem::file_size(segment_path(0)), content.size());
+}
+
+TEST(a_corrupted_record_drops_it_and_the_following_ones)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, 1024 * 1024);
+        append_records(wal, 3);
+    }
+
+    // Flip a byte of the payload of the second record: its crc no longer matches
+    std::string content = read_file(segment_path(0));
+    uint64 frame_size = content.size() / 3;
+    content[frame_size + header_size] ^= 0x01;
+    write_file(segment_path(0), content);
+
+    storage::WAL wal(directory, 1024 * 1024);
+    CHECK_EQ(wal.size(), 1u);
+
+    auto records = replay(wal);
+    CHECK_EQ(records.size(), 1u);
+    CHECK_EQ(records.at(0).second, record(0));
+}
+
+TEST(the_log_rolls_to_a_new_segment_when_full)
+{
+    unit::remove_directory(directory);
+
+    storage::WAL wal(directory, two_records_segment_size);
+    append_records(wal, 5);
+
+    CHECK(boost::filesystem::exists(segment_path(0)));
+    CHECK(boost::filesystem::exists(segment_path(2)));
+    CHECK(boost::filesystem::exists(segment_path(4)));
+    CHECK(!boost::filesystem::exists(segment_path(1)));
+    CHECK(!boost::filesystem::exists(segment_path(3)));
+
+    auto records = replay(wal);
+    CHECK_EQ(records.size(), 5u);
+    for (uint32 i = 0; i < records.size(); ++i)
+    {
+        CHECK_EQ(records.at(i).first, i);
+        CHECK_EQ(records.at(i).second, record(i));
+    }
+}
+
+TEST(the_segments_after_a_gap_are_removed_on_reopen)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, two_records_segment_size);
+        append_records(wal, 6);
+    }
+
+    // The middle segment is lost: the records after it cannot follow the log anymore
+    boost::filesystem::remove(segment_path(2));
+
+    storage::WAL wal(directory, two_records_segment_size);
+    CHECK_EQ(wal.size(), 2u);
+    CHECK_EQ(replay(wal).size(), 2u);
+    CHECK(!boost::filesystem::exists(segment_path(4)));
+}
+
+TEST(a_torn_segment_removes_the_following_ones_on_reopen)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, two_records_segment_size);
+        append_records(wal, 6);
+    }
+
+    boost::filesystem::resize_file(segment_path(2), boost::filesystem::file_size(segment_path(2)) - 1);
+
+    storage::WAL wal(directory, two_records_segment_size);
+    CHECK_EQ(wal.size(), 3u);
+    CHECK(!boost::filesystem::exists(segment_path(4)));
+}
+
+TEST(truncate_inside_a_segment_removes_the_later_segments)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, two_records_segment_size);
+        append_records(wal, 6);
+
+        // Segments [0, 1] [2, 3] [4, 5]: keep 0 to 2
+        wal.truncate(3);
+        CHECK_EQ(wal.size(), 3u);
+        CHECK(!boost::filesystem::exists(segment_path(4)));
+
+        // Appended in the cut segment, right after record 2
+        wal.append("new");
+        wal.sync();
+        CHECK_EQ(wal.size(), 4u);
+    }
+
+    storage::WAL wal(directory, two_records_segment_size);
+    auto records = replay(wal);
+    CHECK_EQ(records.size(), 4u);
+    CHECK_EQ(records.at(2).second, record(2));
+    CHECK_EQ(records.at(3).first, 3u);
+    CHECK_EQ(records.at(3).second, "new");
+}
+
+TEST(truncate_at_a_segment_boundary_removes_the_whole_segment)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, two_records_segment_size);
+        append_records(wal, 6);
+
+        wal.truncate(2);
+        CHECK_EQ(wal.size(), 2u);
+        CHECK(!boost::filesystem::exists(segment_path(2)));
+        CHECK(!boost::filesystem::exists(segment_path(4)));
+
+        // Truncating after the end does nothing
+        wal.truncate(10);
+        CHECK_EQ(wal.size(), 2u);
+
+        wal.append("new");
+        wal.sync();
+    }
+
+    storage::WAL wal(directory, two_records_segment_size);
+    auto records = replay(wal);
+    CHECK_EQ(records.size(), 3u);
+    CHECK_EQ(records.at(1).second, record(1));
+    CHECK_EQ(records.at(2).first, 2u);
+    CHECK_EQ(records.at(2).second, "new");
+}
+
+TEST(compact_removes_the_segments_before_the_index)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, two_records_segment_size);
+        append_records(wal, 6);
+
+        // Record 3 is still needed: its segment is kept
+        wal.compact(3);
+        CHECK(!boost::filesystem::exists(segment_path(0)));
+        CHECK(boost::filesystem::exists(segment_path(2)));
+
+        // The active segment is always kept
+        wal.compact(6);
+        CHECK(!boost::filesystem::exists(segment_path(2)));
+        CHECK(boost::filesystem::exists(segment_path(4)));
+        CHECK_EQ(wal.size(), 6u);
+        wal.sync();
+    }
+
+    storage::WAL wal(directory, two_records_segment_size);
+    CHECK_EQ(wal.size(), 6u);
+
+    auto records = replay(wal);
+    CHECK_EQ(records.size(), 2u);
+    CHECK_EQ(records.at(0).first, 4u);
+    CHECK_EQ(records.at(0).second, record(4));
+}
+
+TEST(reset_starts_an_empty_log_at_the_index)
+{
+    unit::remove_directory(directory);
+
+    {
+        storage::WAL wal(directory, two_records_segment_size);
+        append_records(wal, 4);
+
+        wal.reset(10);
+        CHECK_EQ(wal.size(), 10u);
+        CHECK(!boost::filesystem::exists(segment_path(0)));
+        CHECK(!boost::filesystem::exists(segment_path(2)));
+        CHECK(replay(wal).empty());
+
+        wal.append("new");
+        wal.sync();
+        CHECK(boost::filesystem::exists(segment_path(10)));
+    }
+
+    storage::WAL wal(directory, two_records_segment_size);
+    CHECK_EQ(wal.size(), 11u);
+
+    auto records = replay(wal);
+    CHECK_EQ(records.size(), 1u);
+    CHECK_EQ(records.at(0).first, 10u);
+    CHECK_EQ(records.at(0).second, "new");
+}
@@ -1,5 +1,8 @@
 import json
-from proto import persistent_state_pb2
+import os
+import struct
+import zlib
+from proto import log_entry_pb2
 from google.protobuf import text_format
 
 
@@ -81,12 +84,32 @@ def is_word_in_string(word, string):
             return True
     return False
 
-def read_log(filename):
-    with open(filename, 'rb') as f:
-        logs = persistent_state_pb2.PersistentState()
-        logs.ParseFromString(f.read())
-        f.close()
-        return logs.log_entries
+# Replay the write-ahead log segments of a server directory
+def read_log(dirname):
+    logs = []
+
+    segments = sorted(f for f in os.listdir(dirname) if f.startswith("segment_") and f.endswith(".wal"))
+
+    for segment in segments:
+        with open(os.path.join(dirname, segment), 'rb') as f:
+            content = f.read()
+            f.close()
+
+        offset = 0
+        while offset + 8 <= len(content):
+            size, crc = struct.unpack_from("<II", content, offset)
+            payload = content[offset + 8:offset + 8 + size]
+
+            if len(payload) != size or zlib.crc32(payload) != crc:
+                break
+
+            entry = log_entry_pb2.LogEntry()
+            entry.ParseFromString(payload)
+            logs.append(entry)
+
+            offset += 8 + size
+
+    return logs
     
 def are_logs_identical(log_a, log_b):
     if len(log_a) != len(log_b):